@@ -19,6 +19,7 @@
  * Included header
  ******************************************************************************/
 
+#include "StdPeriphDriver.h"
 #include "global.h"
 #include "debug_llc.h"
 
@@ -72,6 +73,117 @@ const uint8 CRC_mg_au8CrcTable[256] =
 0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb,
 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3
  };
+
+#if MG_CRC8_SLICE_BY_4
+/* Slice-by-4 tables, CRC_mg_au8CrcTableN[i] = CRC_mg_au8CrcTable[CRC_mg_au8CrcTableN-1[i]] */
+const uint8 CRC_mg_au8CrcTable1[256] = 
+{
+0x00, 0x15, 0x2a, 0x3f, 0x54, 0x41, 0x7e, 0x6b,
+0xa8, 0xbd, 0x82, 0x97, 0xfc, 0xe9, 0xd6, 0xc3,
+0x57, 0x42, 0x7d, 0x68, 0x03, 0x16, 0x29, 0x3c,
+0xff, 0xea, 0xd5, 0xc0, 0xab, 0xbe, 0x81, 0x94,
+0xae, 0xbb, 0x84, 0x91, 0xfa, 0xef, 0xd0, 0xc5,
+0x06, 0x13, 0x2c, 0x39, 0x52, 0x47, 0x78, 0x6d,
+0xf9, 0xec, 0xd3, 0xc6, 0xad, 0xb8, 0x87, 0x92,
+0x51, 0x44, 0x7b, 0x6e, 0x05, 0x10, 0x2f, 0x3a,
+0x5b, 0x4e, 0x71, 0x64, 0x0f, 0x1a, 0x25, 0x30,
+0xf3, 0xe6, 0xd9, 0xcc, 0xa7, 0xb2, 0x8d, 0x98,
+0x0c, 0x19, 0x26, 0x33, 0x58, 0x4d, 0x72, 0x67,
+0xa4, 0xb1, 0x8e, 0x9b, 0xf0, 0xe5, 0xda, 0xcf,
+0xf5, 0xe0, 0xdf, 0xca, 0xa1, 0xb4, 0x8b, 0x9e,
+0x5d, 0x48, 0x77, 0x62, 0x09, 0x1c, 0x23, 0x36,
+0xa2, 0xb7, 0x88, 0x9d, 0xf6, 0xe3, 0xdc, 0xc9,
+0x0a, 0x1f, 0x20, 0x35, 0x5e, 0x4b, 0x74, 0x61,
+0xb6, 0xa3, 0x9c, 0x89, 0xe2, 0xf7, 0xc8, 0xdd,
+0x1e, 0x0b, 0x34, 0x21, 0x4a, 0x5f, 0x60, 0x75,
+0xe1, 0xf4, 0xcb, 0xde, 0xb5, 0xa0, 0x9f, 0x8a,
+0x49, 0x5c, 0x63, 0x76, 0x1d, 0x08, 0x37, 0x22,
+0x18, 0x0d, 0x32, 0x27, 0x4c, 0x59, 0x66, 0x73,
+0xb0, 0xa5, 0x9a, 0x8f, 0xe4, 0xf1, 0xce, 0xdb,
+0x4f, 0x5a, 0x65, 0x70, 0x1b, 0x0e, 0x31, 0x24,
+0xe7, 0xf2, 0xcd, 0xd8, 0xb3, 0xa6, 0x99, 0x8c,
+0xed, 0xf8, 0xc7, 0xd2, 0xb9, 0xac, 0x93, 0x86,
+0x45, 0x50, 0x6f, 0x7a, 0x11, 0x04, 0x3b, 0x2e,
+0xba, 0xaf, 0x90, 0x85, 0xee, 0xfb, 0xc4, 0xd1,
+0x12, 0x07, 0x38, 0x2d, 0x46, 0x53, 0x6c, 0x79,
+0x43, 0x56, 0x69, 0x7c, 0x17, 0x02, 0x3d, 0x28,
+0xeb, 0xfe, 0xc1, 0xd4, 0xbf, 0xaa, 0x95, 0x80,
+0x14, 0x01, 0x3e, 0x2b, 0x40, 0x55, 0x6a, 0x7f,
+0xbc, 0xa9, 0x96, 0x83, 0xe8, 0xfd, 0xc2, 0xd7
+};
+
+const uint8 CRC_mg_au8CrcTable2[256] = 
+{
+0x00, 0x6b, 0xd6, 0xbd, 0xab, 0xc0, 0x7d, 0x16,
+0x51, 0x3a, 0x87, 0xec, 0xfa, 0x91, 0x2c, 0x47,
+0xa2, 0xc9, 0x74, 0x1f, 0x09, 0x62, 0xdf, 0xb4,
+0xf3, 0x98, 0x25, 0x4e, 0x58, 0x33, 0x8e, 0xe5,
+0x43, 0x28, 0x95, 0xfe, 0xe8, 0x83, 0x3e, 0x55,
+0x12, 0x79, 0xc4, 0xaf, 0xb9, 0xd2, 0x6f, 0x04,
+0xe1, 0x8a, 0x37, 0x5c, 0x4a, 0x21, 0x9c, 0xf7,
+0xb0, 0xdb, 0x66, 0x0d, 0x1b, 0x70, 0xcd, 0xa6,
+0x86, 0xed, 0x50, 0x3b, 0x2d, 0x46, 0xfb, 0x90,
+0xd7, 0xbc, 0x01, 0x6a, 0x7c, 0x17, 0xaa, 0xc1,
+0x24, 0x4f, 0xf2, 0x99, 0x8f, 0xe4, 0x59, 0x32,
+0x75, 0x1e, 0xa3, 0xc8, 0xde, 0xb5, 0x08, 0x63,
+0xc5, 0xae, 0x13, 0x78, 0x6e, 0x05, 0xb8, 0xd3,
+0x94, 0xff, 0x42, 0x29, 0x3f, 0x54, 0xe9, 0x82,
+0x67, 0x0c, 0xb1, 0xda, 0xcc, 0xa7, 0x1a, 0x71,
+0x36, 0x5d, 0xe0, 0x8b, 0x9d, 0xf6, 0x4b, 0x20,
+0x0b, 0x60, 0xdd, 0xb6, 0xa0, 0xcb, 0x76, 0x1d,
+0x5a, 0x31, 0x8c, 0xe7, 0xf1, 0x9a, 0x27, 0x4c,
+0xa9, 0xc2, 0x7f, 0x14, 0x02, 0x69, 0xd4, 0xbf,
+0xf8, 0x93, 0x2e, 0x45, 0x53, 0x38, 0x85, 0xee,
+0x48, 0x23, 0x9e, 0xf5, 0xe3, 0x88, 0x35, 0x5e,
+0x19, 0x72, 0xcf, 0xa4, 0xb2, 0xd9, 0x64, 0x0f,
+0xea, 0x81, 0x3c, 0x57, 0x41, 0x2a, 0x97, 0xfc,
+0xbb, 0xd0, 0x6d, 0x06, 0x10, 0x7b, 0xc6, 0xad,
+0x8d, 0xe6, 0x5b, 0x30, 0x26, 0x4d, 0xf0, 0x9b,
+0xdc, 0xb7, 0x0a, 0x61, 0x77, 0x1c, 0xa1, 0xca,
+0x2f, 0x44, 0xf9, 0x92, 0x84, 0xef, 0x52, 0x39,
+0x7e, 0x15, 0xa8, 0xc3, 0xd5, 0xbe, 0x03, 0x68,
+0xce, 0xa5, 0x18, 0x73, 0x65, 0x0e, 0xb3, 0xd8,
+0x9f, 0xf4, 0x49, 0x22, 0x34, 0x5f, 0xe2, 0x89,
+0x6c, 0x07, 0xba, 0xd1, 0xc7, 0xac, 0x11, 0x7a,
+0x3d, 0x56, 0xeb, 0x80, 0x96, 0xfd, 0x40, 0x2b
+};
+
+const uint8 CRC_mg_au8CrcTable3[256] = 
+{
+0x00, 0x16, 0x2c, 0x3a, 0x58, 0x4e, 0x74, 0x62,
+0xb0, 0xa6, 0x9c, 0x8a, 0xe8, 0xfe, 0xc4, 0xd2,
+0x67, 0x71, 0x4b, 0x5d, 0x3f, 0x29, 0x13, 0x05,
+0xd7, 0xc1, 0xfb, 0xed, 0x8f, 0x99, 0xa3, 0xb5,
+0xce, 0xd8, 0xe2, 0xf4, 0x96, 0x80, 0xba, 0xac,
+0x7e, 0x68, 0x52, 0x44, 0x26, 0x30, 0x0a, 0x1c,
+0xa9, 0xbf, 0x85, 0x93, 0xf1, 0xe7, 0xdd, 0xcb,
+0x19, 0x0f, 0x35, 0x23, 0x41, 0x57, 0x6d, 0x7b,
+0x9b, 0x8d, 0xb7, 0xa1, 0xc3, 0xd5, 0xef, 0xf9,
+0x2b, 0x3d, 0x07, 0x11, 0x73, 0x65, 0x5f, 0x49,
+0xfc, 0xea, 0xd0, 0xc6, 0xa4, 0xb2, 0x88, 0x9e,
+0x4c, 0x5a, 0x60, 0x76, 0x14, 0x02, 0x38, 0x2e,
+0x55, 0x43, 0x79, 0x6f, 0x0d, 0x1b, 0x21, 0x37,
+0xe5, 0xf3, 0xc9, 0xdf, 0xbd, 0xab, 0x91, 0x87,
+0x32, 0x24, 0x1e, 0x08, 0x6a, 0x7c, 0x46, 0x50,
+0x82, 0x94, 0xae, 0xb8, 0xda, 0xcc, 0xf6, 0xe0,
+0x31, 0x27, 0x1d, 0x0b, 0x69, 0x7f, 0x45, 0x53,
+0x81, 0x97, 0xad, 0xbb, 0xd9, 0xcf, 0xf5, 0xe3,
+0x56, 0x40, 0x7a, 0x6c, 0x0e, 0x18, 0x22, 0x34,
+0xe6, 0xf0, 0xca, 0xdc, 0xbe, 0xa8, 0x92, 0x84,
+0xff, 0xe9, 0xd3, 0xc5, 0xa7, 0xb1, 0x8b, 0x9d,
+0x4f, 0x59, 0x63, 0x75, 0x17, 0x01, 0x3b, 0x2d,
+0x98, 0x8e, 0xb4, 0xa2, 0xc0, 0xd6, 0xec, 0xfa,
+0x28, 0x3e, 0x04, 0x12, 0x70, 0x66, 0x5c, 0x4a,
+0xaa, 0xbc, 0x86, 0x90, 0xf2, 0xe4, 0xde, 0xc8,
+0x1a, 0x0c, 0x36, 0x20, 0x42, 0x54, 0x6e, 0x78,
+0xcd, 0xdb, 0xe1, 0xf7, 0x95, 0x83, 0xb9, 0xaf,
+0x7d, 0x6b, 0x51, 0x47, 0x25, 0x33, 0x09, 0x1f,
+0x64, 0x72, 0x48, 0x5e, 0x3c, 0x2a, 0x10, 0x06,
+0xd4, 0xc2, 0xf8, 0xee, 0x8c, 0x9a, 0xa0, 0xb6,
+0x03, 0x15, 0x2f, 0x39, 0x5b, 0x4d, 0x77, 0x61,
+0xb3, 0xa5, 0x9f, 0x89, 0xeb, 0xfd, 0xc7, 0xd1
+};
+#endif
 #endif
 #endif
 
@@ -114,6 +226,117 @@ const uint16 CRC_mg_au16crc16tab[256] =
    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
 };
+
+#if MG_CRC16_SLICE_BY_4
+/* Slice-by-4 tables, CRC_mg_au16crc16tabN[i] = (tabN-1[i] >> 8) ^ CRC_mg_au16crc16tab[tabN-1[i] & 0xff] */
+const uint16 CRC_mg_au16crc16tab1[256] = 
+{
+   0x0000, 0x9001, 0x6001, 0xF000, 0xC002, 0x5003, 0xA003, 0x3002,
+   0xC007, 0x5006, 0xA006, 0x3007, 0x0005, 0x9004, 0x6004, 0xF005,
+   0xC00D, 0x500C, 0xA00C, 0x300D, 0x000F, 0x900E, 0x600E, 0xF00F,
+   0x000A, 0x900B, 0x600B, 0xF00A, 0xC008, 0x5009, 0xA009, 0x3008,
+   0xC019, 0x5018, 0xA018, 0x3019, 0x001B, 0x901A, 0x601A, 0xF01B,
+   0x001E, 0x901F, 0x601F, 0xF01E, 0xC01C, 0x501D, 0xA01D, 0x301C,
+   0x0014, 0x9015, 0x6015, 0xF014, 0xC016, 0x5017, 0xA017, 0x3016,
+   0xC013, 0x5012, 0xA012, 0x3013, 0x0011, 0x9010, 0x6010, 0xF011,
+   0xC031, 0x5030, 0xA030, 0x3031, 0x0033, 0x9032, 0x6032, 0xF033,
+   0x0036, 0x9037, 0x6037, 0xF036, 0xC034, 0x5035, 0xA035, 0x3034,
+   0x003C, 0x903D, 0x603D, 0xF03C, 0xC03E, 0x503F, 0xA03F, 0x303E,
+   0xC03B, 0x503A, 0xA03A, 0x303B, 0x0039, 0x9038, 0x6038, 0xF039,
+   0x0028, 0x9029, 0x6029, 0xF028, 0xC02A, 0x502B, 0xA02B, 0x302A,
+   0xC02F, 0x502E, 0xA02E, 0x302F, 0x002D, 0x902C, 0x602C, 0xF02D,
+   0xC025, 0x5024, 0xA024, 0x3025, 0x0027, 0x9026, 0x6026, 0xF027,
+   0x0022, 0x9023, 0x6023, 0xF022, 0xC020, 0x5021, 0xA021, 0x3020,
+   0xC061, 0x5060, 0xA060, 0x3061, 0x0063, 0x9062, 0x6062, 0xF063,
+   0x0066, 0x9067, 0x6067, 0xF066, 0xC064, 0x5065, 0xA065, 0x3064,
+   0x006C, 0x906D, 0x606D, 0xF06C, 0xC06E, 0x506F, 0xA06F, 0x306E,
+   0xC06B, 0x506A, 0xA06A, 0x306B, 0x0069, 0x9068, 0x6068, 0xF069,
+   0x0078, 0x9079, 0x6079, 0xF078, 0xC07A, 0x507B, 0xA07B, 0x307A,
+   0xC07F, 0x507E, 0xA07E, 0x307F, 0x007D, 0x907C, 0x607C, 0xF07D,
+   0xC075, 0x5074, 0xA074, 0x3075, 0x0077, 0x9076, 0x6076, 0xF077,
+   0x0072, 0x9073, 0x6073, 0xF072, 0xC070, 0x5071, 0xA071, 0x3070,
+   0x0050, 0x9051, 0x6051, 0xF050, 0xC052, 0x5053, 0xA053, 0x3052,
+   0xC057, 0x5056, 0xA056, 0x3057, 0x0055, 0x9054, 0x6054, 0xF055,
+   0xC05D, 0x505C, 0xA05C, 0x305D, 0x005F, 0x905E, 0x605E, 0xF05F,
+   0x005A, 0x905B, 0x605B, 0xF05A, 0xC058, 0x5059, 0xA059, 0x3058,
+   0xC049, 0x5048, 0xA048, 0x3049, 0x004B, 0x904A, 0x604A, 0xF04B,
+   0x004E, 0x904F, 0x604F, 0xF04E, 0xC04C, 0x504D, 0xA04D, 0x304C,
+   0x0044, 0x9045, 0x6045, 0xF044, 0xC046, 0x5047, 0xA047, 0x3046,
+   0xC043, 0x5042, 0xA042, 0x3043, 0x0041, 0x9040, 0x6040, 0xF041
+};
+
+const uint16 CRC_mg_au16crc16tab2[256] = 
+{
+   0x0000, 0xC051, 0xC0A1, 0x00F0, 0xC141, 0x0110, 0x01E0, 0xC1B1,
+   0xC281, 0x02D0, 0x0220, 0xC271, 0x03C0, 0xC391, 0xC361, 0x0330,
+   0xC501, 0x0550, 0x05A0, 0xC5F1, 0x0440, 0xC411, 0xC4E1, 0x04B0,
+   0x0780, 0xC7D1, 0xC721, 0x0770, 0xC6C1, 0x0690, 0x0660, 0xC631,
+   0xCA01, 0x0A50, 0x0AA0, 0xCAF1, 0x0B40, 0xCB11, 0xCBE1, 0x0BB0,
+   0x0880, 0xC8D1, 0xC821, 0x0870, 0xC9C1, 0x0990, 0x0960, 0xC931,
+   0x0F00, 0xCF51, 0xCFA1, 0x0FF0, 0xCE41, 0x0E10, 0x0EE0, 0xCEB1,
+   0xCD81, 0x0DD0, 0x0D20, 0xCD71, 0x0CC0, 0xCC91, 0xCC61, 0x0C30,
+   0xD401, 0x1450, 0x14A0, 0xD4F1, 0x1540, 0xD511, 0xD5E1, 0x15B0,
+   0x1680, 0xD6D1, 0xD621, 0x1670, 0xD7C1, 0x1790, 0x1760, 0xD731,
+   0x1100, 0xD151, 0xD1A1, 0x11F0, 0xD041, 0x1010, 0x10E0, 0xD0B1,
+   0xD381, 0x13D0, 0x1320, 0xD371, 0x12C0, 0xD291, 0xD261, 0x1230,
+   0x1E00, 0xDE51, 0xDEA1, 0x1EF0, 0xDF41, 0x1F10, 0x1FE0, 0xDFB1,
+   0xDC81, 0x1CD0, 0x1C20, 0xDC71, 0x1DC0, 0xDD91, 0xDD61, 0x1D30,
+   0xDB01, 0x1B50, 0x1BA0, 0xDBF1, 0x1A40, 0xDA11, 0xDAE1, 0x1AB0,
+   0x1980, 0xD9D1, 0xD921, 0x1970, 0xD8C1, 0x1890, 0x1860, 0xD831,
+   0xE801, 0x2850, 0x28A0, 0xE8F1, 0x2940, 0xE911, 0xE9E1, 0x29B0,
+   0x2A80, 0xEAD1, 0xEA21, 0x2A70, 0xEBC1, 0x2B90, 0x2B60, 0xEB31,
+   0x2D00, 0xED51, 0xEDA1, 0x2DF0, 0xEC41, 0x2C10, 0x2CE0, 0xECB1,
+   0xEF81, 0x2FD0, 0x2F20, 0xEF71, 0x2EC0, 0xEE91, 0xEE61, 0x2E30,
+   0x2200, 0xE251, 0xE2A1, 0x22F0, 0xE341, 0x2310, 0x23E0, 0xE3B1,
+   0xE081, 0x20D0, 0x2020, 0xE071, 0x21C0, 0xE191, 0xE161, 0x2130,
+   0xE701, 0x2750, 0x27A0, 0xE7F1, 0x2640, 0xE611, 0xE6E1, 0x26B0,
+   0x2580, 0xE5D1, 0xE521, 0x2570, 0xE4C1, 0x2490, 0x2460, 0xE431,
+   0x3C00, 0xFC51, 0xFCA1, 0x3CF0, 0xFD41, 0x3D10, 0x3DE0, 0xFDB1,
+   0xFE81, 0x3ED0, 0x3E20, 0xFE71, 0x3FC0, 0xFF91, 0xFF61, 0x3F30,
+   0xF901, 0x3950, 0x39A0, 0xF9F1, 0x3840, 0xF811, 0xF8E1, 0x38B0,
+   0x3B80, 0xFBD1, 0xFB21, 0x3B70, 0xFAC1, 0x3A90, 0x3A60, 0xFA31,
+   0xF601, 0x3650, 0x36A0, 0xF6F1, 0x3740, 0xF711, 0xF7E1, 0x37B0,
+   0x3480, 0xF4D1, 0xF421, 0x3470, 0xF5C1, 0x3590, 0x3560, 0xF531,
+   0x3300, 0xF351, 0xF3A1, 0x33F0, 0xF241, 0x3210, 0x32E0, 0xF2B1,
+   0xF181, 0x31D0, 0x3120, 0xF171, 0x30C0, 0xF091, 0xF061, 0x3030
+};
+
+const uint16 CRC_mg_au16crc16tab3[256] = 
+{
+   0x0000, 0xFC01, 0xB801, 0x4400, 0x3001, 0xCC00, 0x8800, 0x7401,
+   0x6002, 0x9C03, 0xD803, 0x2402, 0x5003, 0xAC02, 0xE802, 0x1403,
+   0xC004, 0x3C05, 0x7805, 0x8404, 0xF005, 0x0C04, 0x4804, 0xB405,
+   0xA006, 0x5C07, 0x1807, 0xE406, 0x9007, 0x6C06, 0x2806, 0xD407,
+   0xC00B, 0x3C0A, 0x780A, 0x840B, 0xF00A, 0x0C0B, 0x480B, 0xB40A,
+   0xA009, 0x5C08, 0x1808, 0xE409, 0x9008, 0x6C09, 0x2809, 0xD408,
+   0x000F, 0xFC0E, 0xB80E, 0x440F, 0x300E, 0xCC0F, 0x880F, 0x740E,
+   0x600D, 0x9C0C, 0xD80C, 0x240D, 0x500C, 0xAC0D, 0xE80D, 0x140C,
+   0xC015, 0x3C14, 0x7814, 0x8415, 0xF014, 0x0C15, 0x4815, 0xB414,
+   0xA017, 0x5C16, 0x1816, 0xE417, 0x9016, 0x6C17, 0x2817, 0xD416,
+   0x0011, 0xFC10, 0xB810, 0x4411, 0x3010, 0xCC11, 0x8811, 0x7410,
+   0x6013, 0x9C12, 0xD812, 0x2413, 0x5012, 0xAC13, 0xE813, 0x1412,
+   0x001E, 0xFC1F, 0xB81F, 0x441E, 0x301F, 0xCC1E, 0x881E, 0x741F,
+   0x601C, 0x9C1D, 0xD81D, 0x241C, 0x501D, 0xAC1C, 0xE81C, 0x141D,
+   0xC01A, 0x3C1B, 0x781B, 0x841A, 0xF01B, 0x0C1A, 0x481A, 0xB41B,
+   0xA018, 0x5C19, 0x1819, 0xE418, 0x9019, 0x6C18, 0x2818, 0xD419,
+   0xC029, 0x3C28, 0x7828, 0x8429, 0xF028, 0x0C29, 0x4829, 0xB428,
+   0xA02B, 0x5C2A, 0x182A, 0xE42B, 0x902A, 0x6C2B, 0x282B, 0xD42A,
+   0x002D, 0xFC2C, 0xB82C, 0x442D, 0x302C, 0xCC2D, 0x882D, 0x742C,
+   0x602F, 0x9C2E, 0xD82E, 0x242F, 0x502E, 0xAC2F, 0xE82F, 0x142E,
+   0x0022, 0xFC23, 0xB823, 0x4422, 0x3023, 0xCC22, 0x8822, 0x7423,
+   0x6020, 0x9C21, 0xD821, 0x2420, 0x5021, 0xAC20, 0xE820, 0x1421,
+   0xC026, 0x3C27, 0x7827, 0x8426, 0xF027, 0x0C26, 0x4826, 0xB427,
+   0xA024, 0x5C25, 0x1825, 0xE424, 0x9025, 0x6C24, 0x2824, 0xD425,
+   0x003C, 0xFC3D, 0xB83D, 0x443C, 0x303D, 0xCC3C, 0x883C, 0x743D,
+   0x603E, 0x9C3F, 0xD83F, 0x243E, 0x503F, 0xAC3E, 0xE83E, 0x143F,
+   0xC038, 0x3C39, 0x7839, 0x8438, 0xF039, 0x0C38, 0x4838, 0xB439,
+   0xA03A, 0x5C3B, 0x183B, 0xE43A, 0x903B, 0x6C3A, 0x283A, 0xD43B,
+   0xC037, 0x3C36, 0x7836, 0x8437, 0xF036, 0x0C37, 0x4837, 0xB436,
+   0xA035, 0x5C34, 0x1834, 0xE435, 0x9034, 0x6C35, 0x2835, 0xD434,
+   0x0033, 0xFC32, 0xB832, 0x4433, 0x3032, 0xCC33, 0x8833, 0x7432,
+   0x6031, 0x9C30, 0xD830, 0x2431, 0x5030, 0xAC31, 0xE831, 0x1430
+};
+#endif
 #endif
 #endif
 
@@ -141,7 +364,16 @@ const uint16 CRC_mg_au16crc16tab[256] =
  ***************************************************************************** */
 void CRC_vInit(void)
 {
-
+  #if MG_CRC16_HW
+  /* CRC unit as reflected CRC16 0x8005 (= 0xA001 of the table), the start
+   * value is loaded per block by CRC_u16GetCrc16Blk() */
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+  CRC_DeInit();
+  CRC_PolynomialSizeSelect(CRC_PolSize_16);
+  CRC_SetPolynomial(MG_CRC16_HW_POLY);
+  CRC_ReverseInputDataSelect(CRC_ReverseInputData_8bits);
+  CRC_ReverseOutputDataCmd(ENABLE);
+  #endif
 }
 
 /** *****************************************************************************
@@ -156,7 +388,10 @@ void CRC_vInit(void)
  ***************************************************************************** */
 void CRC_vDeInit(void)
 {
-
+  #if MG_CRC16_HW
+  CRC_DeInit();
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, DISABLE);
+  #endif
 }
 
 /** *****************************************************************************
@@ -249,6 +484,119 @@ uint16 CRC_u16GetCrc16(uint16 u16InCrc, uint8 u8InData)
 #endif
 
 
+/** *****************************************************************************
+ * \brief         Calculate crc8 over a block of data, same polynomial and result
+ *                as calling CRC_u8GetCrc8() for every byte
+ *
+ * \param[in]     u8InCrc   start value (seed or crc of the previous block)
+ *                pu8Data   data for crc calculation
+ *                u32Len    number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        uint8
+ *
+ *******************************************************************************/
+#if MG_CRC8_USED
+uint8 CRC_u8GetCrc8Blk(uint8 u8InCrc, const uint8 *pu8Data, uint32 u32Len)
+{
+  uint8 u8Crc;
+
+  u8Crc = u8InCrc;
+  #if MG_CRC8_LOOKUP_TABLE
+  #if MG_CRC8_SLICE_BY_4
+  while (u32Len >= 4)
+  {
+    u8Crc = CRC_mg_au8CrcTable3[u8Crc ^ pu8Data[0]] ^
+            CRC_mg_au8CrcTable2[pu8Data[1]] ^
+            CRC_mg_au8CrcTable1[pu8Data[2]] ^
+            CRC_mg_au8CrcTable[pu8Data[3]];
+    pu8Data += 4;
+    u32Len  -= 4;
+  }
+  #endif
+  while (u32Len > 0)
+  {
+    u8Crc = CRC_mg_au8CrcTable[u8Crc ^ *pu8Data++];
+    u32Len--;
+  }
+  #else
+  while (u32Len > 0)
+  {
+    u8Crc = CRC_u8GetCrc8(u8Crc, *pu8Data++);
+    u32Len--;
+  }
+  #endif
+  return u8Crc;
+} /* CRC_u8GetCrc8Blk() */
+#endif
+
+/** *****************************************************************************
+ * \brief         Calculate crc16 (polynomial value 0xA001) over a block of data,
+ *                same result as calling CRC_u16GetCrc16() for every byte.
+ *                With MG_CRC16_HW by the CRC unit, which is not reentrant: only
+ *                call from one interrupt level (scheduler).
+ *
+ * \param[in]     u16InCrc  start value (seed or crc of the previous block)
+ *                pu8Data   data for crc calculation
+ *                u32Len    number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        uint16
+ *
+ *******************************************************************************/
+#if MG_CRC16_USED
+uint16 CRC_u16GetCrc16Blk(uint16 u16InCrc, const uint8 *pu8Data, uint32 u32Len)
+{
+  uint16 u16Crc;
+  #if MG_CRC16_LOOKUP_TABLE && MG_CRC16_SLICE_BY_4
+  uint32 u32Word;
+  #endif
+
+  u16Crc = u16InCrc;
+  #if MG_CRC16_HW
+  /* Reflected algorithm: the unit holds the bit reversed crc */
+  CRC_SetInitRegister(__RBIT((uint32)u16Crc) >> 16);
+  CRC_ResetDR();
+  while (u32Len > 0)
+  {
+    *(__IO uint8 *)(&CRC->DR) = *pu8Data++;
+    u32Len--;
+  }
+  u16Crc = (uint16)CRC->DR;
+  #elif MG_CRC16_LOOKUP_TABLE
+  #if MG_CRC16_SLICE_BY_4
+  while (u32Len >= 4)
+  {
+    /* Byte loads, the data may be unaligned */
+    u32Word = ((uint32)pu8Data[0]         | ((uint32)pu8Data[1] << 8) |
+               ((uint32)pu8Data[2] << 16) | ((uint32)pu8Data[3] << 24)) ^ u16Crc;
+    u16Crc = CRC_mg_au16crc16tab3[u32Word & 0xff] ^
+             CRC_mg_au16crc16tab2[(u32Word >> 8) & 0xff] ^
+             CRC_mg_au16crc16tab1[(u32Word >> 16) & 0xff] ^
+             CRC_mg_au16crc16tab[u32Word >> 24];
+    pu8Data += 4;
+    u32Len  -= 4;
+  }
+  #endif
+  while (u32Len > 0)
+  {
+    u16Crc = CRC_mg_au16crc16tab[(u16Crc ^ *pu8Data++) & 0xff] ^ (u16Crc >> 8);
+    u32Len--;
+  }
+  #else
+  while (u32Len > 0)
+  {
+    u16Crc = CRC_u16GetCrc16(u16Crc, *pu8Data++);
+    u32Len--;
+  }
+  #endif
+  return u16Crc;
+} /* CRC_u16GetCrc16Blk() */
+#endif
+
+
 /*
  * End of file
  */
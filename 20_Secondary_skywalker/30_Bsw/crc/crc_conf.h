@@ -37,6 +37,16 @@
 #define MG_CRC16_LOOKUP_TABLE   1
 #define MG_CRC16_USED           1
 
+/* Block functions: process 4 bytes per step with 3 more tables per polynomial
+ * (CRC8 768 bytes, CRC16 1536 bytes of flash) */
+#define MG_CRC8_SLICE_BY_4      0
+#define MG_CRC16_SLICE_BY_4     0
+
+/* CRC16 block function by the programmable CRC unit (F334), replaces the
+ * slice-by-4 tables */
+#define MG_CRC16_HW             1
+#define MG_CRC16_HW_POLY        0x8005u
+
 
 #ifdef __cplusplus
   }
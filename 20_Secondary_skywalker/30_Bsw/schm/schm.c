@@ -31,22 +31,122 @@
   #include "schm_rte.h"
   #include "schm_conf.h"
 
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+/* Levels of the scheduler, one per task period except the tick tasks */
+#define MG_LEVEL_NUM            ((uint8)(SCHM_CFG_E_PERIOD_COUNT - SCHM_CFG_E_PERIOD_1MS))
+
+/* Task slots: tick tasks, then the slots of the levels */
+#define MG_SLOT_TICK            ((uint8)0U)
+#define MG_SLOT_FIRST_LEVEL     ((uint8)1U)
+#define MG_SLOT_COUNT           ((uint8)(MG_SLOT_FIRST_LEVEL + SCHM_SLOT_NUM))
+
+#define MG_TASK_NUM             DIM(SCHM_mg_asTask)
+
+/* Slots of a task period */
+#define MG_PHASE_NUM(ePeriod)   (((ePeriod) == SCHM_CFG_E_PERIOD_TICK)  ? 1U :                 \
+                                 ((ePeriod) == SCHM_CFG_E_PERIOD_1MS)   ? SCHM_SLOT_1MS_NUM :  \
+                                 ((ePeriod) == SCHM_CFG_E_PERIOD_10MS)  ? SCHM_SLOT_10MS_NUM : \
+                                                                          SCHM_SLOT_100MS_NUM)
+
+/***************************************
+ * Build time check of the task table
+ **************************************/
+#define MG_TASK_ENTRY(A, B, pvTask, ePeriod, u8Phase, u16Wcet) \
+  { pvTask, (uint8)(ePeriod), (uint8)(u8Phase), (uint16)(u16Wcet) },
+
+/* Number of tasks whose phase is outside of their period */
+#define MG_TASK_BAD_PHASE(A, B, pvTask, ePeriod, u8Phase, u16Wcet) \
+  + (((u8Phase) >= MG_PHASE_NUM(ePeriod)) ? 1U : 0U)
+
+/* WCET budget sum of the tasks of one slot */
+#define MG_TASK_WCET(ePer, u8Ph, pvTask, ePeriod, u8Phase, u16Wcet) \
+  + ((((ePer) == (ePeriod)) && ((u8Ph) == (u8Phase))) ? (u16Wcet) : 0U)
+#define MG_SLOT_WCET(ePer, u8Ph) \
+  (0U SCHM_CFG_TASK_TABLE(MG_TASK_WCET, ePer, u8Ph))
+
+/* Tick tasks and the tasks of one slot fit into the tick */
+#define MG_SLOT_FITS(ePer, u8Ph) \
+  ((MG_SLOT_WCET(SCHM_CFG_E_PERIOD_TICK, 0U) + MG_SLOT_WCET(ePer, u8Ph)) <= MG_SCHM_TICK_US)
+#define MG_PERIOD_FITS(ePer) \
+  (MG_SLOT_FITS(ePer, 0U) && MG_SLOT_FITS(ePer, 1U) && MG_SLOT_FITS(ePer, 2U) && \
+   MG_SLOT_FITS(ePer, 3U) && MG_SLOT_FITS(ePer, 4U) && MG_SLOT_FITS(ePer, 5U) && \
+   MG_SLOT_FITS(ePer, 6U) && MG_SLOT_FITS(ePer, 7U) && MG_SLOT_FITS(ePer, 8U) && \
+   MG_SLOT_FITS(ePer, 9U))
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
 
 typedef struct
 {
-  uint8 u8CtrBase;
-  uint8 u8Ctr1ms;
-  uint8 u8Ctr10ms;
-} MG_S_FLOW_CTRL;
+  void (*pvTask)(void);
+  uint8  u8Period;     /* SCHM_CFG_E_PERIOD */
+  uint8  u8Phase;      /* Slot within the period */
+  uint16 u16WcetUs;    /* Run time budget (us) */
+} MG_S_TASK;
+
+/* Compilation fails here if the task table does not fit into the tick */
+typedef char MG_AC_CHECK_TASK_PHASE[((0U SCHM_CFG_TASK_TABLE(MG_TASK_BAD_PHASE, 0U, 0U)) == 0U) ? 1 : -1];
+typedef char MG_AC_CHECK_SLOT_BUDGET[(MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_1MS)  &&
+                                      MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_10MS) &&
+                                      MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_100MS)) ? 1 : -1];
+
+#if MG_SCHM_ISR_MON
+/* Timing of one ISR in counts of its trigger timer */
+typedef struct
+{
+  uint16 u16LatMin;    /* Start after the timer event */
+  uint16 u16LatMax;
+  uint16 u16ExecAvg;   /* Average of the last completed window */
+  uint16 u16ExecMax;
+  uint16 u16Overrun;
+  uint16 u16Cnt;
+  uint32 u32ExecSum;
+} MG_S_ISR_MON;
+#endif
 
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
 
-static MG_S_FLOW_CTRL   SCHM_mg_sFlowCtrl;
+static const MG_S_TASK SCHM_mg_asTask[] =
+{
+  SCHM_CFG_TASK_TABLE(MG_TASK_ENTRY, 0U, 0U)
+};
+
+/* Slots per level, the last slot of a level (but the slowest) runs the next level */
+static const uint8 SCHM_mg_au8LevelSlots[MG_LEVEL_NUM] =
+{
+  SCHM_SLOT_1MS_NUM + 1U,
+  SCHM_SLOT_10MS_NUM + 1U,
+  SCHM_SLOT_100MS_NUM
+};
+
+/* First task slot of each level */
+static const uint8 SCHM_mg_au8LevelFirstSlot[MG_LEVEL_NUM] =
+{
+  MG_SLOT_FIRST_LEVEL,
+  MG_SLOT_FIRST_LEVEL + SCHM_SLOT_1MS_NUM,
+  MG_SLOT_FIRST_LEVEL + SCHM_SLOT_1MS_NUM + SCHM_SLOT_10MS_NUM
+};
+
+static uint8   SCHM_mg_au8LevelCtr[MG_LEVEL_NUM];
+/* Tasks sorted by slot: tasks of slot n are SCHM_mg_au8TaskIdx[au8SlotFirst[n] .. au8SlotFirst[n + 1] - 1] */
+static uint8   SCHM_mg_au8TaskIdx[MG_TASK_NUM];
+static uint8   SCHM_mg_au8SlotFirst[MG_SLOT_COUNT + 1U];
+#if MG_SCHM_IDLE_SLEEP
+static uint32  SCHM_mg_u32IdleCnt;       /* Idle timer counts of the running window */
+static uint16  SCHM_mg_u16LoadTickCtr;
+static uint16  SCHM_mg_u16CpuLoad = 1000U;
+#endif
+#if MG_SCHM_ISR_MON
+/* Timer whose update event starts the ISR, TIM15 triggers the ADC of the LLC control */
+static const uint8 SCHM_mg_au8IsrMonTimer[SCHM_E_ISR_COUNT] = { MG_TIM17, MG_TIM15 };
+static MG_S_ISR_MON SCHM_mg_asIsrMon[SCHM_E_ISR_COUNT];
+#endif
 
 /*******************************************************************************
  * Local function prototypes (private to module)
@@ -54,6 +154,15 @@ static MG_S_FLOW_CTRL   SCHM_mg_sFlowCtrl;
 #if !MG_TIME_BASE_ISR
 void SCHM_vSchmRoutine(void);
 #endif
+static uint8 mg_u8TaskSlot(uint8 u8Task);
+static void mg_vBuildTaskIndex(void);
+static void mg_vRunSlot(uint8 u8Slot);
+#if MG_SCHM_IDLE_SLEEP
+static void mg_vUpdateCpuLoad(void);
+#endif
+#if MG_SCHM_ISR_MON
+static void mg_vIsrMonEnd(SCHM_E_ISR eIsr, uint16 u16StartCnt);
+#endif
 
 /*******************************************************************************
  * Global functions (public to other modules)
@@ -71,6 +180,18 @@ void SCHM_vSchmRoutine(void);
  ***************************************************************************** */
 void SCHM_vInit(void)
 {
+  #if MG_SCHM_ISR_MON
+  uint8 u8Isr;
+
+  for (u8Isr = 0U; u8Isr < (uint8)SCHM_E_ISR_COUNT; u8Isr++)
+  {
+    SCHM_mg_asIsrMon[u8Isr].u16LatMin = 0xFFFFU;
+  }
+  #endif
+
+  /* Sort the task table by slot */
+  mg_vBuildTaskIndex();
+
   /***************************************
    * Initialize MCAL modules
    **************************************/
@@ -167,6 +288,12 @@ void SCHM_vDeInit(void)
  ***************************************************************************** */
 void SCHM_vSchmIdleLoop(void)
 {
+  #if (MG_TIME_BASE_ISR && MG_SCHM_IDLE_SLEEP)
+  uint16 u16IdleStart;
+  uint16 u16IdleEnd;
+  uint16 u16Wrap;
+  #endif
+
   DEBUG_SECTION_PIN_DEBUG_RESET;
   /* Feed the watchdog */
   SCHM_scfg_vWdgFeed();
@@ -179,6 +306,33 @@ void SCHM_vSchmIdleLoop(void)
     {
       SCHM_vSchmRoutine();
     }
+  #elif MG_SCHM_IDLE_SLEEP
+    /* Sleep until the next interrupt, which runs after the idle time is taken */
+    SCHM_scfg_vDisableIrq();
+    if (0U == SCHM_scfg_u16TimerReadIrFlg(MG_TIM17))
+    {
+      u16IdleStart = SCHM_scfg_u16TimerReadCnt(MG_TIM17);
+      SCHM_scfg_vWaitForIrq();
+      u16Wrap = SCHM_scfg_u16TimerReadIrFlg(MG_TIM17);
+      u16IdleEnd = SCHM_scfg_u16TimerReadCnt(MG_TIM17);
+      /* Update event between the two reads: take the counter after the wrap */
+      if ((0U == u16Wrap) && (0U != SCHM_scfg_u16TimerReadIrFlg(MG_TIM17)))
+      {
+        u16Wrap = 1U;
+        u16IdleEnd = SCHM_scfg_u16TimerReadCnt(MG_TIM17);
+      }
+
+      /* The time base tick wakes up the CPU, so there is one wrap at most */
+      if (0U != u16Wrap)
+      {
+        SCHM_mg_u32IdleCnt += (uint32)SCHM_scfg_u16TimerReadPeriod(MG_TIM17) + 1U - u16IdleStart + u16IdleEnd;
+      }
+      else
+      {
+        SCHM_mg_u32IdleCnt += (uint32)u16IdleEnd - u16IdleStart;
+      }
+    }
+    SCHM_scfg_vEnableIrq();
   #endif
 }
 
@@ -198,186 +352,44 @@ void MG_VECT_TIME_BASE_ISR
 void SCHM_vSchmRoutine(void)
 #endif
 {
-  
+  #if MG_SCHM_ISR_MON
+  uint16 u16MonStartCnt = SCHM_scfg_u16TimerReadCnt(MG_TIM17);
+  #endif
+  uint8 u8Level = 0U;
+  uint8 u8Slot;
+
   DEBUG_SECTION_PIN_DEBUG_SET;
   /* Clear interrupt flag */
   SCHM_scfg_vTimerClrIrFlg(MG_TIM17);
-  /* Handle IIR filter for output */
-  SCHM_cfg_vLlcctrlIirRippleFlt();
-  /* LLC status update to avoid union issue */
-  SCHM_cfg_vLlcctrlStatusUpdate();
-  /* Read ADC buffer */
-  SCHM_cfg_vHwioReadAdcUnits();
-  /* Read ports */
-  SCHM_cfg_vHwioReadGpioPin();
-
-  /* Process 200uS tasks */
-  SCHM_cfg_vTmCtrlLlcCtrl();
-  SCHM_cfg_vMonCtrlOutFaultMon();
-  SCHM_cfg_vAcsctrlSyncCtrl();
-  SCHM_cfg_vLlcctrlLlHlAdjust();
-  SCHM_cfg_vMeterAvg();
-  SCHM_cfg_vUartPrtTxData();
-
-  /* Set ports */
-  SCHM_cfg_vHwioSetGpioPin();
-
-  /* Increase basic counter */
-  SCHM_mg_sFlowCtrl.u8CtrBase++;
-
-  /***********************************************
-   * 1ms task repetition
-   **********************************************/
-  switch (SCHM_mg_sFlowCtrl.u8CtrBase)
+
+  #if MG_SCHM_IDLE_SLEEP
+  mg_vUpdateCpuLoad();
+  #endif
+
+  /* Tasks of every tick */
+  mg_vRunSlot(MG_SLOT_TICK);
+
+  /* The last slot of a level passes the tick on to the next level */
+  while ((u8Level < (MG_LEVEL_NUM - 1U)) &&
+         (SCHM_mg_au8LevelCtr[u8Level] >= (SCHM_mg_au8LevelSlots[u8Level] - 1U)))
   {
-    case 1:
-    {
-      SCHM_cfg_vUartPrtHandleTxData();
-      break;
-    }
-    case 2:
-    {
-      SCHM_cfg_vTempCtrlNtcVoltAverage();
-      break;
-    }
-    case 3:
-    {
-      SCHM_cfg_vUartPrtHandleRxData();
-      break;
-    }
-    case 4:
-    {
-      SCHM_cfg_vUartPrtTmOutMon();
-      break;
-    }
-    case 5:
-    {
-      /* Reset basic counter */
-      SCHM_mg_sFlowCtrl.u8CtrBase = 0U;
-      /* Increase 1ms counter */
-      SCHM_mg_sFlowCtrl.u8Ctr1ms++;
-    
-      /***********************************************
-       * 10ms task repetition
-       **********************************************/
-      switch(SCHM_mg_sFlowCtrl.u8Ctr1ms)
-      {
-        case 1:
-        {
-          break;
-        }
-        case 2:
-        {
-          break;
-        }
-        case 3:
-        {
-          break;
-        }
-        case 4:
-        {
-          break;
-        }
-        case 5:
-        {
-          break;
-        }
-        case 6:
-        {
-          break;
-        }
-        case 7:
-        {
-          break;
-        }
-        case 8:
-        {
-          break;
-        }
-        case 9:
-        {
-          break;
-        }
-        case 10:
-        {
-          /* Reset 1ms counter */
-          SCHM_mg_sFlowCtrl.u8Ctr1ms = 0U;
-          /* Increase 10ms counter */
-          SCHM_mg_sFlowCtrl.u8Ctr10ms++;
-        
-          /***********************************************
-           * 100ms task repetition
-           **********************************************/
-          switch(SCHM_mg_sFlowCtrl.u8Ctr10ms)
-          {
-            case 1:
-            {
-              break;
-            }
-            case 2:
-            {
-              break;
-            }
-            case 3:
-            {
-              SCHM_cfg_vTempCtrlNtcOtMonitor();
-              break;
-            }
-            case 4:
-            {
-              break;
-            }
-            case 5:
-            {
-              break;
-            }
-            case 6:
-            {
-              break;
-            }
-            case 7:
-            {
-              break;
-            }
-            case 8:
-            {
-              break;
-            }
-            case 9:
-            {
-              break;
-            }
-            case 10:
-            {
-              /* Reset 10ms counter */
-              SCHM_mg_sFlowCtrl.u8Ctr10ms = 0U;
-              break;
-            }
-            default:
-            {
-              /* Reset 10ms counter */
-              SCHM_mg_sFlowCtrl.u8Ctr10ms = 0U;
-              break;
-            }
-          } /* switch(10ms) */
-          break;
-        }
-        default:
-        {
-          /* Reset 1ms counter */
-          SCHM_mg_sFlowCtrl.u8Ctr1ms = 0U;
-          break;
-        }
-      } /* switch(1ms) */
-      break;
-    }
-    default:
-    {
-      /* Reset basic counter */
-      SCHM_mg_sFlowCtrl.u8CtrBase = 0U;
-      break;
-    }
+    SCHM_mg_au8LevelCtr[u8Level] = 0U;
+    u8Level++;
   }
+
+  u8Slot = SCHM_mg_au8LevelFirstSlot[u8Level] + SCHM_mg_au8LevelCtr[u8Level];
+  SCHM_mg_au8LevelCtr[u8Level]++;
+  if (SCHM_mg_au8LevelCtr[u8Level] >= SCHM_mg_au8LevelSlots[u8Level])
+  {
+    /* Slowest level wraps around */
+    SCHM_mg_au8LevelCtr[u8Level] = 0U;
+  }
+
+  mg_vRunSlot(u8Slot);
+
+  #if MG_SCHM_ISR_MON
+  mg_vIsrMonEnd(SCHM_E_ISR_TIME_BASE, u16MonStartCnt);
+  #endif
 }
 
 /** *****************************************************************************
@@ -402,6 +414,13 @@ void SCHM_vSchmRoutine(void)
 __attribute__((section ("ccram")))  /* Load ISR into CCRAM for max processing speed */
 void MG_VECT_LLC_CTRL_ISR
 {
+  #if MG_SCHM_ISR_MON
+  uint16 u16MonStartCnt = SCHM_scfg_u16TimerReadCnt(MG_TIM15);
+
+  /* The TIM15 update flag is not used otherwise, it marks the next ADC trigger */
+  SCHM_scfg_vTimerClrIrFlg(MG_TIM15);
+  #endif
+
   /* Timing measurement by debug pin */
   DEBUG_SECTION_PIN_DEBUG_SET;
 
@@ -413,6 +432,10 @@ void MG_VECT_LLC_CTRL_ISR
 
   /* Call the interrupt A routine */
   SCHM_cfg_vLlcCtrlIsr();
+
+  #if MG_SCHM_ISR_MON
+  mg_vIsrMonEnd(SCHM_E_ISR_LLC_CTRL, u16MonStartCnt);
+  #endif
 }
 
 /** *****************************************************************************
@@ -442,6 +465,278 @@ void MG_VECT_USART2_ISR
   SCHM_cfg_vUsart2IrqHandler();
 }
 
+/** *****************************************************************************
+ * \brief         CPU load of the last 1s window. Time not spent sleeping in
+ *                the idle loop counts as busy, 1000 if the load is not measured.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        CPU load (0.1%)
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetCpuLoad(void)
+{
+  #if MG_SCHM_IDLE_SLEEP
+  return SCHM_mg_u16CpuLoad;
+  #else
+  return 1000U;
+  #endif
+}
+
+/** *****************************************************************************
+ * \brief         Read one value of the ISR timing monitor. Jitter and maximum
+ *                are kept since reset.
+ *
+ * \param[in]     eIsr:  monitored ISR
+ * \param[in]     eItem: value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Time in 0.1us or overrun counter, 0 if not monitored
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetIsrMon(SCHM_E_ISR eIsr, SCHM_E_ISR_MON eItem)
+{
+  uint32 u32Val = 0U;
+  #if MG_SCHM_ISR_MON
+  MG_S_ISR_MON *psMon;
+  uint32 u32CntPerUs;
+
+  if (eIsr < SCHM_E_ISR_COUNT)
+  {
+    psMon = &SCHM_mg_asIsrMon[eIsr];
+    switch (eItem)
+    {
+      case SCHM_E_ISR_MON_JITTER:
+      {
+        if (psMon->u16LatMax >= psMon->u16LatMin)
+        {
+          u32Val = (uint32)psMon->u16LatMax - psMon->u16LatMin;
+        }
+        break;
+      }
+      case SCHM_E_ISR_MON_EXEC_AVG:
+      {
+        /* Running average until the first window is completed */
+        if ((0U == psMon->u16ExecAvg) && (0U != psMon->u16Cnt))
+        {
+          u32Val = psMon->u32ExecSum / psMon->u16Cnt;
+        }
+        else
+        {
+          u32Val = psMon->u16ExecAvg;
+        }
+        break;
+      }
+      case SCHM_E_ISR_MON_EXEC_MAX:
+      {
+        u32Val = psMon->u16ExecMax;
+        break;
+      }
+      case SCHM_E_ISR_MON_OVERRUN:
+      {
+        return psMon->u16Overrun;
+      }
+      default:
+      {
+        break;
+      }
+    }
+    /* Timer counts to 0.1us */
+    u32CntPerUs = SCHM_scfg_u32TimerReadClk(SCHM_mg_au8IsrMonTimer[eIsr]) / 1000000U;
+    u32Val = (u32Val * 10U) / MAX(u32CntPerUs, 1U);
+  }
+  #endif
+  return (uint16)MIN(u32Val, 0xFFFFU);
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Task slot of a task table entry
+ *
+ * \param[in]     u8Task: index in the task table
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Task slot
+ *
+ ***************************************************************************** */
+static uint8 mg_u8TaskSlot(uint8 u8Task)
+{
+  const MG_S_TASK *psTask = &SCHM_mg_asTask[u8Task];
+
+  if (SCHM_CFG_E_PERIOD_TICK == psTask->u8Period)
+  {
+    return MG_SLOT_TICK;
+  }
+  return (SCHM_mg_au8LevelFirstSlot[psTask->u8Period - SCHM_CFG_E_PERIOD_1MS] + psTask->u8Phase);
+}
+
+/** *****************************************************************************
+ * \brief         Sort the task table by slot, keeping the table order within a
+ *                slot
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vBuildTaskIndex(void)
+{
+  uint8 au8Next[MG_SLOT_COUNT];
+  uint8 u8Slot;
+  uint8 u8Task;
+
+  for (u8Slot = 0U; u8Slot <= MG_SLOT_COUNT; u8Slot++)
+  {
+    SCHM_mg_au8SlotFirst[u8Slot] = 0U;
+  }
+  for (u8Slot = 0U; u8Slot < MG_LEVEL_NUM; u8Slot++)
+  {
+    SCHM_mg_au8LevelCtr[u8Slot] = 0U;
+  }
+
+  /* Count the tasks per slot */
+  for (u8Task = 0U; u8Task < MG_TASK_NUM; u8Task++)
+  {
+    SCHM_mg_au8SlotFirst[mg_u8TaskSlot(u8Task) + 1U]++;
+  }
+  for (u8Slot = 0U; u8Slot < MG_SLOT_COUNT; u8Slot++)
+  {
+    SCHM_mg_au8SlotFirst[u8Slot + 1U] += SCHM_mg_au8SlotFirst[u8Slot];
+    au8Next[u8Slot] = SCHM_mg_au8SlotFirst[u8Slot];
+  }
+
+  for (u8Task = 0U; u8Task < MG_TASK_NUM; u8Task++)
+  {
+    u8Slot = mg_u8TaskSlot(u8Task);
+    SCHM_mg_au8TaskIdx[au8Next[u8Slot]++] = u8Task;
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Run the tasks of a slot
+ *
+ * \param[in]     u8Slot: task slot
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vRunSlot(uint8 u8Slot)
+{
+  uint8 u8Idx;
+
+  for (u8Idx = SCHM_mg_au8SlotFirst[u8Slot]; u8Idx < SCHM_mg_au8SlotFirst[u8Slot + 1U]; u8Idx++)
+  {
+    SCHM_mg_asTask[SCHM_mg_au8TaskIdx[u8Idx]].pvTask();
+  }
+}
+
+#if MG_SCHM_ISR_MON
+/** *****************************************************************************
+ * \brief         Record start latency, execution time and overrun of an ISR
+ *                at its end
+ *
+ * \param[in]     eIsr:        monitored ISR
+ * \param[in]     u16StartCnt: trigger timer counter at the ISR entry
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+__attribute__((section ("ccram")))
+static void mg_vIsrMonEnd(SCHM_E_ISR eIsr, uint16 u16StartCnt)
+{
+  MG_S_ISR_MON *psMon = &SCHM_mg_asIsrMon[eIsr];
+  uint8  u8TimerId = SCHM_mg_au8IsrMonTimer[eIsr];
+  uint16 u16Overrun = SCHM_scfg_u16TimerReadIrFlg(u8TimerId);
+  uint16 u16EndCnt = SCHM_scfg_u16TimerReadCnt(u8TimerId);
+  uint32 u32Exec;
+
+  /* Update event between the two reads: take the counter after the wrap */
+  if ((0U == u16Overrun) && (0U != SCHM_scfg_u16TimerReadIrFlg(u8TimerId)))
+  {
+    u16Overrun = 1U;
+    u16EndCnt = SCHM_scfg_u16TimerReadCnt(u8TimerId);
+  }
+
+  if (0U != u16Overrun)
+  {
+    /* Next timer event before the end, the ISR missed its deadline */
+    u32Exec = (uint32)SCHM_scfg_u16TimerReadPeriod(u8TimerId) + 1U - u16StartCnt + u16EndCnt;
+    if (psMon->u16Overrun < 0xFFFFU)
+    {
+      psMon->u16Overrun++;
+    }
+  }
+  else
+  {
+    u32Exec = (uint32)u16EndCnt - u16StartCnt;
+  }
+  u32Exec = MIN(u32Exec, 0xFFFFU);
+
+  if (u16StartCnt < psMon->u16LatMin)
+  {
+    psMon->u16LatMin = u16StartCnt;
+  }
+  if (u16StartCnt > psMon->u16LatMax)
+  {
+    psMon->u16LatMax = u16StartCnt;
+  }
+  if ((uint16)u32Exec > psMon->u16ExecMax)
+  {
+    psMon->u16ExecMax = (uint16)u32Exec;
+  }
+
+  psMon->u32ExecSum += u32Exec;
+  psMon->u16Cnt++;
+  if (psMon->u16Cnt >= (1U << MG_SCHM_ISR_MON_AVG_SHIFT))
+  {
+    psMon->u16ExecAvg = (uint16)(psMon->u32ExecSum >> MG_SCHM_ISR_MON_AVG_SHIFT);
+    psMon->u32ExecSum = 0U;
+    psMon->u16Cnt = 0U;
+  }
+}
+#endif
+
+#if MG_SCHM_IDLE_SLEEP
+/** *****************************************************************************
+ * \brief         Close the CPU load window every MG_SCHM_LOAD_WINDOW_TICKS
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vUpdateCpuLoad(void)
+{
+  uint32 u32CntPerPermille;
+  uint32 u32IdlePermille;
+
+  SCHM_mg_u16LoadTickCtr++;
+  if (SCHM_mg_u16LoadTickCtr >= MG_SCHM_LOAD_WINDOW_TICKS)
+  {
+    u32CntPerPermille = ((uint32)MG_SCHM_LOAD_WINDOW_TICKS * ((uint32)SCHM_scfg_u16TimerReadPeriod(MG_TIM17) + 1U)) / 1000U;
+    u32IdlePermille = SCHM_mg_u32IdleCnt / MAX(u32CntPerPermille, 1U);
+    SCHM_mg_u16CpuLoad = (uint16)(1000U - MIN(u32IdlePermille, 1000U));
+    SCHM_mg_u32IdleCnt = 0U;
+    SCHM_mg_u16LoadTickCtr = 0U;
+  }
+}
+#endif
+
 /** *****************************************************************************
  * \brief         Error or fault processing
  *
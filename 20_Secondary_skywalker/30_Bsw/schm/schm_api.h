@@ -27,6 +27,66 @@
 
 #include "global.h"
 
+/*******************************************************************************
+ * Global constants and macros (public to other modules)
+ ******************************************************************************/
+
+/* Scheduler slots (phases) per task period, one slot runs per tick */
+#define SCHM_SLOT_1MS_NUM               4u      /* 200us slots, 5th tick runs the 10ms slots */
+#define SCHM_SLOT_10MS_NUM              9u      /* 1ms slots, 10th runs the 100ms slots */
+#define SCHM_SLOT_100MS_NUM             10u     /* 10ms slots */
+#define SCHM_SLOT_NUM                   (SCHM_SLOT_1MS_NUM + SCHM_SLOT_10MS_NUM + SCHM_SLOT_100MS_NUM)
+
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+/* Monitored interrupt service routines */
+typedef enum SCHM_E_ISR_
+{
+  SCHM_E_ISR_TIME_BASE = 0,  /* 200us scheduler routine, TIM17 update */
+  SCHM_E_ISR_LLC_CTRL,       /* LLC control, ADC DMA of the TIM15 trigger */
+  SCHM_E_ISR_COUNT
+} SCHM_E_ISR;
+
+typedef enum SCHM_E_ISR_MON_
+{
+  SCHM_E_ISR_MON_JITTER = 0, /* Spread of the start after the timer event (0.1us) */
+  SCHM_E_ISR_MON_EXEC_AVG,   /* Average execution time incl. preemption (0.1us) */
+  SCHM_E_ISR_MON_EXEC_MAX,   /* Maximum execution time incl. preemption (0.1us) */
+  SCHM_E_ISR_MON_OVERRUN,    /* Runs that ended after the next timer event */
+  SCHM_E_ISR_MON_COUNT
+} SCHM_E_ISR_MON;
+
+/*******************************************************************************
+ * Global function prototypes (public to other modules)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Read one value of the ISR timing monitor
+ *
+ * \param[in]     eIsr:  monitored ISR
+ * \param[in]     eItem: value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Time in 0.1us or overrun counter, 0 if not monitored
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetIsrMon(SCHM_E_ISR eIsr, SCHM_E_ISR_MON eItem);
+
+/** *****************************************************************************
+ * \brief         CPU load of the last 1s window, busy time / total time
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        CPU load (0.1%)
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetCpuLoad(void);
+
 
 #ifdef __cplusplus
   }
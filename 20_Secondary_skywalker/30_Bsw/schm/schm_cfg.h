@@ -424,6 +424,48 @@ inline void SCHM_cfg_vTempCtrlNtcOtMonitor(void)
   #endif
 }
 
+/*******************************************************************************
+ * Task table
+ ******************************************************************************/
+
+/* Task periods, one scheduler level each */
+typedef enum SCHM_CFG_E_PERIOD_
+{
+  SCHM_CFG_E_PERIOD_TICK = 0,   /* Every 200us tick, phase 0 */
+  SCHM_CFG_E_PERIOD_1MS,        /* Phase 0..3 = 200us slot within the 1ms */
+  SCHM_CFG_E_PERIOD_10MS,       /* Phase 0..8 = 1ms slot within the 10ms */
+  SCHM_CFG_E_PERIOD_100MS,      /* Phase 0..9 = 10ms slot within the 100ms */
+  SCHM_CFG_E_PERIOD_COUNT
+} SCHM_CFG_E_PERIOD;
+
+/*
+ * Tasks of the time base ISR. Tasks of the same period and phase run in the
+ * listed order. The WCET budget (us) is checked at build time: the tick tasks
+ * plus the tasks of any slot must fit into one tick. The budget does not
+ * include the LLC control ISR which preempts the time base.
+ *
+ * TASK(A, B, task, period, phase, WCET budget)
+ */
+#define SCHM_CFG_TASK_TABLE(TASK, A, B) \
+  TASK(A, B, SCHM_cfg_vLlcctrlIirRippleFlt,      SCHM_CFG_E_PERIOD_TICK,  0u,  8u) \
+  TASK(A, B, SCHM_cfg_vLlcctrlStatusUpdate,      SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_cfg_vHwioReadAdcUnits,         SCHM_CFG_E_PERIOD_TICK,  0u, 15u) \
+  TASK(A, B, SCHM_cfg_vHwioReadGpioPin,          SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_cfg_vTmCtrlLlcCtrl,            SCHM_CFG_E_PERIOD_TICK,  0u, 25u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlOutFaultMon,       SCHM_CFG_E_PERIOD_TICK,  0u, 15u) \
+  TASK(A, B, SCHM_cfg_vAcsctrlSyncCtrl,          SCHM_CFG_E_PERIOD_TICK,  0u, 10u) \
+  TASK(A, B, SCHM_cfg_vLlcctrlLlHlAdjust,        SCHM_CFG_E_PERIOD_TICK,  0u,  8u) \
+  TASK(A, B, SCHM_cfg_vMeterAvg,                 SCHM_CFG_E_PERIOD_TICK,  0u, 10u) \
+  TASK(A, B, SCHM_cfg_vUartPrtTxData,            SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_cfg_vHwioSetGpioPin,           SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  \
+  TASK(A, B, SCHM_cfg_vUartPrtHandleTxData,      SCHM_CFG_E_PERIOD_1MS,   0u, 20u) \
+  TASK(A, B, SCHM_cfg_vTempCtrlNtcVoltAverage,   SCHM_CFG_E_PERIOD_1MS,   1u, 15u) \
+  TASK(A, B, SCHM_cfg_vUartPrtHandleRxData,      SCHM_CFG_E_PERIOD_1MS,   2u, 30u) \
+  TASK(A, B, SCHM_cfg_vUartPrtTmOutMon,          SCHM_CFG_E_PERIOD_1MS,   3u,  5u) \
+  \
+  TASK(A, B, SCHM_cfg_vTempCtrlNtcOtMonitor,     SCHM_CFG_E_PERIOD_100MS, 2u, 20u)
+
 
 #ifdef __cplusplus
   }
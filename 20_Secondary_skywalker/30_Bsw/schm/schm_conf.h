@@ -33,6 +33,19 @@
 
 #define MG_TIME_BASE_ISR                1       /* 1 = Time base routine as ISR */
 #define MG_TIME_BASE_PERIOD_US          200     /* (uS) */
+#define MG_SCHM_TICK_US                 MG_TIME_BASE_PERIOD_US   /* (uS) scheduler tick */
+
+/***************************************
+ * Idle sleep and CPU load
+ **************************************/
+#define MG_SCHM_IDLE_SLEEP              1       /* 1 = Sleep (WFI) in the idle loop and measure the CPU load */
+#define MG_SCHM_LOAD_WINDOW_TICKS       ((uint16)(1000000u / MG_TIME_BASE_PERIOD_US))   /* 1s window */
+
+/***************************************
+ * ISR timing monitor
+ **************************************/
+#define MG_SCHM_ISR_MON                 1       /* 1 = Monitor jitter, execution time and overruns of the control ISRs */
+#define MG_SCHM_ISR_MON_AVG_SHIFT       8u      /* Average over 2^8 runs */
 
 #define MG_HRTIMER_ISR_FREQ             60000   /* (Hz) */
 #define MG_U32_nS_HRTIMER_ISR_PERIOD    (uint32)(F64_ONE_BY_NANO / MG_HRTIMER_ISR_FREQ)
@@ -173,6 +173,33 @@ inline uint16 SCHM_scfg_u16TimerReadIrFlg(uint8 u8TimerId)
   #endif
 }
 
+inline uint16 SCHM_scfg_u16TimerReadCnt(uint8 u8TimerId)
+{
+  #if MG_TIMER_MODULE
+  return TIMER_u16TimerReadCnt(u8TimerId);
+  #else
+  return 0U;
+  #endif
+}
+
+inline uint16 SCHM_scfg_u16TimerReadPeriod(uint8 u8TimerId)
+{
+  #if MG_TIMER_MODULE
+  return TIMER_u16TimerReadPeriod(u8TimerId);
+  #else
+  return 0U;
+  #endif
+}
+
+inline uint32 SCHM_scfg_u32TimerReadClk(uint8 u8TimerId)
+{
+  #if MG_TIMER_MODULE
+  return TIMER_u32TimerReadClk(u8TimerId);
+  #else
+  return 0U;
+  #endif
+}
+
 inline void SCHM_scfg_vTimerSetPeriod(uint8 u8TimerId, uint16 u16usTimerPeriod)
 {
   #if MG_TIMER_MODULE
@@ -388,6 +415,22 @@ inline void SCHM_scfg_vFlashDeInit(void)
   #endif
 }
 
+/* Core section */
+inline void SCHM_scfg_vDisableIrq(void)
+{
+  __disable_irq();
+}
+
+inline void SCHM_scfg_vEnableIrq(void)
+{
+  __enable_irq();
+}
+
+inline void SCHM_scfg_vWaitForIrq(void)
+{
+  __WFI();
+}
+
 
 #ifdef __cplusplus
   }
@@ -184,6 +184,99 @@ uint16 TIMER_u16TimerReadIrFlg(uint8 u8TimerId)
   return u16TimerIrFlg;
 }
 
+/** *****************************************************************************
+ * \brief         Read timer counter
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter value
+ *
+ ***************************************************************************** */
+uint16 TIMER_u16TimerReadCnt(uint8 u8TimerId)
+{
+  uint16 u16TimerCnt = 0U;
+  /* TIM15 */
+  if (u8TimerId == MG_TIM15)
+  {
+    u16TimerCnt = (uint16)TIM15->CNT;
+  }
+  /* TIM16 */
+  if (u8TimerId == MG_TIM16)
+  {
+    u16TimerCnt = (uint16)TIM16->CNT;
+  }
+  /* TIM17 */
+  if (u8TimerId == MG_TIM17)
+  {
+    u16TimerCnt = (uint16)TIM17->CNT;
+  }
+  return u16TimerCnt;
+}
+
+/** *****************************************************************************
+ * \brief         Read timer period (auto reload value)
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Period in timer counts minus one
+ *
+ ***************************************************************************** */
+uint16 TIMER_u16TimerReadPeriod(uint8 u8TimerId)
+{
+  uint16 u16TimerPeriod = 0U;
+  /* TIM15 */
+  if (u8TimerId == MG_TIM15)
+  {
+    u16TimerPeriod = (uint16)MG_REG_TIMER15_PERIOD;
+  }
+  /* TIM16 */
+  if (u8TimerId == MG_TIM16)
+  {
+    u16TimerPeriod = (uint16)MG_REG_TIMER16_PERIOD;
+  }
+  /* TIM17 */
+  if (u8TimerId == MG_TIM17)
+  {
+    u16TimerPeriod = (uint16)MG_REG_TIMER17_PERIOD;
+  }
+  return u16TimerPeriod;
+}
+
+/** *****************************************************************************
+ * \brief         Read timer counter clock
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter clock in Hz
+ *
+ ***************************************************************************** */
+uint32 TIMER_u32TimerReadClk(uint8 u8TimerId)
+{
+  uint32 u32HzTimerClk = 0U;
+  /* TIM15 */
+  if (u8TimerId == MG_TIM15)
+  {
+    u32HzTimerClk = mg_u32HzTimer15Clk;
+  }
+  /* TIM16 */
+  if (u8TimerId == MG_TIM16)
+  {
+    u32HzTimerClk = mg_u32HzTimer16Clk;
+  }
+  /* TIM17 */
+  if (u8TimerId == MG_TIM17)
+  {
+    u32HzTimerClk = mg_u32HzTimer17Clk;
+  }
+  return u32HzTimerClk;
+}
+
 /** *****************************************************************************
  * \brief         Set timer NVIC configuration
  *
@@ -81,6 +81,42 @@ void TIMER_vTimerClrIrFlg(uint8 u8TimerId);
  ***************************************************************************** */
 uint16 TIMER_u16TimerReadIrFlg(uint8 u8TimerId);
 
+/** *****************************************************************************
+ * \brief         Read timer counter
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter value
+ *
+ ***************************************************************************** */
+uint16 TIMER_u16TimerReadCnt(uint8 u8TimerId);
+
+/** *****************************************************************************
+ * \brief         Read timer period (auto reload value)
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Period in timer counts minus one
+ *
+ ***************************************************************************** */
+uint16 TIMER_u16TimerReadPeriod(uint8 u8TimerId);
+
+/** *****************************************************************************
+ * \brief         Read timer counter clock
+ *
+ * \param[in]     TimerId: can be 15 to 17
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter clock in Hz
+ *
+ ***************************************************************************** */
+uint32 TIMER_u32TimerReadClk(uint8 u8TimerId);
+
 /** *****************************************************************************
  * \brief         Set timer NVIC configuration
  *
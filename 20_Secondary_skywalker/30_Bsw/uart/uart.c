@@ -37,6 +37,12 @@
  ******************************************************************************/
 
 static void mg_vUartHwInit(void);
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static uint16 mg_u16RxDmaSize;
   
 /*******************************************************************************
  * Global functions (public to other modules)
@@ -114,6 +120,103 @@ void UART_vUartNvicCfg(uint8 u8UartId, uint8 u8PrePriority, uint8 u8SubPriority)
   NVIC_Init(&NVIC_InitCfg);
 }
 
+/** *****************************************************************************
+ * \brief         Send a frame by DMA, the buffer has to stay unchanged until
+ *                UART_u16ReadTxDmaCnt() returns 0
+ *
+ * \param[in]     pu8Data - frame
+ *                u16Len  - number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartTxDma(const uint8 *pu8Data, uint16 u16Len)
+{
+  DMA_Cmd(MG_TX_DMA_CH, DISABLE);
+  MG_TX_DMA_CH->CMAR = (uint32)pu8Data;
+  DMA_SetCurrDataCounter(MG_TX_DMA_CH, u16Len);
+  USART2->ICR = USART_ICR_TCCF;   /* TC of the last frame */
+  DMA_Cmd(MG_TX_DMA_CH, ENABLE);
+}
+
+/** *****************************************************************************
+ * \brief         Bytes of the TX frame not written to the data register yet.
+ *                At 0 the line is idle with UART_u8UartReadTxEmptyFlg().
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadTxDmaCnt(void)
+{
+  return DMA_GetCurrDataCounter(MG_TX_DMA_CH);
+}
+
+/** *****************************************************************************
+ * \brief         Receive the next frame by DMA into the buffer, the frame ends
+ *                with the idle line interrupt
+ *
+ * \param[in]     u16Size - buffer size, more bytes of a frame are lost
+ * \param[in,out] -
+ * \param[out]    pu8Buf  - buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartRxDma(uint8 *pu8Buf, uint16 u16Size)
+{
+  DMA_Cmd(MG_RX_DMA_CH, DISABLE);
+  (void)MG_RX_DATA_REG;   /* Byte received while stopped */
+  USART2->ICR = USART_ICR_ORECF | USART_ICR_IDLECF;
+  MG_RX_DMA_CH->CMAR = (uint32)pu8Buf;
+  DMA_SetCurrDataCounter(MG_RX_DMA_CH, u16Size);
+  mg_u16RxDmaSize = u16Size;
+  DMA_Cmd(MG_RX_DMA_CH, ENABLE);
+}
+
+/** *****************************************************************************
+ * \brief         Bytes of the running RX frame written to the buffer
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadRxDmaCnt(void)
+{
+  return mg_u16RxDmaSize - DMA_GetCurrDataCounter(MG_RX_DMA_CH);
+}
+
+/** *****************************************************************************
+ * \brief         Stop the RX DMA, the buffer is not written any more
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes received, 0 if stopped already
+ *
+ ***************************************************************************** */
+__attribute__((section ("ccram")))
+uint16 UART_u16StopRxDma(void)
+{
+  uint16 u16Cnt = 0U;
+
+  if (0U != (MG_RX_DMA_CH->CCR & DMA_CCR_EN))
+  {
+    DMA_Cmd(MG_RX_DMA_CH, DISABLE);
+    u16Cnt = mg_u16RxDmaSize - DMA_GetCurrDataCounter(MG_RX_DMA_CH);
+  }
+  return u16Cnt;
+}
+
 /*******************************************************************************
  * Local functions (privat for module)
  ******************************************************************************/
@@ -133,9 +236,11 @@ static void mg_vUartHwInit(void)
 {
   /* Initialize UART */
   USART_InitTypeDef     USART_InitStructure;
+  DMA_InitTypeDef       DMA_InitCfg;
 
-  /* Enable USART clock */
+  /* Enable USART and DMA clock */
   RCC_APB1PeriphClockCmd(RCC_APB1Periph_USART2, ENABLE);
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
 
   /* USARTx configuration
    * USARTx configured as follow:
@@ -155,10 +260,35 @@ static void mg_vUartHwInit(void)
 
   /* USART configuration */
   USART_Init(USART2, &USART_InitStructure);
+
+  /* TX and RX data by DMA, a frame at a time. The memory address and the size
+   * are set per frame by UART_vStartTxDma() / UART_vStartRxDma() */
+  DMA_DeInit(MG_TX_DMA_CH);
+  DMA_InitCfg.DMA_PeripheralBaseAddr = (uint32)&MG_TX_DATA_REG;
+  DMA_InitCfg.DMA_MemoryBaseAddr = 0U;
+  DMA_InitCfg.DMA_DIR = DMA_DIR_PeripheralDST;
+  DMA_InitCfg.DMA_BufferSize = 0U;
+  DMA_InitCfg.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  DMA_InitCfg.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitCfg.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+  DMA_InitCfg.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+  DMA_InitCfg.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitCfg.DMA_Priority = DMA_Priority_Low;
+  DMA_InitCfg.DMA_M2M = DMA_M2M_Disable;
+  DMA_Init(MG_TX_DMA_CH, &DMA_InitCfg);
+
+  DMA_DeInit(MG_RX_DMA_CH);
+  DMA_InitCfg.DMA_PeripheralBaseAddr = (uint32)&MG_RX_DATA_REG;
+  DMA_InitCfg.DMA_DIR = DMA_DIR_PeripheralSRC;
+  DMA_InitCfg.DMA_Priority = DMA_Priority_Medium;
+  DMA_Init(MG_RX_DMA_CH, &DMA_InitCfg);
+
+  USART_DMACmd(USART2, USART_DMAReq_Tx | USART_DMAReq_Rx, ENABLE);
+
   /* Enable USART */
   USART_Cmd(USART2, ENABLE);
-  /* Enable the USART1 Interrupt */
-  USART_ITConfig(USART2, USART_IT_RXNE, ENABLE);
+  /* Enable the USART2 idle line interrupt, the end of a RX frame */
+  USART_ITConfig(USART2, USART_IT_IDLE, ENABLE);
 }
 
 /*
@@ -109,6 +109,75 @@ extern inline uint16 UART_u16UartReadBaudrate(void)
   return MG_BAUDRATE;
 }
 
+__attribute__((section ("ccram")))
+extern inline void UART_vUartClrIdleFlg(void)
+{
+  MG_RX_IDLE_FLG_CLR;
+}
+
+/** *****************************************************************************
+ * \brief         Send a frame by DMA, the buffer has to stay unchanged until
+ *                UART_u16ReadTxDmaCnt() returns 0
+ *
+ * \param[in]     pu8Data - frame
+ *                u16Len  - number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartTxDma(const uint8 *pu8Data, uint16 u16Len);
+
+/** *****************************************************************************
+ * \brief         Bytes of the TX frame not written to the data register yet
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadTxDmaCnt(void);
+
+/** *****************************************************************************
+ * \brief         Receive the next frame by DMA into the buffer, the frame ends
+ *                with the idle line interrupt
+ *
+ * \param[in]     u16Size - buffer size
+ * \param[in,out] -
+ * \param[out]    pu8Buf  - buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartRxDma(uint8 *pu8Buf, uint16 u16Size);
+
+/** *****************************************************************************
+ * \brief         Bytes of the running RX frame written to the buffer
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadRxDmaCnt(void);
+
+/** *****************************************************************************
+ * \brief         Stop the RX DMA
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes received, 0 if stopped already
+ *
+ ***************************************************************************** */
+uint16 UART_u16StopRxDma(void);
+
 
 #ifdef __cplusplus
   }
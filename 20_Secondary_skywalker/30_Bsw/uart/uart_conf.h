@@ -43,6 +43,13 @@
 #define MG_TX_DATA_REG              USART2->TDR                    /* Tx register */
 #define MG_TX_CMPLT_FLG_RD          (USART2->ISR & USART_ISR_TC)   /* Tx shift register empty */
 #define MG_RX_DATA_RDY_FLG_RD       ((USART2->ISR & USART_ISR_RXNE) == USART_ISR_RXNE) /* Rx interrupt flag */
+#define MG_RX_IDLE_FLG_CLR          (USART2->ICR = USART_ICR_IDLECF) /* Idle line after a frame */
+
+/***********************************************
+ * DMA of the TX and RX data register
+ **********************************************/
+#define MG_TX_DMA_CH                DMA1_Channel7                  /* USART2_TX */
+#define MG_RX_DMA_CH                DMA1_Channel6                  /* USART2_RX */
 
 #define MG_UART1        1
 #define MG_UART2        2
@@ -55,13 +55,14 @@ typedef union MG_U_UARTPRT_CTRL_
 {
   struct
   {
-    uint8 u8RxByteTmOutEna   : 1;   /* bit0 */
+    uint8 u8Reserved0        : 1;   /* bit0 */
     uint8 u8ByteTmoutFlg     : 1;   /* bit1 */
     uint8 u8TxBufUpdated     : 1;   /* bit2 */
     uint8 u8RxNewFrame       : 1;   /* bit3 */
     uint8 u8UartStaClrFlg    : 1;   /* bit4 */
     uint8 u8AddrMatch        : 1;   /* bit5 */
-    uint8 u8Reserved         : 2;   /* bit6~7 */
+    uint8 u8AddrChecked      : 1;   /* bit6 */
+    uint8 u8Reserved         : 1;   /* bit7 */
   } Bit;
   uint8 ALL;
 } MG_U_UARTPRT_CTRL; 
@@ -69,11 +70,8 @@ typedef union MG_U_UARTPRT_CTRL_
 typedef struct MG_S_UARTPRT_DATA_
 {
   uint16 u16TxDataCnt;
-  uint16 u16RxDataCnt;
-  uint16 u16RxByteTmOutCnt;
   uint16 u16TxDataNbr;
   uint16 u16RxDataNbr;
-  uint16 u16RxCrc;
   uint8  u8SlaveAddr;
   MG_U_UARTPRT_STATUS uStatus;
   MG_U_UARTPRT_CTRL   uCtrl;
@@ -85,7 +83,6 @@ typedef struct MG_S_UARTPRT_DATA_
 
 static MG_S_UARTPRT_DATA UARTPRT_mg_uUartPrtData;
 
-static uint8 UARTPRT_mg_u8RxTimeOutDly;
 static uint8 UARTPRT_mg_au8UartTxBuf[MG_TX_BUF_SIZE];
 uint8 UARTPRT_mg_au8UartRxBuf[MG_RX_BUF_SIZE];
 
@@ -109,36 +106,15 @@ uint8 UARTPRT_mg_au8UartRxBuf[MG_RX_BUF_SIZE];
  ***************************************************************************** */
 void UARTPRT_vInit(void)
 {
-  uint16 u16BaudRate;
   uint16 u16GpioRead = 0U;
   uint16 u16GpioReadCtr = 0U;
 
   UARTPRT_mg_uUartPrtData.u16TxDataCnt = 0U;
-  UARTPRT_mg_uUartPrtData.u16RxDataCnt = 0U;
   UARTPRT_mg_uUartPrtData.u16TxDataNbr = 0U;
   UARTPRT_mg_uUartPrtData.u16RxDataNbr = 0U;  
-  UARTPRT_mg_uUartPrtData.u16RxCrc = CRC_INIT_02;
   UARTPRT_mg_uUartPrtData.uStatus.ALL = 0U;
   UARTPRT_mg_uUartPrtData.uCtrl.ALL = 0U;
 
-  u16BaudRate = UARTPRT_scfg_u16UartReadBaudrate();
-
-  if (MG_BAUDRATE_4800 == u16BaudRate)
-  {
-    UARTPRT_mg_u8RxTimeOutDly = MG_RX_BYTE_TIMEOUT_4800;
-    UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt = UARTPRT_mg_u8RxTimeOutDly;
-  }
-  else if (MG_BAUDRATE_38400 == u16BaudRate)
-  {
-    UARTPRT_mg_u8RxTimeOutDly = MG_RX_BYTE_TIMEOUT_38400;
-    UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt = UARTPRT_mg_u8RxTimeOutDly;
-  }
-  else
-  {
-    UARTPRT_mg_u8RxTimeOutDly = MG_RX_BYTE_TIMEOUT_38400;
-    UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt = UARTPRT_mg_u8RxTimeOutDly;
-  }
-
   /* Average the address GPIO reading */
   for (u16GpioReadCtr = 0U; u16GpioReadCtr <= MG_ADDR_DETECT_CTR; u16GpioReadCtr++)
   {
@@ -165,6 +141,9 @@ void UARTPRT_vInit(void)
     UARTPRT_mg_uUartPrtData.u8SlaveAddr = MG_ADDR_SEC_1;
   }
 #endif
+
+  /* Receive the first frame */
+  UARTPRT_scfg_vUartStartRxDma(UARTPRT_mg_au8UartRxBuf, MG_RX_BUF_SIZE);
 }
 
 /** *****************************************************************************
@@ -194,7 +173,21 @@ void UARTPRT_vDeInit(void)
  ***************************************************************************** */
 void UARTPRT_vHandleTxData(void)
 {
+  GLOBAL_WORD_VAL u16TxCrc;
+
 #if (TRUE == MG_TX_ONCE_RX_ADDR)
+  /* The address is in the RX buffer once the DMA has received 2 bytes */
+  if ((FALSE == UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrChecked) &&
+      (2U <= UARTPRT_scfg_u16UartReadRxDmaCnt()))
+  {
+    UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrChecked = TRUE;
+    if ((MG_FRAME_STX == UARTPRT_mg_au8UartRxBuf[0]) &&
+        (UARTPRT_mg_uUartPrtData.u8SlaveAddr == UARTPRT_mg_au8UartRxBuf[1]))
+    {
+      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrMatch = TRUE; /* Begin to TX once receive local address */
+    }
+  }
+
   /* Slaver begins to TX when RX local address rather than RX whole frame */
   if (UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrMatch)    /* COM TX to Local MCU */
 #else
@@ -216,11 +209,12 @@ void UARTPRT_vHandleTxData(void)
 
       UARTPRT_cfg_vIntComTxData(UARTPRT_mg_au8UartTxBuf, &UARTPRT_mg_uUartPrtData.u16TxDataNbr); /* Load application data to TX buffer */
 
-      /* Calculate crc when TX data byte, add dummy crc here */
-      UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataNbr++] = CRC_INIT_02; /* dummy CRC16 */
-      UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataNbr++] = CRC_INIT_02; /* dummy CRC16 */
-      
-      UARTPRT_mg_au8UartTxBuf[2] = UARTPRT_mg_uUartPrtData.u16TxDataNbr - MG_FRAME_AUX_LEN; /* Fill LEN in TX buffer */
+      UARTPRT_mg_au8UartTxBuf[2] = UARTPRT_mg_uUartPrtData.u16TxDataNbr + 2U - MG_FRAME_AUX_LEN; /* Fill LEN in TX buffer */
+
+      /* Calculate crc16 of the whole frame in one go */
+      u16TxCrc.u16Val = UARTPRT_scfg_u16GetCrc16Blk(CRC_INIT_02, UARTPRT_mg_au8UartTxBuf, UARTPRT_mg_uUartPrtData.u16TxDataNbr);
+      UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataNbr++] = u16TxCrc.Bytes.LB; /* CRC16 */
+      UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataNbr++] = u16TxCrc.Bytes.HB; /* CRC16 */
       
       UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8TxBufUpdated = TRUE; /* Begin to TX */
     }
@@ -268,7 +262,7 @@ void UARTPRT_vHandleRxData(void)
     }   
     else
     {
-      if (UARTPRT_mg_uUartPrtData.u16RxCrc) /* Check frame crc16 */
+      if (0U != UARTPRT_scfg_u16GetCrc16Blk(CRC_INIT_02, UARTPRT_mg_au8UartRxBuf, UARTPRT_mg_uUartPrtData.u16RxDataNbr)) /* Check frame crc16 */
       {
         UARTPRT_mg_uUartPrtData.uStatus.Bit.u8CrcErr = TRUE;
       }
@@ -277,9 +271,6 @@ void UARTPRT_vHandleRxData(void)
         u8FrameCheckOk = TRUE;
       }
     }
-    /* Check frame end */
-    UARTPRT_mg_uUartPrtData.u16RxCrc = CRC_INIT_02;
-    UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame = FALSE; /* Begin to fill TX buffer */
   }
 
   /* Frame format is correct, Handle data */
@@ -309,10 +300,19 @@ void UARTPRT_vHandleRxData(void)
     }
     UARTPRT_cfg_vIntComRxData(UARTPRT_mg_au8UartRxBuf, u8BroadcastFlg, MG_UART_STATUS_BYTE_CTR); /* Handle application data */
   }
+
+  /* Check frame end, the RX buffer is free for the next frame */
+  if (UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame)
+  {
+    UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame = FALSE; /* Begin to fill TX buffer */
+    UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrChecked = FALSE;
+    UARTPRT_scfg_vUartStartRxDma(UARTPRT_mg_au8UartRxBuf, MG_RX_BUF_SIZE);
+  }
 }
 
 /** *****************************************************************************
- * \brief         TX data by UART
+ * \brief         TX data by UART, the frame is sent by DMA and its end is
+ *                polled here
  *                Note: should be implemented in <= 1ms routine
  *
  * \param[in]     -
@@ -324,43 +324,26 @@ void UARTPRT_vHandleRxData(void)
  ***************************************************************************** */
 void UARTPRT_vTxData(void)
 { 
-  static uint16 u16Crc = CRC_INIT_02;
-  static GLOBAL_WORD_VAL u16CrcTemp;
-  
   if (UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8TxBufUpdated) /* Txbuf array is updated */
   {
-    if (UARTPRT_scfg_u8UartReadTxEmptyFlg()) /* Last data TX is complete */
+    if (0U == UARTPRT_mg_uUartPrtData.u16TxDataCnt) /* Frame not started */
     {
-      if (UARTPRT_mg_uUartPrtData.u16TxDataCnt < UARTPRT_mg_uUartPrtData.u16TxDataNbr)
-      {
-        if (UARTPRT_mg_uUartPrtData.u16TxDataCnt == UARTPRT_mg_uUartPrtData.u16TxDataNbr - 2U)
-        {
-          u16CrcTemp.u16Val = u16Crc;
-          UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataCnt] = u16CrcTemp.Bytes.LB; /* Add real crc16 into TxBuf */
-        }
-        else if (UARTPRT_mg_uUartPrtData.u16TxDataCnt == UARTPRT_mg_uUartPrtData.u16TxDataNbr - 1U)
-        {
-          UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataCnt] = u16CrcTemp.Bytes.HB; /* Add real crc16 into TxBuf */
-        }        
-        else
-        {
-          u16Crc = CRC_u16GetCrc16(u16Crc, UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataCnt]);
-        }
-        UARTPRT_scfg_vUartWriteTxReg(UARTPRT_mg_au8UartTxBuf[UARTPRT_mg_uUartPrtData.u16TxDataCnt++]);
-      }
-      else /* A frame Tx complete */
-      {
-        u16Crc = CRC_INIT_02; /* Reset crc for next frame */
-        UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8TxBufUpdated = FALSE; /* Tx array can be updated again */
-        UARTPRT_mg_uUartPrtData.u16TxDataCnt = 0U;
-      }
+      UARTPRT_scfg_vUartStartTxDma(UARTPRT_mg_au8UartTxBuf, UARTPRT_mg_uUartPrtData.u16TxDataNbr);
+      UARTPRT_mg_uUartPrtData.u16TxDataCnt = UARTPRT_mg_uUartPrtData.u16TxDataNbr;
+    }
+    else if ((0U == UARTPRT_scfg_u16UartReadTxDmaCnt()) &&
+             (UARTPRT_scfg_u8UartReadTxEmptyFlg())) /* A frame Tx complete */
+    {
+      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8TxBufUpdated = FALSE; /* Tx array can be updated again */
+      UARTPRT_mg_uUartPrtData.u16TxDataCnt = 0U;
     }
   }
 }
 
 /** *****************************************************************************
- * \brief         RX data by UART
- *
+ * \brief         RX frame by UART, called by the idle line interrupt: the RX
+ *                DMA has written the frame to the RX buffer and the line is
+ *                quiet for one byte time
  *
  * \param[in]     -
  * \param[in,out] -
@@ -371,40 +354,20 @@ void UARTPRT_vTxData(void)
  ***************************************************************************** */
 void UARTPRT_vUsart2IrqHandler(void)
 {
-  uint8 u8Dummy;
+  uint16 u16RxCnt;
 
-  u8Dummy = UARTPRT_scfg_u8UartReadRxReg(); /* Read RX REG */   
-  UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxByteTmOutEna = FALSE; /* Stop timer */
+  UARTPRT_scfg_vUartClrIdleFlg();
+  u16RxCnt = UARTPRT_scfg_u16UartStopRxDma(); /* 0 if stopped already */
 
   if (!(UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame)) /* Last frame has been handled */
   {
-    UARTPRT_mg_au8UartRxBuf[UARTPRT_mg_uUartPrtData.u16RxDataCnt++] = u8Dummy; /* RX data */
-    UARTPRT_mg_uUartPrtData.u16RxCrc = UARTPRT_scfg_u16GetCrc16(UARTPRT_mg_uUartPrtData.u16RxCrc, u8Dummy);
-
-#if (TRUE == MG_TX_ONCE_RX_ADDR)
-    if (2U == UARTPRT_mg_uUartPrtData.u16RxDataCnt)
-    {
-      if ((MG_FRAME_STX == UARTPRT_mg_au8UartRxBuf[0]) &&
-          (UARTPRT_mg_uUartPrtData.u8SlaveAddr == UARTPRT_mg_au8UartRxBuf[1]))
-      {
-        UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8AddrMatch = TRUE; /* Begin to TX once receive local address */
-      }
-    }
-#endif
-
-    if (UARTPRT_mg_uUartPrtData.u16RxDataCnt < MG_RX_BUF_SIZE)
-    {
-      /* Begin to monitor rx byte timeout */
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxByteTmOutEna = TRUE;
-      UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt = UARTPRT_mg_u8RxTimeOutDly;
-    }
-    else /* Rx buffer if full, begin to handle frame */
+    if (0U != u16RxCnt)
     {
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxByteTmOutEna = FALSE;
-      UARTPRT_mg_uUartPrtData.u16RxDataNbr = UARTPRT_mg_uUartPrtData.u16RxDataCnt;
-      UARTPRT_mg_uUartPrtData.u16RxDataCnt = 0U;
+      /* Idle line, new frame is received */
+      UARTPRT_mg_uUartPrtData.uStatus.Bit.u8ByteTmout = TRUE; /* note: this is not a fault condition */
+      UARTPRT_mg_uUartPrtData.u16RxDataNbr = u16RxCnt;
       UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8ByteTmoutFlg = TRUE;
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame = TRUE;
+      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame = TRUE; /* Begin to handle data in RX buffer */
     }
   }
   else /* Tx too fast, Rx buffer has not been handled */
@@ -412,8 +375,10 @@ void UARTPRT_vUsart2IrqHandler(void)
     UARTPRT_mg_uUartPrtData.uStatus.Bit.u8InvalidData = TRUE;
   }
 }
+
 /** *****************************************************************************
- * \brief         Monitor UART1 timeout
+ * \brief         Monitor UART timeout. The RX frame ends with the idle line
+ *                interrupt, no timer is left.
  *
  *
  * \param[in]     -
@@ -425,26 +390,7 @@ void UARTPRT_vUsart2IrqHandler(void)
  ***************************************************************************** */
 void UARTPRT_vTmOutMon(void)
 {
-  /* Byte timeout timer */
-  if (TRUE == UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxByteTmOutEna)
-  {
-    if (0U < UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt)
-    {
-      UARTPRT_mg_uUartPrtData.u16RxByteTmOutCnt--;
-    }
-    else
-    {
-      /* Timeout, stop timer */
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxByteTmOutEna = FALSE;
 
-      /* Byte timeout, new frame is received */
-      UARTPRT_mg_uUartPrtData.uStatus.Bit.u8ByteTmout = TRUE; /* note: this is not a fault condition */
-      UARTPRT_mg_uUartPrtData.u16RxDataNbr = UARTPRT_mg_uUartPrtData.u16RxDataCnt;
-      UARTPRT_mg_uUartPrtData.u16RxDataCnt = 0U;
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8ByteTmoutFlg = TRUE;
-      UARTPRT_mg_uUartPrtData.uCtrl.Bit.u8RxNewFrame = TRUE; /* Begin to handle data in RX buffer */
-    }
-  }
 }
 
 
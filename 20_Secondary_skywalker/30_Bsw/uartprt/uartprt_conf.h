@@ -64,8 +64,7 @@
 /***********************************************
  * Define timing
  **********************************************/
-#define MG_RX_BYTE_TIMEOUT_4800     5U                /* Value * 1ms = time */
-#define MG_RX_BYTE_TIMEOUT_38400    1U                /* Value * 1ms = time */
+/* The RX frame ends with the idle line of the UART (one byte time) */
 
 /***********************************************
  * Define UART fail counter
@@ -110,6 +110,56 @@ inline uint16 UARTPRT_scfg_u16UartReadBaudrate(void)
   #endif
 }
 
+__attribute__((section ("ccram")))
+inline void UARTPRT_scfg_vUartClrIdleFlg(void)
+{
+  #if MG_UART_MODULE
+  UART_vUartClrIdleFlg();
+  #endif
+}
+
+inline void UARTPRT_scfg_vUartStartTxDma(const uint8 *pu8Data, uint16 u16Len)
+{
+  #if MG_UART_MODULE
+  UART_vStartTxDma(pu8Data, u16Len);
+  #endif
+}
+
+inline uint16 UARTPRT_scfg_u16UartReadTxDmaCnt(void)
+{
+  #if MG_UART_MODULE
+  return UART_u16ReadTxDmaCnt();
+  #else
+  return 0;
+  #endif
+}
+
+inline void UARTPRT_scfg_vUartStartRxDma(uint8 *pu8Buf, uint16 u16Size)
+{
+  #if MG_UART_MODULE
+  UART_vStartRxDma(pu8Buf, u16Size);
+  #endif
+}
+
+inline uint16 UARTPRT_scfg_u16UartReadRxDmaCnt(void)
+{
+  #if MG_UART_MODULE
+  return UART_u16ReadRxDmaCnt();
+  #else
+  return 0;
+  #endif
+}
+
+__attribute__((section ("ccram")))
+inline uint16 UARTPRT_scfg_u16UartStopRxDma(void)
+{
+  #if MG_UART_MODULE
+  return UART_u16StopRxDma();
+  #else
+  return 0;
+  #endif
+}
+
 /* CRC module section */
 inline uint16 UARTPRT_scfg_u16GetCrc16(uint16 u16InCrc, uint8 u8InData)
 {
@@ -120,6 +170,15 @@ inline uint16 UARTPRT_scfg_u16GetCrc16(uint16 u16InCrc, uint8 u8InData)
   #endif
 }
 
+inline uint16 UARTPRT_scfg_u16GetCrc16Blk(uint16 u16InCrc, const uint8 *pu8Data, uint32 u32Len)
+{
+  #if MG_CRC_MODULE
+  return CRC_u16GetCrc16Blk(u16InCrc, pu8Data, u32Len);
+  #else
+  return 0;
+  #endif
+}
+
 inline uint8 UARTPRT_scfg_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
 {
   #if MG_CRC_MODULE
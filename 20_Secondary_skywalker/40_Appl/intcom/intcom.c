@@ -30,6 +30,7 @@
   #include "intcom_scfg.h"
   #include "intcom_rte.h"
   #include "intcom_conf.h"
+  #include "intcom_frm.h"
 
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
@@ -38,6 +39,8 @@
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
+static INTCOM_FRM_S_SEC2COM_TX mg_sSec2ComTx;   /* Delta mode state per direction */
+static INTCOM_FRM_S_COM2SEC_RX mg_sCom2SecRx;
 
 /*******************************************************************************
  * Local function prototypes (private to module)
@@ -59,7 +62,10 @@
  ***************************************************************************** */
 void INTCOM_vInit(void)
 {
-
+  mg_sSec2ComTx.u8Cnt = 0U;       /* Keyframe first */
+  mg_sCom2SecRx.u16KeyLen = 0U;   /* Delta frames dropped until a keyframe */
+  /* No RX monitor needed for a stale keyframe: a frame lost on the way here
+   * is left unanswered, and the Com MCU sends a keyframe after that */
 }
 
 /** *****************************************************************************
@@ -90,81 +96,57 @@ void INTCOM_vDeInit(void)
 void INTCOM_vTxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
 {
   /* Init data */
+  INTCOM_FRM_S_SEC2COM sFrm;
   GLOBAL_U_U16BIT uLlcStatus00;
   GLOBAL_U_U16BIT uLlcStatus01;
   GLOBAL_U_U16BIT uLlcStatus02;
   GLOBAL_U_U8BIT  uTempStatus00;
-  uint16 u16DebugData0;
-  uint16 u16DebugData1;
-  uint16 u16DebugData2;
-  uint16 u1610mVVoltOutExtAvg;
-  uint16 u1610mACurrOutAvg;
-  uint16 u16100mWPwrOutAvg;
-  uint16 u161mVVoltNtc1;
-  uint16 u161mVVoltNtc2;
-  uint16 u1610mVVoltOutIntAvg;
-  uint16 u161mVIshareAvg;
-  uint16 u161mVILocalAvg;
-  uint8 u8BlFwVerMajor;
-  uint8 u8BlFwVerMinor;
-  uint8 u8BlFwVerDebug;   
+  uint8 u8Isr;
+  uint8 u8Item;
 
   /* Read data from RTE */
   INTCOM_Rte_Read_R_uLlcStatus00(&uLlcStatus00);
   INTCOM_Rte_Read_R_uLlcStatus01(&uLlcStatus01);
   INTCOM_Rte_Read_R_uLlcStatus02(&uLlcStatus02);
   INTCOM_Rte_Read_R_uTempStatus00(&uTempStatus00);
-  INTCOM_Rte_Read_R_u16DebugData0(&u16DebugData0);
-  INTCOM_Rte_Read_R_u16DebugData1(&u16DebugData1);
-  INTCOM_Rte_Read_R_u16DebugData2(&u16DebugData2);
-  INTCOM_Rte_Read_R_u1610mVVoltOutExtAvg(&u1610mVVoltOutExtAvg);
-  INTCOM_Rte_Read_R_u1610mACurrOutAvg(&u1610mACurrOutAvg);
-  INTCOM_Rte_Read_R_u16100mWPwrOutAvg(&u16100mWPwrOutAvg);
-  INTCOM_Rte_Read_R_u161mVVoltNtc1(&u161mVVoltNtc1);
-  INTCOM_Rte_Read_R_u161mVVoltNtc2(&u161mVVoltNtc2);
-  INTCOM_Rte_Read_R_u1610mVVoltOutIntAvg(&u1610mVVoltOutIntAvg);
-  INTCOM_Rte_Read_R_u161mVIshareAvg(&u161mVIshareAvg);
-  INTCOM_Rte_Read_R_u161mVILocalAvg(&u161mVILocalAvg);
-  INTCOM_Rte_Read_R_u8BlFwVerMajor(&u8BlFwVerMajor);
-  INTCOM_Rte_Read_R_u8BlFwVerMinor(&u8BlFwVerMinor);
-  INTCOM_Rte_Read_R_u8BlFwVerDebug(&u8BlFwVerDebug);
+  INTCOM_Rte_Read_R_u16DebugData0(&sFrm.au16DebugData[0]);
+  INTCOM_Rte_Read_R_u16DebugData1(&sFrm.au16DebugData[1]);
+  INTCOM_Rte_Read_R_u16DebugData2(&sFrm.au16DebugData[2]);
+  INTCOM_Rte_Read_R_u1610mVVoltOutExtAvg(&sFrm.u16VoutExtAvg);
+  INTCOM_Rte_Read_R_u1610mACurrOutAvg(&sFrm.u16IoutAvg);
+  INTCOM_Rte_Read_R_u16100mWPwrOutAvg(&sFrm.u16PoutAvg);
+  INTCOM_Rte_Read_R_u161mVVoltNtc1(&sFrm.u16VNtc1Avg);
+  INTCOM_Rte_Read_R_u161mVVoltNtc2(&sFrm.u16VNtc2Avg);
+  INTCOM_Rte_Read_R_u1610mVVoltOutIntAvg(&sFrm.u16VoutIntAvg);
+  INTCOM_Rte_Read_R_u161mVIshareAvg(&sFrm.u16VIShareAvg);
+  INTCOM_Rte_Read_R_u161mVILocalAvg(&sFrm.u16VILocalAvg);
+  INTCOM_Rte_Read_R_u8BlFwVerMajor(&sFrm.au8BootRev[0]);
+  INTCOM_Rte_Read_R_u8BlFwVerMinor(&sFrm.au8BootRev[1]);
+  INTCOM_Rte_Read_R_u8BlFwVerDebug(&sFrm.au8BootRev[2]);
+  sFrm.u16CpuLoad = INTCOM_scfg_u16SchmGetCpuLoad();
 
   /* Fill buffer */
-  pau8TxBuf[(*u16TxDataNbr)++] = MG_APP_MAJOR_REV;
-  pau8TxBuf[(*u16TxDataNbr)++] = MG_APP_MINOR_REV;
-  pau8TxBuf[(*u16TxDataNbr)++] = MG_APP_DEBUG_REV;
-  pau8TxBuf[(*u16TxDataNbr)++] = u8BlFwVerMajor;
-  pau8TxBuf[(*u16TxDataNbr)++] = u8BlFwVerMinor;
-  pau8TxBuf[(*u16TxDataNbr)++] = u8BlFwVerDebug;
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus00));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus00) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus01));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus01) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus02));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uLlcStatus02) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&uTempStatus00));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData0));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData0) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData1));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData1) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData2));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16DebugData2) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mVVoltOutExtAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mVVoltOutExtAvg) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mACurrOutAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mACurrOutAvg) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16100mWPwrOutAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u16100mWPwrOutAvg) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVVoltNtc1));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVVoltNtc1) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVVoltNtc2));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVVoltNtc2) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mVVoltOutIntAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u1610mVVoltOutIntAvg) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVIshareAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVIshareAvg) + 1U);
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVILocalAvg));
-  pau8TxBuf[(*u16TxDataNbr)++] = *((uint8 *)(&u161mVILocalAvg) + 1U);
+  sFrm.au8AppRev[0]   = MG_APP_MAJOR_REV;
+  sFrm.au8AppRev[1]   = MG_APP_MINOR_REV;
+  sFrm.au8AppRev[2]   = MG_APP_DEBUG_REV;
+  sFrm.u8TempStatus00 = uTempStatus00.ALL;
+  sFrm.uLlcStatus00   = uLlcStatus00.ALL;
+  sFrm.uLlcStatus01   = uLlcStatus01.ALL;
+  sFrm.uLlcStatus02   = uLlcStatus02.ALL;
+
+  /* ISR timing monitor: jitter, average and maximum execution time, overruns of each ISR */
+  for (u8Isr = 0U; u8Isr < (uint8)SCHM_E_ISR_COUNT; u8Isr++)
+  {
+    for (u8Item = 0U; u8Item < (uint8)SCHM_E_ISR_MON_COUNT; u8Item++)
+    {
+      sFrm.au16IsrMon[(u8Isr * (uint8)SCHM_E_ISR_MON_COUNT) + u8Item] = INTCOM_scfg_u16SchmGetIsrMon(u8Isr, u8Item);
+    }
+  }
+#if MG_INTCOM_DELTA
+  INTCOM_FRM_vPackSec2ComDelta(&sFrm, &mg_sSec2ComTx, pau8TxBuf, u16TxDataNbr);
+#else
+  INTCOM_FRM_vPackSec2Com(&sFrm, pau8TxBuf, u16TxDataNbr);
+#endif
 }
 
 /** *****************************************************************************
@@ -179,17 +161,8 @@ void INTCOM_vTxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
  ***************************************************************************** */
 void INTCOM_vRxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
 {
+  INTCOM_FRM_S_COM2SEC sFrm;
   GLOBAL_U_U16BIT uCom2Pri00;
-  GLOBAL_U_U16BIT uDebugData0Addr;
-  GLOBAL_WORD_VAL u16q12CalibVoltOutGain;
-  GLOBAL_WORD_VAL u16q12CalibCurrOutGain;
-  GLOBAL_WORD_VAL u16q12CalibIshareGain;
-  GLOBAL_WORD_VAL u100mHzVoltInFreq;
-  GLOBAL_WORD_VAL u16q12CalibIshareOfs;
-  GLOBAL_WORD_VAL s16CalibVoltOutAmp;
-  GLOBAL_WORD_VAL s16CalibCurrOutAmp;
-  GLOBAL_WORD_VAL s16CalibVoltOutOfs;
-  GLOBAL_WORD_VAL s16CalibCurrOutOfs;
 
   if ( pau8RxBuf[u16RxBufCnt++] & MG_BOOT_MASK) /* Check if slave in boot mode */
   {
@@ -197,7 +170,8 @@ void INTCOM_vRxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
     INTCOM_Rte_Write_P_B_BL_MODE(TRUE);
     INTCOM_Rte_Write_P_B_PFC_HALT(TRUE);
   }
-  else
+  else if (0U != INTCOM_FRM_u16UnpackCom2SecDelta(&pau8RxBuf[u16RxBufCnt], MG_RX_PAYLOAD_LEN(pau8RxBuf),
+                                                       &mg_sCom2SecRx, &sFrm))
   {
     /* Com2SecStatus:
      * bit0 Enable V1
@@ -208,64 +182,33 @@ void INTCOM_vRxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
      * bit5 Clear Latch Fault
      * bit6 Disable Vshare    
      */ 
+    uCom2Pri00.ALL = sFrm.uComStatus00;
     if (u8BroadcastFlg)
     {
-      /* Read data from buffer */
-      uCom2Pri00.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      uCom2Pri00.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      uDebugData0Addr.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      uDebugData0Addr.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibVoltOutGain.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibVoltOutGain.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-
       /* Write data to RTE */
       INTCOM_Rte_Write_P_uComStatus00(uCom2Pri00);
-      INTCOM_Rte_Write_P_u16DebugData0(*((uint16 *)(uDebugData0Addr.ALL + 0x08000000)));
+      INTCOM_Rte_Write_P_u16DebugData0(*((uint16 *)(sFrm.u16DebugAddr + 0x08000000)));
     }
     else
     {
-      /* Read data from buffer */
-      uCom2Pri00.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      uCom2Pri00.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      uDebugData0Addr.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      uDebugData0Addr.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibVoltOutGain.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibVoltOutGain.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibCurrOutGain.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibCurrOutGain.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibIshareGain.Bytes.LB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibIshareGain.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u100mHzVoltInFreq.Bytes.LB = pau8RxBuf[u16RxBufCnt++];  
-      u100mHzVoltInFreq.Bytes.HB = pau8RxBuf[u16RxBufCnt++];
-      u16q12CalibIshareOfs.Bytes.LB = pau8RxBuf[u16RxBufCnt++]; 
-      u16q12CalibIshareOfs.Bytes.HB = pau8RxBuf[u16RxBufCnt++];    
-      s16CalibVoltOutAmp.Bytes.LB = pau8RxBuf[u16RxBufCnt++]; 
-      s16CalibVoltOutAmp.Bytes.HB = pau8RxBuf[u16RxBufCnt++];  
-      s16CalibVoltOutOfs.Bytes.LB = pau8RxBuf[u16RxBufCnt++]; 
-      s16CalibVoltOutOfs.Bytes.HB = pau8RxBuf[u16RxBufCnt++];   
-      s16CalibCurrOutAmp.Bytes.LB = pau8RxBuf[u16RxBufCnt++]; 
-      s16CalibCurrOutAmp.Bytes.HB = pau8RxBuf[u16RxBufCnt++]; 
-      s16CalibCurrOutOfs.Bytes.LB = pau8RxBuf[u16RxBufCnt++]; 
-      s16CalibCurrOutOfs.Bytes.HB = pau8RxBuf[u16RxBufCnt++];  
-
       /* Process data */
-      u16q12CalibVoltOutGain.s16Val = LIMIT(u16q12CalibVoltOutGain.s16Val, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
-      u16q12CalibCurrOutGain.s16Val = LIMIT(u16q12CalibCurrOutGain.s16Val, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
-      u16q12CalibIshareGain.s16Val = LIMIT(u16q12CalibIshareGain.s16Val, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
-      u16q12CalibIshareOfs.s16Val = LIMIT(u16q12CalibIshareOfs.s16Val, MG_S16_10mA_CALIB_OFS_MIN, MG_S16_10mA_CALIB_OFS_MAX);
+      sFrm.u16V1Gain     = LIMIT((sint16)sFrm.u16V1Gain, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
+      sFrm.u16IGain      = LIMIT((sint16)sFrm.u16IGain, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
+      sFrm.u16IShareGain = LIMIT((sint16)sFrm.u16IShareGain, MG_U16Q12_CALIB_GAIN_MIN, MG_U16Q12_CALIB_GAIN_MAX);
+      sFrm.s16IShareOfs  = LIMIT(sFrm.s16IShareOfs, MG_S16_10mA_CALIB_OFS_MIN, MG_S16_10mA_CALIB_OFS_MAX);
       
       /* Write data to RTE */
       INTCOM_Rte_Write_P_uComStatus00(uCom2Pri00);
-      INTCOM_Rte_Write_P_u16DebugData0(*((uint16 *)(uDebugData0Addr.ALL + 0x08000000)));
-      INTCOM_Rte_Write_P_u16q12CalibVoltOutGain(u16q12CalibVoltOutGain.s16Val);
-      INTCOM_Rte_Write_P_u16q12CalibCurrOutGain(u16q12CalibCurrOutGain.s16Val);
-      INTCOM_Rte_Write_P_u16q12CalibIshareGain(u16q12CalibIshareGain.s16Val);
-      INTCOM_Rte_Write_P_s1610mACalibIshareOfs(u16q12CalibIshareOfs.s16Val);
-      INTCOM_Rte_Write_P_u16100mHzVoltInFreq(u100mHzVoltInFreq.u16Val);
-      INTCOM_Rte_Write_P_s16CalibVoltOutAmp(s16CalibVoltOutAmp.s16Val);
-      INTCOM_Rte_Write_P_s16CalibCurrOutAmp(s16CalibCurrOutAmp.s16Val);
-      INTCOM_Rte_Write_P_s16CalibVoltOutOfs(s16CalibVoltOutOfs.s16Val);
-      INTCOM_Rte_Write_P_s16CalibCurrOutOfs(s16CalibCurrOutOfs.s16Val);
+      INTCOM_Rte_Write_P_u16DebugData0(*((uint16 *)(sFrm.u16DebugAddr + 0x08000000)));
+      INTCOM_Rte_Write_P_u16q12CalibVoltOutGain(sFrm.u16V1Gain);
+      INTCOM_Rte_Write_P_u16q12CalibCurrOutGain(sFrm.u16IGain);
+      INTCOM_Rte_Write_P_u16q12CalibIshareGain(sFrm.u16IShareGain);
+      INTCOM_Rte_Write_P_s1610mACalibIshareOfs(sFrm.s16IShareOfs);
+      INTCOM_Rte_Write_P_u16100mHzVoltInFreq(sFrm.u16VinFreq);
+      INTCOM_Rte_Write_P_s16CalibVoltOutAmp(sFrm.s16CaliV1Amp);
+      INTCOM_Rte_Write_P_s16CalibCurrOutAmp(sFrm.s16CaliI1Amp);
+      INTCOM_Rte_Write_P_s16CalibVoltOutOfs(sFrm.s16CaliV1Ofs);
+      INTCOM_Rte_Write_P_s16CalibCurrOutOfs(sFrm.s16CaliI1Ofs);
 
       INTCOM_Rte_Write_P_B_LLC_FAULT_CLR(uCom2Pri00.Bits.f5);
       INTCOM_Rte_Write_P_B_VIN_LINE(uCom2Pri00.Bits.f4 == 0?1u:0);
@@ -273,6 +216,10 @@ void INTCOM_vRxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
       INTCOM_Rte_Write_P_B_LLC_OVP_TEST(uCom2Pri00.Bits.f1);
     }
   }
+  else
+  {
+    /* Other layout version: frame dropped */
+  }
 }
 
 
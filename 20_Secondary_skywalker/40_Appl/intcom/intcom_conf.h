@@ -31,6 +31,13 @@
  ******************************************************************************/
 
 #define MG_BOOT_MASK          0x01
+#define MG_RX_LEN_POS         2U      /* STX, ADDR, LEN, data: LEN data bytes follow */
+
+/* Payload bytes after the status byte (data: status, payload) */
+#define MG_RX_PAYLOAD_LEN(buf)  (((buf)[MG_RX_LEN_POS] > 0U) ? ((uint16)(buf)[MG_RX_LEN_POS] - 1U) : 0U)
+
+/* 1 = Send SEC2COM as keyframes and delta frames, 0 = full frames only */
+#define MG_INTCOM_DELTA         1
 
 #ifdef HALT_TEST_MODE
 #define  SPECIAL_SW_VERSION   0x80u
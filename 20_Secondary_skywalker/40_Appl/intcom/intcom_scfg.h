@@ -29,6 +29,7 @@
  * Included header
  ******************************************************************************/
 #include "global.h"
+#include "schm_api.h"
 
 /*******************************************************************************
  * Global constants and macros (public to other modules)
@@ -38,6 +39,17 @@
  * Module interface
  ******************************************************************************/
 
+/* Scheduler module section */
+inline uint16 INTCOM_scfg_u16SchmGetCpuLoad(void)
+{
+  return SCHM_u16GetCpuLoad();
+}
+
+inline uint16 INTCOM_scfg_u16SchmGetIsrMon(uint8 u8Isr, uint8 u8Item)
+{
+  return SCHM_u16GetIsrMon((SCHM_E_ISR)u8Isr, (SCHM_E_ISR_MON)u8Item);
+}
+
 
 #ifdef __cplusplus
   }
@@ -827,9 +827,8 @@ static void mg_vSaveCaliData(void)
     u8Crc = CALI_SCFG_u8GetCrc8( u8Crc,HIBYTE(sEepromTemp.s16Thr));
     sEepromTemp.u8Crc8 = u8Crc;
 		
-		if(CALI_SCFG_u8IsEepromStandbyState() == TRUE)
+		if(CALI_SCFG_u8WriteMem(CALI_sPara.u16SaveAddr, (uint8*)&sEepromTemp.s16Amp, MG_SEVEN_BYTES) == TRUE)
 		{
-			CALI_SCFG_vWriteMem(CALI_sPara.u16SaveAddr, (uint8*)&sEepromTemp.s16Amp, MG_SEVEN_BYTES);
 			CALI_uStatus.Bits.CALI_NEW_DATA = FALSE;
 		}
   }
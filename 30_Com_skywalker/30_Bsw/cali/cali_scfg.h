@@ -38,14 +38,9 @@ SINLINE void CALI_SCFG_vReadMem(uint8* pu8Buffer, uint16 u16ReadAddr, uint16 u16
 	(void)EEPROM_u32ReadBuffer(pu8Buffer, u16ReadAddr,u16NumByteToRead);
 }
 
-SINLINE void CALI_SCFG_vWriteMem(uint16 u16ReadAddr, const uint8* pu8Buffer,  uint16 u16NumByteToWrite)
+SINLINE uint8 CALI_SCFG_u8WriteMem(uint16 u16WriteAddr, const uint8* pu8Buffer, uint16 u16NumByteToWrite)
 {
-	(void)EEPROM_u32WriteBuffer(pu8Buffer, u16ReadAddr,u16NumByteToWrite);
-}
-
-SINLINE uint8 CALI_SCFG_u8IsEepromStandbyState()
-{
-  return (uint8)(EEPROM_u32WaitEepromStandbyState() == 0?1u:0U);
+	return EEPROM_u8QueueWrite(pu8Buffer, u16WriteAddr, u16NumByteToWrite, NULL);
 }
 
 SINLINE uint8 CALI_SCFG_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
@@ -56,6 +56,36 @@ uint16 CRC_u16GetCrc16(uint16 u16InCrc, uint8 u8InData);
  *******************************************************************************/
 uint8 CRC_u8GetCrc8(uint8 u8InCrc, uint8 u8InData);
 
+/** *****************************************************************************
+ * \brief         Calculate crc16 over a block of data. Same result as calling
+ *                CRC_u16GetCrc16() for every byte.
+ *
+ * \param[in]     u16InCrc  start value (seed or crc of the previous block)
+ *                pu8Data   data for crc calculation
+ *                u32Len    number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        uint16
+ *
+ *******************************************************************************/
+uint16 CRC_u16GetCrc16Blk(uint16 u16InCrc, const uint8 *pu8Data, uint32 u32Len);
+
+/** *****************************************************************************
+ * \brief         Calculate crc8 over a block of data. Same result as calling
+ *                CRC_u8GetCrc8() for every byte.
+ *
+ * \param[in]     u8InCrc   start value (seed or crc of the previous block)
+ *                pu8Data   data for crc calculation
+ *                u32Len    number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        uint8
+ *
+ *******************************************************************************/
+uint8 CRC_u8GetCrc8Blk(uint8 u8InCrc, const uint8 *pu8Data, uint32 u32Len);
+
 
 #ifdef __cplusplus
   }
@@ -37,6 +37,18 @@
 #define MG_CRC16_LOOKUP_TABLE   1
 #define MG_CRC16_USED           1
 
+/* Block functions: process 4 bytes per step with 3 more tables per polynomial
+ * (CRC8 768 bytes, CRC16 1536 bytes of flash). Off as the application area is
+ * nearly full, the block functions then use the single table. The F051 CRC unit
+ * is fixed to the CRC-32 polynomial 0x04C11DB7 and can not be used here.
+ * The switches can be overridden from the command line (host benchmark). */
+#ifndef MG_CRC8_SLICE_BY_4
+#define MG_CRC8_SLICE_BY_4      0
+#endif
+#ifndef MG_CRC16_SLICE_BY_4
+#define MG_CRC16_SLICE_BY_4     0
+#endif
+
 
 #ifdef __cplusplus
   }
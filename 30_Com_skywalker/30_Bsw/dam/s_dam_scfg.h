@@ -59,14 +59,7 @@ SINLINE void S_DAM_SCFG_vOnErrorDetected(uint16 u16LineNumber,
 /* Check CRC */
 SINLINE uint32 S_DAM_SCFG_u32Crc(const uint8* pu8Buffer, uint32 u32NumByteToCheckCRC)
 {
-	uint32 u32Loop,u32Ret;
-	
-	u32Ret = MG_CRC_SEED;
-	for(u32Loop=0;u32Loop<u32NumByteToCheckCRC;u32Loop++)
-	{
-		u32Ret = CRC_u16GetCrc16((uint16)u32Ret, *(pu8Buffer+u32Loop));
-	}
-  return u32Ret;
+  return (uint32)CRC_u16GetCrc16Blk((uint16)MG_CRC_SEED, pu8Buffer, u32NumByteToCheckCRC);
 }
 
 /* Read area. */
@@ -34,15 +34,88 @@
  * Local constants and macros (private to module)
  ******************************************************************************/
 
+/*
+ * Interrupt driven request engine on I2C2. DMA channels 4/5 of I2C2 are taken
+ * by USART2, so every byte is moved by EEPROM_CFG_vI2cIsr(). The scheduler only
+ * starts requests and ACK polls the device in EEPROM_vTask():
+ *
+ *   read:  ADDR  (address bytes, soft end) -> TC -> READ (restart, 255 byte
+ *          reload chunks) -> STOPF
+ *   write: WRITE (address bytes + page data, auto end) -> STOPF -> WAIT ->
+ *          POLL (address only probe each 1ms) -> STOPF, NACK: WAIT, ACK: next
+ *          page or done
+ */
+#define MG_REQ_READ               0u
+#define MG_REQ_WRITE              1u
+
+#define MG_NBYTES_MAX             255u
+
+#define MG_SYNC_PENDING           0xFFu
+
+#define MG_I2C_ERR_FLAGS          (I2C_ISR_BERR | I2C_ISR_ARLO | I2C_ISR_OVR)
+#define MG_I2C_EVENT_FLAGS        (I2C_ISR_TXIS | I2C_ISR_RXNE | I2C_ISR_TC | I2C_ISR_TCR | \
+                                   I2C_ISR_NACKF | I2C_ISR_STOPF | MG_I2C_ERR_FLAGS)
+
+/*******************************************************************************
+ * Local data types (private typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef enum MG_E_STATE_
+{
+  MG_E_STATE_IDLE = 0,            /* No request running */
+  MG_E_STATE_ADDR,                /* Read: memory address sent */
+  MG_E_STATE_READ,                /* Read: data received */
+  MG_E_STATE_WRITE,               /* Write: address and page data sent */
+  MG_E_STATE_WAIT,                /* Write cycle, probe at the next EEPROM_vTask() */
+  MG_E_STATE_POLL                 /* Write cycle, address probe running */
+} MG_E_STATE;
+
+typedef struct MG_S_REQ_
+{
+  uint8 *pu8Data;                 /* Read destination or write source */
+  uint16 u16Addr;                 /* EEPROM address */
+  uint16 u16Len;                  /* Bytes */
+  EEPROM_pfvDone pfvDone;         /* Completion callback or NULL */
+  uint8 u8Type;                   /* MG_REQ_READ / MG_REQ_WRITE */
+  uint8 au8Copy[EEPROM_CONF_REQ_COPY_SIZE]; /* Short write data */
+} MG_S_REQ;
+
+typedef struct MG_S_ENGINE_
+{
+  volatile MG_E_STATE eState;
+  uint16 u16Addr;                 /* EEPROM address of the running transfer */
+  uint16 u16Cnt;                  /* Request bytes done */
+  uint16 u16Left;                 /* Read: bytes not yet programmed into NBYTES */
+  uint8 u8AddrCnt;                /* Address bytes sent */
+  uint8 u8Trials;                 /* Address probes of the write cycle */
+  uint8 bNack;                    /* NACK seen in the running transfer */
+  volatile uint8 u8IdleTicks;     /* EEPROM_vTask() periods without an I2C event */
+} MG_S_ENGINE;
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static MG_S_REQ mg_asReq[EEPROM_CONF_REQ_NUM];
+static volatile uint8 mg_u8ReqHead;        /* Next free entry, written by the queue functions */
+static volatile uint8 mg_u8ReqTail;        /* Running entry, written by the engine */
+static MG_S_ENGINE mg_sEng;
+static volatile uint8 mg_u8SyncResult;
 
-__IO uint16  EEPROMAddress = 0;   
-__IO uint32  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-__IO uint16  EEPROMDataNum;
-  
 /*******************************************************************************
  * Local function prototypes (private to module)
  ******************************************************************************/
-static uint32 mg_u32TimeoutUserCallback(void);
+static uint8 mg_u8Queue(uint8 u8Type, uint8* pu8Data, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone);
+static void mg_vStartReq(void);
+static void mg_vStartPage(void);
+static void mg_vStartPoll(void);
+static void mg_vProgramRead(uint32 u32StartStop);
+static void mg_vHandleI2c(void);
+static void mg_vHandleStop(void);
+static void mg_vDone(EEPROM_E_RESULT eResult);
+static void mg_vAbort(EEPROM_E_RESULT eResult);
+static void mg_vSyncDone(EEPROM_E_RESULT eResult);
+static uint32 mg_u32WaitSync(uint8 u8Queued);
 
 /*******************************************************************************
  * Global functions (public to other modules)
@@ -75,610 +148,587 @@ void EEPROM_vDeInit(void)
  ***************************************************************************** */
 void EEPROM_vInit(void)
 { 
-  EEPROMAddress = EEPROM_CONF_HW_ADDRESS;      
+  mg_u8ReqHead = 0u;
+  mg_u8ReqTail = 0u;
+  mg_sEng.eState = MG_E_STATE_IDLE;
+  mg_sEng.u8IdleTicks = 0u;
 }
 
 /** *****************************************************************************
- * \brief         Reads a block of data from the EEPROM.
+ * \brief         Starts the queued requests, ACK polls the device after page
+ *                writes and aborts stuck transfers. Called every 1ms.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void EEPROM_vTask(void)
+{
+  /* IDLE and WAIT: no transfer, the interrupt does not touch the engine */
+  switch (mg_sEng.eState)
+  {
+    case MG_E_STATE_IDLE:
+    {
+      if (mg_u8ReqHead != mg_u8ReqTail)
+      {
+        mg_vStartReq();
+      }
+      break;
+    }
+    case MG_E_STATE_WAIT:
+    {
+      mg_vStartPoll();
+      break;
+    }
+    default:
+    {
+      mg_sEng.u8IdleTicks++;
+      if (mg_sEng.u8IdleTicks > EEPROM_CONF_XFER_TICKS)
+      {
+        EEPROM_SCFG_vDisableIsr();
+        mg_vAbort(EEPROM_E_RESULT_BUS);
+        EEPROM_SCFG_vEnableIsr();
+      }
+      break;
+    }
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Queue a read of the EEPROM
+ *
+ * \param[in]     u16Addr : EEPROM's internal address to start reading from
+ *                u16Len : number of bytes to read
+ *                pfvDone : completion callback, NULL for none
+ * \param[in,out] -
+ * \param[out]    pu8Buffer : receives the data, must stay valid until pfvDone
+ *
+ * \return        TRUE if queued, FALSE if the queue is full
+ *
+ ***************************************************************************** */
+uint8 EEPROM_u8QueueRead(uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  return mg_u8Queue(MG_REQ_READ, pu8Buffer, u16Addr, u16Len, pfvDone);
+}
+
+/** *****************************************************************************
+ * \brief         Queue a write to the EEPROM. The engine splits it into page
+ *                writes and ACK polls the device after each page.
+ *
+ * \param[in]     pu8Buffer : data to write. Up to EEPROM_CONF_REQ_COPY_SIZE bytes
+ *                            are copied, a longer buffer must stay valid until
+ *                            pfvDone
+ *                u16Addr : EEPROM's internal address to write to
+ *                u16Len : number of bytes to write
+ *                pfvDone : completion callback, NULL for none
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE if queued, FALSE if the queue is full
+ *
+ ***************************************************************************** */
+uint8 EEPROM_u8QueueWrite(const uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  return mg_u8Queue(MG_REQ_WRITE, (uint8*)pu8Buffer, u16Addr, u16Len, pfvDone);
+}
+
+/** *****************************************************************************
+ * \brief         Number of requests that can be queued
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Free queue entries
+ *
+ ***************************************************************************** */
+uint8 EEPROM_u8GetFreeReq(void)
+{
+  return (uint8)((mg_u8ReqTail - mg_u8ReqHead - 1u) & EEPROM_CONF_REQ_MASK);
+}
+
+/** *****************************************************************************
+ * \brief         Check the request queue is empty and no transfer or write
+ *                cycle is running
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE if idle
+ *
+ ***************************************************************************** */
+uint8 EEPROM_u8IsIdle(void)
+{
+  return (uint8)((mg_u8ReqHead == mg_u8ReqTail) && (MG_E_STATE_IDLE == mg_sEng.eState));
+}
+
+/** *****************************************************************************
+ * \brief         Reads a block of data from the EEPROM and waits for it.
+ *                Runs the queue by polling, for the init before the interrupts
+ *                are enabled.
  *
  * \param[in]     ReadAddr : EEPROM's internal address to start reading from.
- *                NumByteToRead : pointer to the variable holding number of bytes to 
- *                                be read from the EEPROM.
+ *                NumByteToRead : number of bytes to be read from the EEPROM.
  * \param[in,out] -
  * \param[out]    pBuffer : pointer to the buffer that receives the data read from 
  *                          the EEPROM.
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else
+ *                EEPROM_CONF_FAIL.
  *
  ***************************************************************************** */
 uint32 EEPROM_u32ReadBuffer(uint8* pBuffer, uint16 ReadAddr, uint16 NumByteToRead)
 {  
-  uint32 NumbOfSingle = 0, Count = 0, DataNum = 0, StartCom = 0;
-  
-  /* Get number of reload cycles */
-  Count = NumByteToRead / 255;  
-  NumbOfSingle = NumByteToRead % 255;
-  
-#ifdef EEPROM_M24C08
-  
-  /* Configure slave address, nbytes, reload and generate start */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 1, I2C_SoftEnd_Mode, I2C_Generate_Start_Write);
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+  mg_u8SyncResult = MG_SYNC_PENDING;
+  return mg_u32WaitSync(EEPROM_u8QueueRead(pBuffer, ReadAddr, NumByteToRead, mg_vSyncDone));
+}
+
+/** *****************************************************************************
+ * \brief         Writes buffer of data to the I2C EEPROM and waits for the last
+ *                write cycle. Runs the queue by polling, for the init only.
+ *
+ * \param[in]     pBuffer : pointer to the buffer  containing the data to be written 
+ *                          to the EEPROM.
+ *                WriteAddr : EEPROM's internal address to write to.
+ *                NumByteToWrite : number of bytes to write to the EEPROM.
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else
+ *                EEPROM_CONF_FAIL.
+ *
+ ***************************************************************************** */
+uint32 EEPROM_u32WriteBuffer(const uint8* pBuffer, uint16 WriteAddr, uint16 NumByteToWrite)
+{
+  mg_u8SyncResult = MG_SYNC_PENDING;
+  return mg_u32WaitSync(EEPROM_u8QueueWrite(pBuffer, WriteAddr, NumByteToWrite, mg_vSyncDone));
+}
+
+/** *****************************************************************************
+ * \brief         I2C2 interrupt, moves the bytes of the running request
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void EEPROM_CFG_vI2cIsr(void)
+{
+  mg_vHandleI2c();
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Add a request to the queue, started by EEPROM_vTask()
+ *
+ * \param[in]     u8Type : MG_REQ_READ / MG_REQ_WRITE
+ *                pu8Data, u16Addr, u16Len, pfvDone : see EEPROM_u8QueueRead()
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE if queued
+ *
+ ***************************************************************************** */
+static uint8 mg_u8Queue(uint8 u8Type, uint8* pu8Data, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  MG_S_REQ *psReq;
+  uint8 u8Next = (uint8)((mg_u8ReqHead + 1u) & EEPROM_CONF_REQ_MASK);
+  uint8 u8Cnt;
+
+  if ((u8Next == mg_u8ReqTail) || (0u == u16Len))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    return FALSE;
   }
-  
-  /* Send memory address */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)ReadAddr);
-  
-#elif defined(EEPROM_M24M01) || defined(EEPROM_M24C64_32) || defined (EEPROM_M24LR64) || defined(EEPROM_M24C512) 
-  
-  /* Configure slave address, nbytes, reload and generate start */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 2, I2C_SoftEnd_Mode, I2C_Generate_Start_Write);
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+
+  psReq = &mg_asReq[mg_u8ReqHead];
+  psReq->u8Type = u8Type;
+  psReq->u16Addr = u16Addr;
+  psReq->u16Len = u16Len;
+  psReq->pfvDone = pfvDone;
+  psReq->pu8Data = pu8Data;
+  if ((MG_REQ_WRITE == u8Type) && (u16Len <= EEPROM_CONF_REQ_COPY_SIZE))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    for (u8Cnt = 0u; u8Cnt < (uint8)u16Len; u8Cnt++)
+    {
+      psReq->au8Copy[u8Cnt] = pu8Data[u8Cnt];
+    }
+    psReq->pu8Data = psReq->au8Copy;
   }
-  
-  /* Send MSB of memory address */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)((ReadAddr & 0xFF00) >> 8));
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;  
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+
+  /* Publish the entry after it is complete */
+  mg_u8ReqHead = u8Next;
+  return TRUE;
+}
+
+/** *****************************************************************************
+ * \brief         Start the request at the queue tail
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vStartReq(void)
+{
+  const MG_S_REQ *psReq = &mg_asReq[mg_u8ReqTail];
+
+  mg_sEng.u16Cnt = 0u;
+  mg_sEng.u8IdleTicks = 0u;
+  if (MG_REQ_READ == psReq->u8Type)
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-  }
-  
-  /* Send LSB of memory address  */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)(ReadAddr & 0x00FF));
-  
-#endif /*!< EEPROM_M24C08 */ 
-  
-  /* Wait until TC flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TC) == RESET)
-  {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-  }  
-  
-  /* If number of Reload cycles is not equal to 0 */
-  if (Count != 0)
-  {
-    /* Starting communication */
-    StartCom = 1;
-    
-    /* Wait until all reload cycles are performed */
-    while( Count != 0)
-    { 
-      /* If a read transfer is performed */
-      if (StartCom == 0)      
-      {
-        /* Wait until TCR flag is set */
-        EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT; 
-        while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TCR) == RESET)
-        {
-          if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-        }
-      }      
-      
-      /* if remains one read cycle */
-      if ((Count == 1) && (NumbOfSingle == 0))
-      {
-        /* if starting communication */
-        if (StartCom != 0)
-        {
-          /* Configure slave address, end mode and start condition */
-          I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 255, I2C_AutoEnd_Mode, I2C_Generate_Start_Read);
-        }
-        else
-        {
-          /* Configure slave address, end mode */
-          I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 255, I2C_AutoEnd_Mode, I2C_No_StartStop);          
-        }
-      }
-      else 
-      {
-        /* if starting communication */
-        if (StartCom != 0)
-        {
-          /* Configure slave address, end mode and start condition */
-          I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 255, I2C_Reload_Mode, I2C_Generate_Start_Read);
-        }
-        else
-        {
-          /* Configure slave address, end mode */
-          I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 255, I2C_Reload_Mode, I2C_No_StartStop);          
-        } 
-      }
-      
-      /* Update local variable */
-      StartCom = 0;      
-      DataNum = 0;
-      
-      /* Wait until all data are received */
-      while (DataNum != 255)
-      {        
-        /* Wait until RXNE flag is set */
-        EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-        while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_RXNE) == RESET)
-        {
-          if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-        }
-        
-        /* Read data from RXDR */
-        pBuffer[DataNum]= I2C_ReceiveData(EEPROM_CFG_I2C);
-        
-        /* Update number of received data */
-        DataNum++;
-      }      
-      /* Update Pointer of received buffer */ 
-      pBuffer += DataNum;  
-      
-      /* update number of reload cycle */
-      Count--;
-    }
-    
-    /* If number of single data is not equal to 0 */
-    if (NumbOfSingle != 0)
-    {            
-      /* Wait until TCR flag is set */
-      EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;   
-      while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TCR) == RESET)
-      {
-        if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-      }
-      
-      /* Update CR2 : set Nbytes and end mode */
-      I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, (uint8)(NumbOfSingle), I2C_AutoEnd_Mode, I2C_No_StartStop);
-      
-      /* Reset local variable */
-      DataNum = 0;
-      
-      /* Wait until all data are received */
-      while (DataNum != NumbOfSingle)
-      {        
-        /* Wait until RXNE flag is set */
-        EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-        while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_RXNE) == RESET)
-        {
-          if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-        }
-        
-        /* Read data from RXDR */
-        pBuffer[DataNum]= I2C_ReceiveData(EEPROM_CFG_I2C);
-        
-        /* Update number of received data */
-        DataNum++;
-      } 
-    }
+    mg_sEng.u16Addr = psReq->u16Addr;
+    mg_sEng.u16Left = psReq->u16Len;
+    mg_sEng.u8AddrCnt = 0u;
+    mg_sEng.bNack = FALSE;
+    mg_sEng.eState = MG_E_STATE_ADDR;
+    I2C_TransferHandling(EEPROM_CFG_I2C, EEPROM_CONF_HW_ADDRESS, (uint8)EEPROM_CONF_ADDR_SIZE, I2C_SoftEnd_Mode, I2C_Generate_Start_Write);
   }
   else
   {
-    /* Update CR2 : set Slave Address , set read request, generate Start and set end mode */
-    I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, (uint32)(NumbOfSingle), I2C_AutoEnd_Mode, I2C_Generate_Start_Read);
-    
-    /* Reset local variable */
-    DataNum = 0;
-    
-    /* Wait until all data are received */
-    while (DataNum != NumbOfSingle)
-    {
-      /* Wait until RXNE flag is set */
-      EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT; 
-      while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_RXNE) == RESET)
-      {
-        if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-      }
-      
-      /* Read data from RXDR */
-      pBuffer[DataNum]= I2C_ReceiveData(EEPROM_CFG_I2C);
-      
-      /* Update number of received data */
-      DataNum++;
-    }    
-  }  
-  
-  /* Wait until STOPF flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_STOPF) == RESET)
+    mg_vStartPage();
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Write the next page of the request, up to the page boundary
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vStartPage(void)
+{
+  const MG_S_REQ *psReq = &mg_asReq[mg_u8ReqTail];
+  uint16 u16Page;
+
+  mg_sEng.u16Addr = psReq->u16Addr + mg_sEng.u16Cnt;
+  u16Page = EEPROM_CONF_PAGESIZE - (mg_sEng.u16Addr % EEPROM_CONF_PAGESIZE);
+  if (u16Page > (psReq->u16Len - mg_sEng.u16Cnt))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    u16Page = psReq->u16Len - mg_sEng.u16Cnt;
   }
-  
-  /* Clear STOPF flag */
-  I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_STOPCF);
-  
-  /* If all operations OK, return EEPROM_CONF_OK (0) */
-  return EEPROM_CONF_OK;
+  mg_sEng.u8AddrCnt = 0u;
+  mg_sEng.bNack = FALSE;
+  mg_sEng.eState = MG_E_STATE_WRITE;
+  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROM_CONF_HW_ADDRESS, (uint8)(EEPROM_CONF_ADDR_SIZE + u16Page), I2C_AutoEnd_Mode, I2C_Generate_Start_Write);
 }
 
 /** *****************************************************************************
- * @brief  Writes more than one byte to the EEPROM with a single WRITE cycle.
+ * \brief         Address only probe, the device answers once its write cycle is
+ *                done
  *
- * @note   The number of bytes (combined to write start address) must not 
- *         cross the EEPROM page boundary. This function can only write into
- *         the boundaries of an EEPROM page.
- *         This function doesn't check on boundaries condition (in this driver 
- *         the function EEPROM_WriteBuffer() which calls EEPROM_WritePage() is 
- *         responsible of checking on Page boundaries).
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
  *
- * \param[in]     pBuffer : pointer to the buffer containing the data to be written to 
- *                          the EEPROM.
- *                WriteAddr : EEPROM's internal address to write to.
- *                NumByteToWrite : pointer to the variable holding number of bytes to 
- *                                 be written into the EEPROM.
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vStartPoll(void)
+{
+  mg_sEng.bNack = FALSE;
+  mg_sEng.u8IdleTicks = 0u;
+  mg_sEng.eState = MG_E_STATE_POLL;
+  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROM_CONF_HW_ADDRESS, 0u, I2C_AutoEnd_Mode, I2C_Generate_Start_Write);
+}
+
+/** *****************************************************************************
+ * \brief         Program NBYTES with the next read chunk, reload while more than
+ *                255 bytes are left
+ *
+ * \param[in]     u32StartStop : I2C_Generate_Start_Read for the restart,
+ *                               I2C_No_StartStop for a reload
  * \param[in,out] -
  * \param[out]    -
  *
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \return        -
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WritePage(const uint8* pBuffer, uint16 WriteAddr, uint8 NumByteToWrite)
-{   
-  uint32 DataNum = 0;
-  
-#ifdef EEPROM_M24C08
-  
-  /* Configure slave address, nbytes, reload and generate start */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 1, I2C_Reload_Mode, I2C_Generate_Start_Write);
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;  
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+static void mg_vProgramRead(uint32 u32StartStop)
+{
+  uint8 u8Num;
+
+  if (mg_sEng.u16Left > MG_NBYTES_MAX)
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    u8Num = (uint8)MG_NBYTES_MAX;
   }
-  
-  /* Send memory address */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)WriteAddr);
-  
-#elif defined(EEPROM_M24M01) || defined(EEPROM_M24C64_32) || defined (EEPROM_M24LR64) || defined(EEPROM_M24C512)
-  
-  /* Configure slave address, nbytes, reload and generate start */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 2, I2C_Reload_Mode, I2C_Generate_Start_Write);
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+  else
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    u8Num = (uint8)mg_sEng.u16Left;
   }
-  
-  /* Send MSB of memory address */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)((WriteAddr & 0xFF00) >> 8));  
-  
-  /* Wait until TXIS flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+  mg_sEng.u16Left -= u8Num;
+  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROM_CONF_HW_ADDRESS, u8Num,
+                       (0u != mg_sEng.u16Left) ? I2C_Reload_Mode : I2C_AutoEnd_Mode, u32StartStop);
+}
+
+/** *****************************************************************************
+ * \brief         I2C events of the running transfer, from the interrupt or
+ *                polled by the blocking calls
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vHandleI2c(void)
+{
+  MG_S_REQ *psReq = &mg_asReq[mg_u8ReqTail];
+  uint32 u32Isr = EEPROM_CFG_I2C->ISR;
+
+  if (0u == (u32Isr & MG_I2C_EVENT_FLAGS))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    return;
   }
-  
-  /* Send LSB of memory address  */
-  I2C_SendData(EEPROM_CFG_I2C, (uint8)(WriteAddr & 0x00FF));
-  
-#endif /*!< EEPROM_M24C08 */
-  
-  /* Wait until TCR flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TCR) == RESET)
+  mg_sEng.u8IdleTicks = 0u;
+
+  if ((0u != (u32Isr & MG_I2C_ERR_FLAGS)) || (MG_E_STATE_IDLE == mg_sEng.eState) || (MG_E_STATE_WAIT == mg_sEng.eState))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
+    mg_vAbort(EEPROM_E_RESULT_BUS);
+    return;
   }
-  
-  /* Update CR2 : set Slave Address , set write request, generate Start and set end mode */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, (uint8)NumByteToWrite, I2C_AutoEnd_Mode, I2C_No_StartStop);
-  
-  while (DataNum != NumByteToWrite)
-  {      
-    /* Wait until TXIS flag is set */
-    EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-    while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_TXIS) == RESET)
+
+  if (0u != (u32Isr & I2C_ISR_NACKF))
+  {
+    /* The master sends STOP after a NACK, finish the request at STOPF */
+    I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_NACKCF);
+    mg_sEng.bNack = TRUE;
+  }
+
+  if (0u != (u32Isr & I2C_ISR_TXIS))
+  {
+    if (mg_sEng.u8AddrCnt < EEPROM_CONF_ADDR_SIZE)
+    {
+      mg_sEng.u8AddrCnt++;
+      I2C_SendData(EEPROM_CFG_I2C, (uint8)(mg_sEng.u16Addr >> ((EEPROM_CONF_ADDR_SIZE - mg_sEng.u8AddrCnt) * 8u)));
+    }
+    else
     {
-      if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-    }  
-    
-    /* Write data to TXDR */
-    I2C_SendData(EEPROM_CFG_I2C, (uint8)(pBuffer[DataNum]));
-    
-    /* Update number of transmitted data */
-    DataNum++;   
-  }  
-  
-  /* Wait until STOPF flag is set */
-  EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_STOPF) == RESET)
+      I2C_SendData(EEPROM_CFG_I2C, psReq->pu8Data[mg_sEng.u16Cnt]);
+      mg_sEng.u16Cnt++;
+    }
+  }
+
+  if (0u != (u32Isr & I2C_ISR_RXNE))
   {
-    if((EEPROMTimeout--) == 0) return mg_u32TimeoutUserCallback();
-  }   
-  
-  /* Clear STOPF flag */
-  I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_STOPCF);
-  
-  /* If all operations OK, return EEPROM_CONF_OK (0) */
-  return EEPROM_CONF_OK;
+    psReq->pu8Data[mg_sEng.u16Cnt] = I2C_ReceiveData(EEPROM_CFG_I2C);
+    mg_sEng.u16Cnt++;
+  }
+
+  if (0u != (u32Isr & I2C_ISR_TC))
+  {
+    /* Memory address sent: restart in read direction */
+    mg_sEng.eState = MG_E_STATE_READ;
+    mg_vProgramRead(I2C_Generate_Start_Read);
+  }
+  else if (0u != (u32Isr & I2C_ISR_TCR))
+  {
+    mg_vProgramRead(I2C_No_StartStop);
+  }
+
+  if (0u != (u32Isr & I2C_ISR_STOPF))
+  {
+    I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_STOPCF);
+    mg_vHandleStop();
+  }
 }
 
 /** *****************************************************************************
- * \brief         Writes buffer of data to the I2C EEPROM.
+ * \brief         Transfer ended with STOP: next page, next probe or done
  *
- * \param[in]     pBuffer : pointer to the buffer  containing the data to be written 
- *                          to the EEPROM.
- *                WriteAddr : EEPROM's internal address to write to.
- *                NumByteToWrite : number of bytes to write to the EEPROM.
+ * \param[in]     -
  * \param[in,out] -
  * \param[out]    -
  *
  * \return        -
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WriteBuffer(const uint8* pBuffer, uint16 WriteAddr, uint16 NumByteToWrite)
+static void mg_vHandleStop(void)
 {
-  uint16 NumOfPage = 0, NumOfSingle = 0, count = 0;
-  uint16 Addr = 0;
-  
-  Addr = WriteAddr % EEPROM_CONF_PAGESIZE;
-  count = EEPROM_CONF_PAGESIZE - Addr;
-  NumOfPage =  NumByteToWrite / EEPROM_CONF_PAGESIZE;
-  NumOfSingle = NumByteToWrite % EEPROM_CONF_PAGESIZE;
-  
-  /*!< If WriteAddr is EEPROM_CONF_PAGESIZE aligned  */
-  if(Addr == 0) 
+  const MG_S_REQ *psReq = &mg_asReq[mg_u8ReqTail];
+
+  switch (mg_sEng.eState)
   {
-    /*!< If NumByteToWrite < EEPROM_CONF_PAGESIZE */
-    if(NumOfPage == 0) 
+    case MG_E_STATE_READ:
     {
-      /* Store the number of data to be written */
-      EEPROMDataNum = NumOfSingle;
-      /* Start writing data */
-      if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-			{
-				return mg_u32TimeoutUserCallback();
-			}
-      if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-			{
-				return mg_u32TimeoutUserCallback();
-			}
+      mg_vDone(((FALSE == mg_sEng.bNack) && (mg_sEng.u16Cnt == psReq->u16Len)) ? EEPROM_E_RESULT_OK : EEPROM_E_RESULT_NACK);
+      break;
     }
-    /*!< If NumByteToWrite > EEPROM_CONF_PAGESIZE */
-    else  
+    case MG_E_STATE_WRITE:
     {
-      while(NumOfPage--)
+      if (FALSE != mg_sEng.bNack)
       {
-        /* Store the number of data to be written */
-        EEPROMDataNum = EEPROM_CONF_PAGESIZE;        
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum)) 
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        WriteAddr +=  EEPROM_CONF_PAGESIZE;
-        pBuffer += EEPROM_CONF_PAGESIZE;
+        mg_vDone(EEPROM_E_RESULT_NACK);
       }
-      
-      if(NumOfSingle!=0)
+      else
       {
-        /* Store the number of data to be written */
-        EEPROMDataNum = NumOfSingle;          
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}
+        /* Write cycle running, probe from the next EEPROM_vTask() */
+        mg_sEng.u8Trials = 0u;
+        mg_sEng.eState = MG_E_STATE_WAIT;
       }
+      break;
     }
-  }
-  /*!< If WriteAddr is not EEPROM_CONF_PAGESIZE aligned  */
-  else 
-  {
-    /*!< If NumByteToWrite < EEPROM_CONF_PAGESIZE */
-    if(NumOfPage== 0) 
-    {
-      /*!< If the number of data to be written is more than the remaining space 
-      in the current page: */
-      if (NumByteToWrite > count)
-      {
-        /* Store the number of data to be written */
-        EEPROMDataNum = count;        
-        /*!< Write the data contained in same page */
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}					
-        
-        /* Store the number of data to be written */
-        EEPROMDataNum = (NumByteToWrite - count);          
-        /*!< Write the remaining data in the following page */
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage((uint8*)(pBuffer + count), (WriteAddr + count), (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}					
-      }      
-      else      
-      {
-        /* Store the number of data to be written */
-        EEPROMDataNum = NumOfSingle;         
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}					
-      }     
-    }
-    /*!< If NumByteToWrite > EEPROM_CONF_PAGESIZE */
-    else
+    case MG_E_STATE_POLL:
     {
-      NumByteToWrite -= count;
-      NumOfPage =  NumByteToWrite / EEPROM_CONF_PAGESIZE;
-      NumOfSingle = NumByteToWrite % EEPROM_CONF_PAGESIZE;
-      
-      if(count != 0)
-      {  
-        /* Store the number of data to be written */
-        EEPROMDataNum = count;         
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        WriteAddr += count;
-        pBuffer += count;
-      } 
-      
-      while(NumOfPage--)
+      if (FALSE == mg_sEng.bNack)
       {
-        /* Store the number of data to be written */
-        EEPROMDataNum = EEPROM_CONF_PAGESIZE;          
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        EEPROMTimeout = EEPROM_CONF_LONG_TIMEOUT;
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        WriteAddr +=  EEPROM_CONF_PAGESIZE;
-        pBuffer += EEPROM_CONF_PAGESIZE;  
+        if (mg_sEng.u16Cnt < psReq->u16Len)
+        {
+          mg_vStartPage();
+        }
+        else
+        {
+          mg_vDone(EEPROM_E_RESULT_OK);
+        }
       }
-      if(NumOfSingle != 0)
+      else
       {
-        /* Store the number of data to be written */
-        EEPROMDataNum = NumOfSingle;           
-        if(EEPROM_CONF_OK != EEPROM_u32WritePage(pBuffer, WriteAddr, (uint8)EEPROMDataNum))
-				{
-					return mg_u32TimeoutUserCallback();
-				}
-        if(EEPROM_CONF_OK != EEPROM_u32WaitEepromStandbyState())
-				{
-					return mg_u32TimeoutUserCallback();
-				}
+        mg_sEng.u8Trials++;
+        if (mg_sEng.u8Trials < EEPROM_CONF_POLL_TRIALS)
+        {
+          mg_sEng.eState = MG_E_STATE_WAIT;
+        }
+        else
+        {
+          mg_vDone(EEPROM_E_RESULT_NACK);
+        }
       }
+      break;
+    }
+    default:
+    {
+      /* NACK of the memory address */
+      mg_vDone(EEPROM_E_RESULT_NACK);
+      break;
     }
-  } 
-  
-  /* If all operations OK, return EEPROM_CONF_OK (0) */
-  return EEPROM_CONF_OK;	
+  }
 }
 
 /** *****************************************************************************
- * \brief         Wait for EEPROM Standby state.
- * 
- * @note  This function allows to wait and check that EEPROM has finished the 
- *        last operation. It is mostly used after Write operation: after receiving
- *        the buffer to be written, the EEPROM may need additional time to actually
- *        perform the write operation. During this time, it doesn't answer to
- *        I2C packets addressed to it. Once the write operation is complete
- *        the EEPROM responds to its address.
+ * \brief         Remove the running request, report it and start the next one
  *
- * \param[in]     -
+ * \param[in]     eResult : result for the completion callback
  * \param[in,out] -
  * \param[out]    -
  *
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \return        -
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WaitEepromStandbyState(void)      
+static void mg_vDone(EEPROM_E_RESULT eResult)
 {
-  __IO uint32 EEPROMTrials = 0;
-  
-  /* Keep looping till the slave acknowledge his address or maximum number 
-  of trials is reached (this number is defined by EEPROM_MAX_TRIALS_NUMBER define
-  in stm32303c_eval_i2c_ee.h file) */
-  
-  /* Configure CR2 register : set Slave Address and end mode */
-  I2C_TransferHandling(EEPROM_CFG_I2C, EEPROMAddress, 0, I2C_AutoEnd_Mode, I2C_No_StartStop);  
-  
-  do
-  { 
-    /* Initialize EEPROMTimeout */
-    EEPROMTimeout = EEPROM_CONF_FLAG_TIMEOUT;
-    
-    /* Clear NACKF */
-    I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_NACKCF | I2C_ICR_STOPCF);
-    
-    /* Generate start */
-    I2C_GenerateSTART(EEPROM_CFG_I2C, ENABLE);
-    
-    /* Wait until timeout elapsed */
-    while (EEPROMTimeout-- != 0)
-		{
-		}			
-    
-    /* Check if the maximum allowed numbe of trials has bee reached */
-    if (EEPROMTrials++ == EEPROM_MAX_TRIALS_NUMBER)
-    {
-      /* If the maximum number of trials has been reached, exit the function */
-      return mg_u32TimeoutUserCallback();
-    }
+  EEPROM_pfvDone pfvDone = mg_asReq[mg_u8ReqTail].pfvDone;
+
+  /* A NACK leaves the unsent byte in TXDR */
+  EEPROM_CFG_I2C->ISR = I2C_ISR_TXE;
+
+  mg_u8ReqTail = (uint8)((mg_u8ReqTail + 1u) & EEPROM_CONF_REQ_MASK);
+  mg_sEng.eState = MG_E_STATE_IDLE;
+  if (NULL != pfvDone)
+  {
+    pfvDone(eResult);
+  }
+
+  if (mg_u8ReqHead != mg_u8ReqTail)
+  {
+    mg_vStartReq();
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Reset the I2C to release the bus and fail the running request
+ *
+ * \param[in]     eResult : result for the completion callback
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vAbort(EEPROM_E_RESULT eResult)
+{
+  /* PE low clears the flags and the transfer, the configuration stays */
+  I2C_SoftwareResetCmd(EEPROM_CFG_I2C);
+
+  if ((MG_E_STATE_IDLE != mg_sEng.eState) && (mg_u8ReqHead != mg_u8ReqTail))
+  {
+    mg_vDone(eResult);
   }
-  while(I2C_GetFlagStatus(EEPROM_CFG_I2C, I2C_ISR_NACKF) != RESET);
-  
-  /* Clear STOPF */
-  I2C_ClearFlag(EEPROM_CFG_I2C, I2C_ICR_STOPCF);
-  
-  /* Return EEPROM_CONF_OK if device is ready */
-  return EEPROM_CONF_OK;
 }
 
-/**
-  * @brief  Basic management of the timeout situation.
-  * @param  None.
-  * @retval None.
-  */
-static uint32 mg_u32TimeoutUserCallback(void)
+/** *****************************************************************************
+ * \brief         Completion callback of the blocking calls
+ *
+ * \param[in]     eResult : request result
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vSyncDone(EEPROM_E_RESULT eResult)
 {
- return EEPROM_CONF_FAIL;
+  mg_u8SyncResult = (uint8)eResult;
 }
 
-/**
-  * @}
-  */
-  
-/**
-  * @}
-  */
+/** *****************************************************************************
+ * \brief         Run the queue by polling until the request of a blocking call
+ *                is done. The I2C interrupt is held off meanwhile.
+ *
+ * \param[in]     u8Queued : TRUE if the request was queued
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        EEPROM_CONF_OK or EEPROM_CONF_FAIL
+ *
+ ***************************************************************************** */
+static uint32 mg_u32WaitSync(uint8 u8Queued)
+{
+  uint16 u16Tick;
+  uint32 u32Loop;
 
-/**
-  * @}
-  */
+  if (FALSE == u8Queued)
+  {
+    return EEPROM_CONF_FAIL;
+  }
 
-/**
-  * @}
-  */
+  EEPROM_SCFG_vDisableIsr();
+  for (u16Tick = 0u; (u16Tick < EEPROM_CONF_SYNC_TICKS) && (MG_SYNC_PENDING == mg_u8SyncResult); u16Tick++)
+  {
+    EEPROM_vTask();
+    for (u32Loop = 0u; (u32Loop < EEPROM_CONF_FLAG_TIMEOUT) && (MG_SYNC_PENDING == mg_u8SyncResult); u32Loop++)
+    {
+      mg_vHandleI2c();
+    }
+  }
 
-/**
-  * @}
-  */  
+  /* Fail what is left, the caller's buffer goes out of scope */
+  while (MG_SYNC_PENDING == mg_u8SyncResult)
+  {
+    if (MG_E_STATE_IDLE == mg_sEng.eState)
+    {
+      mg_vStartReq();
+    }
+    mg_vAbort(EEPROM_E_RESULT_BUS);
+  }
+  EEPROM_SCFG_vEnableIsr();
 
-/************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
+  return (EEPROM_E_RESULT_OK == mg_u8SyncResult) ? EEPROM_CONF_OK : EEPROM_CONF_FAIL;
+}
 
+/*
+ * End of file
+ */
@@ -25,84 +25,115 @@
  * Included header
  ******************************************************************************/
 
+#include <stddef.h>
 #include "global.h"
 
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef enum EEPROM_E_RESULT_
+{
+  EEPROM_E_RESULT_OK = 0,         /* Done, a write also finished its write cycle */
+  EEPROM_E_RESULT_NACK,           /* Device did not answer or stayed busy after a page write */
+  EEPROM_E_RESULT_BUS             /* Bus error or stuck transfer, the I2C was reset */
+} EEPROM_E_RESULT;
+
+/* Completion callback, runs in the I2C interrupt: keep it short, no new requests */
+typedef void (*EEPROM_pfvDone)(EEPROM_E_RESULT eResult);
+
 /*******************************************************************************
  * Global function prototypes (public to other modules)
  ******************************************************************************/
 /** *****************************************************************************
- * \brief         Reads a block of data from the EEPROM.
+ * \brief         Queue a read of the EEPROM
  *
- * \param[in]     ReadAddr : EEPROM's internal address to start reading from.
- *                NumByteToRead : pointer to the variable holding number of bytes to 
- *                                be read from the EEPROM.
+ * \param[in]     u16Addr : EEPROM's internal address to start reading from
+ *                u16Len : number of bytes to read
+ *                pfvDone : completion callback, NULL for none
  * \param[in,out] -
- * \param[out]    pBuffer : pointer to the buffer that receives the data read from 
- *                          the EEPROM.
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \param[out]    pu8Buffer : receives the data, must stay valid until pfvDone
+ *
+ * \return        TRUE if queued, FALSE if the queue is full
  *
  ***************************************************************************** */
-uint32 EEPROM_u32ReadBuffer(uint8* pBuffer, uint16 ReadAddr, uint16 NumByteToRead);
+uint8 EEPROM_u8QueueRead(uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone);
 
 /** *****************************************************************************
- * @brief  Writes more than one byte to the EEPROM with a single WRITE cycle.
- *
- * @note   The number of bytes (combined to write start address) must not 
- *         cross the EEPROM page boundary. This function can only write into
- *         the boundaries of an EEPROM page.
- *         This function doesn't check on boundaries condition (in this driver 
- *         the function EEPROM_WriteBuffer() which calls EEPROM_WritePage() is 
- *         responsible of checking on Page boundaries).
+ * \brief         Queue a write to the EEPROM. The engine splits it into page
+ *                writes and ACK polls the device after each page.
  *
- * \param[in]     pBuffer : pointer to the buffer containing the data to be written to 
- *                          the EEPROM.
- *                WriteAddr : EEPROM's internal address to write to.
- *                NumByteToWrite : pointer to the variable holding number of bytes to 
- *                                 be written into the EEPROM.
+ * \param[in]     pu8Buffer : data to write. Up to EEPROM_CONF_REQ_COPY_SIZE bytes
+ *                            are copied, a longer buffer must stay valid until
+ *                            pfvDone
+ *                u16Addr : EEPROM's internal address to write to
+ *                u16Len : number of bytes to write
+ *                pfvDone : completion callback, NULL for none
  * \param[in,out] -
  * \param[out]    -
  *
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \return        TRUE if queued, FALSE if the queue is full
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WritePage(const uint8* pBuffer, uint16 WriteAddr, uint8 NumByteToWrite);
+uint8 EEPROM_u8QueueWrite(const uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone);
 
 /** *****************************************************************************
- * \brief         Writes buffer of data to the I2C EEPROM.
+ * \brief         Number of requests that can be queued
  *
- * \param[in]     pBuffer : pointer to the buffer  containing the data to be written 
- *                          to the EEPROM.
- *                WriteAddr : EEPROM's internal address to write to.
- *                NumByteToWrite : number of bytes to write to the EEPROM.
+ * \param[in]     -
  * \param[in,out] -
  * \param[out]    -
  *
- * \return        -
+ * \return        Free queue entries
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WriteBuffer(const uint8* pBuffer, uint16 WriteAddr, uint16 NumByteToWrite);
+uint8 EEPROM_u8GetFreeReq(void);
 
 /** *****************************************************************************
- * \brief         Wait for EEPROM Standby state.
- * 
- * @note  This function allows to wait and check that EEPROM has finished the 
- *        last operation. It is mostly used after Write operation: after receiving
- *        the buffer to be written, the EEPROM may need additional time to actually
- *        perform the write operation. During this time, it doesn't answer to
- *        I2C packets addressed to it. Once the write operation is complete
- *        the EEPROM responds to its address.
+ * \brief         Check the request queue is empty and no transfer or write
+ *                cycle is running
  *
  * \param[in]     -
  * \param[in,out] -
  * \param[out]    -
  *
- * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else return value 
- *                different from EEPROM_CONF_OK (0) or the timeout user callback.
+ * \return        TRUE if idle
+ *
+ ***************************************************************************** */
+uint8 EEPROM_u8IsIdle(void);
+
+/** *****************************************************************************
+ * \brief         Reads a block of data from the EEPROM and waits for it.
+ *                Runs the queue by polling, for the init before the interrupts
+ *                are enabled.
+ *
+ * \param[in]     ReadAddr : EEPROM's internal address to start reading from.
+ *                NumByteToRead : number of bytes to be read from the EEPROM.
+ * \param[in,out] -
+ * \param[out]    pBuffer : pointer to the buffer that receives the data read from 
+ *                          the EEPROM.
+ * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else
+ *                EEPROM_CONF_FAIL.
+ *
+ ***************************************************************************** */
+uint32 EEPROM_u32ReadBuffer(uint8* pBuffer, uint16 ReadAddr, uint16 NumByteToRead);
+
+/** *****************************************************************************
+ * \brief         Writes buffer of data to the I2C EEPROM and waits for the last
+ *                write cycle. Runs the queue by polling, for the init only.
+ *
+ * \param[in]     pBuffer : pointer to the buffer  containing the data to be written 
+ *                          to the EEPROM.
+ *                WriteAddr : EEPROM's internal address to write to.
+ *                NumByteToWrite : number of bytes to write to the EEPROM.
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        EEPROM_CONF_OK (0) if operation is correctly performed, else
+ *                EEPROM_CONF_FAIL.
  *
  ***************************************************************************** */
-uint32 EEPROM_u32WaitEepromStandbyState(void);
+uint32 EEPROM_u32WriteBuffer(const uint8* pBuffer, uint16 WriteAddr, uint16 NumByteToWrite);
 
 #ifdef __cplusplus
   }
@@ -35,6 +35,7 @@
  * Module interface
  ******************************************************************************/
 #define EEPROM_CFG_I2C           I2C2  
+#define EEPROM_CFG_vI2cIsr       I2C2_IRQHandler   /* Request engine, I2C_IT_* enabled in i2c_cfg.h */
 		
 
 #ifdef __cplusplus
@@ -95,8 +95,26 @@
 #define EEPROM_CONF_FLAG_TIMEOUT         ((uint32)0x1000)
 #define EEPROM_CONF_LONG_TIMEOUT         ((uint32)(10 * EEPROM_CONF_FLAG_TIMEOUT))
 
-/* Maximum number of trials for EEPROM_WaitEepromStandbyState() function */
-#define EEPROM_MAX_TRIALS_NUMBER          300u
+#if defined (EEPROM_M24C08)
+ #define EEPROM_CONF_ADDR_SIZE          1u      /* Memory address bytes */
+#else
+ #define EEPROM_CONF_ADDR_SIZE          2u
+#endif
+
+/* Request queue, power of 2; one entry stays free to tell full from empty */
+#define EEPROM_CONF_REQ_NUM               8u
+#define EEPROM_CONF_REQ_MASK              (EEPROM_CONF_REQ_NUM - 1u)
+/* Writes up to this size are copied into the request, longer buffers must stay
+   valid until the completion callback */
+#define EEPROM_CONF_REQ_COPY_SIZE         8u
+
+/* ACK polling after a page write: one address probe per EEPROM_vTask() (1ms),
+   the write cycle of the M24C512 takes 5ms max */
+#define EEPROM_CONF_POLL_TRIALS           10u
+/* EEPROM_vTask() periods without an I2C event before a transfer is aborted */
+#define EEPROM_CONF_XFER_TICKS            3u
+/* Polling periods of EEPROM_CONF_FLAG_TIMEOUT loops a blocking call waits */
+#define EEPROM_CONF_SYNC_TICKS            100u
       
 #define EEPROM_CONF_OK                    0u
 #define EEPROM_CONF_FAIL                  1u   
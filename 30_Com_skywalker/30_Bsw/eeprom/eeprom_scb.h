@@ -54,6 +54,19 @@ void EEPROM_vDeInit(void);
  ***************************************************************************** */
 void EEPROM_vInit(void);
 
+/** *****************************************************************************
+ * \brief         Starts the queued requests, ACK polls the device after page
+ *                writes and aborts stuck transfers. Called every 1ms.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void EEPROM_vTask(void);
+
 #ifdef __cplusplus
   }
 #endif
@@ -113,6 +113,17 @@ SINLINE uint8 EEPROM_SCFG_u8ReceiveData(void)
 	return I2C_ReceiveData(I2C2);
 }
 
+SINLINE void EEPROM_SCFG_vDisableIsr(void)
+{
+	NVIC_DisableIRQ(I2C2_IRQn);
+}
+
+SINLINE void EEPROM_SCFG_vEnableIsr(void)
+{
+	NVIC_ClearPendingIRQ(I2C2_IRQn);
+	NVIC_EnableIRQ(I2C2_IRQn);
+}
+
 
 #ifdef __cplusplus
   }
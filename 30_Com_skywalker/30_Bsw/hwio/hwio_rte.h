@@ -55,7 +55,7 @@
 #define RTE_Read_B_R_VIN_OK                  (RTE_B_DIO_VIN_OK_ACTIVE)
 #define RTE_Read_B_R_OUTPUT_OK               (RTE_B_COM_OUTPUT_OK)
 #define RTE_Read_B_R_COM_VIN_OK              (RTE_B_COM_VIN_OK)
-#define RTE_Read_B_R_SMBALLERT_ST            (RTE_B_COM_SMBALLERT_ST)
+#define RTE_Read_B_R_SMBALLERT_ST            ((RTE_B_COM_SMBALLERT_ST) && (FALSE == RTE_u8SmbAlertAra))
 #define RTE_Read_B_R_V1_ON                   (RTE_B_COM_V1_ON)
 #define RTE_Read_B_R_VSB_OVP_TEST            (RTE_B_PSUCTRL_VSB_OVP_TEST)
  
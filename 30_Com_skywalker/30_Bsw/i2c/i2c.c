@@ -231,6 +231,19 @@ static void mg_vI2cReset(uint8 u8I2cIndex)
 	/*Enable I2C1 clock*/
 	I2C_CFG_I2C_SETUP[u8I2cIndex].PeriphClockCmd(I2C_CFG_I2C_SETUP[u8I2cIndex].u32Perip, ENABLE); 
 
+	/* Kernel clock of I2C1, the timing is set up for it */
+	if (I2C1 == I2C_CFG_I2C_SETUP[u8I2cIndex].I2Cx)
+	{
+		RCC_I2C1CLKConfig(MG_I2C1_KERNEL_CLK);
+	}
+
+	/* 20mA sink of the Fast-mode Plus pins */
+	if (0u != I2C_CFG_I2C_SETUP[u8I2cIndex].u32FastModePlus)
+	{
+		RCC_APB2PeriphClockCmd(RCC_APB2Periph_SYSCFG, ENABLE);
+		SYSCFG_I2CFastModePlusConfig(I2C_CFG_I2C_SETUP[u8I2cIndex].u32FastModePlus, ENABLE);
+	}
+
 	I2C_StretchClockCmd(I2C_CFG_I2C_SETUP[u8I2cIndex].I2Cx,ENABLE);
 	/*Config I2C_initStructure*/
 	I2C_InitStructure.I2C_Timing = I2C_CFG_I2C_SETUP[u8I2cIndex].u32Timing;
@@ -30,6 +30,7 @@
  ******************************************************************************/
 
 #include "global.h"
+#include "rte.h"
 
 /*******************************************************************************
  * Module interface
@@ -47,6 +48,23 @@
 #define MG_I2C1_RX_ISR_SUB_PRIO       0u
 #define MG_I2C2_RX_ISR_SUB_PRIO       1u
 
+/*
+ * Fast-mode Plus needs an I2C kernel clock above ~17 MHz (4 kernel clocks plus
+ * the filters within the 500ns tLOW), so I2C1 runs from SYSCLK 48 MHz with
+ * the RM0091 48 MHz Fast-mode Plus timing (PRESC 5, SCLDEL 1, SDADEL 0, SCLL 3,
+ * SCLH 1). Only SDADEL/SCLDEL act in slave mode: 250ns data setup stretch.
+ * Up to 400 kHz I2C1 stays on HSI 8 MHz with a 2.25us data setup stretch.
+ */
+#if RTE_I2C_PMBUS_FM_PLUS
+#define MG_I2C1_KERNEL_CLK            RCC_I2C1CLK_SYSCLK
+#define MG_I2C1_TIMING                0x50100103u
+#define MG_I2C1_FAST_MODE_PLUS        (SYSCFG_I2CFastModePlus_PB8 | SYSCFG_I2CFastModePlus_PB9)
+#else
+#define MG_I2C1_KERNEL_CLK            RCC_I2C1CLK_HSI
+#define MG_I2C1_TIMING                0x10800000u
+#define MG_I2C1_FAST_MODE_PLUS        0u
+#endif
+
 /* The structure defining the setup of each timer PWM output */
 typedef struct
 {
@@ -84,6 +102,9 @@ typedef struct
 	/* Specifies the I2C_TIMINGR_register value. */
   uint32 u32Timing; 
 
+  /* Fast-mode Plus drive of the pins (SYSCFG_I2CFastModePlus_x values, 0 = none) */
+  uint32 u32FastModePlus;
+
 	/* Enables or disables analog noise filter. */
   uint32 u32AnalogFilter;          
 
@@ -135,7 +156,8 @@ static const tPwmSetup I2C_CFG_I2C_SETUP[] =
  .u32Perip               = RCC_APB1Periph_I2C1,
  .PeriphClockCmd         = RCC_APB1PeriphClockCmd,
  .I2Cx                   = I2C1,
- .u32Timing              = 0x10800000u,
+ .u32Timing              = MG_I2C1_TIMING,
+ .u32FastModePlus        = MG_I2C1_FAST_MODE_PLUS,
  .u32AnalogFilter        = I2C_AnalogFilter_Enable,
  .u32DigitalFilter       = 0x00u,
  .u32Mode                = I2C_Mode_I2C,
@@ -161,6 +183,7 @@ static const tPwmSetup I2C_CFG_I2C_SETUP[] =
  .PeriphClockCmd         = RCC_APB1PeriphClockCmd,
  .I2Cx                   = I2C2,
  .u32Timing              = 0x30E3323Du,
+ .u32FastModePlus        = 0u,
  .u32AnalogFilter        = I2C_AnalogFilter_Enable,
  .u32DigitalFilter       = 0x00u,
  .u32Mode                = I2C_Mode_I2C,
@@ -168,8 +191,8 @@ static const tPwmSetup I2C_CFG_I2C_SETUP[] =
  .u32Ack                 = I2C_Ack_Enable,
  .u32AcknowledgedAddress = I2C_AcknowledgedAddress_7bit,
  .u32IsTimeOutCheck      = FALSE,
- .eITNewState            = DISABLE,
- .u32IT                  = I2C_IT_TCI | I2C_IT_TXI | I2C_IT_RXI,
+ .eITNewState            = ENABLE,
+ .u32IT                  = I2C_IT_TCI | I2C_IT_TXI | I2C_IT_RXI | I2C_IT_STOPI | I2C_IT_NACKI | I2C_IT_ERRI,
  .u8NvicIRQChannel       = I2C2_IRQn,
  .u8NvicIRQChannelPrio   = MG_I2C2_RX_ISR_SUB_PRIO
 },
@@ -40,10 +40,53 @@ volatile static uint8 mg_u8I2cRxLen;
  * Local constants and macros (private to module)
  ******************************************************************************/
 
+#define MG_U8_INC_SAT(x)           ((x) = ((x) < 0xFFu) ? ((x) + 1u) : (x))
+#define MG_U16_INC_SAT(x)          ((x) = ((x) < 0xFFFFu) ? ((x) + 1u) : (x))
+
+/* Entry of the commands without an own one */
+#define MG_CMD_STATS_OTHER_IDX     I2CPRT_CONF_CMD_STATS_NUM
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
 
+#if I2CPRT_CONF_LAT_MEASURE
+/* Latency from the last data byte to the frame handled, 0.1us */
+typedef struct
+{
+  uint16 u16Min;
+  uint16 u16Max;
+  uint16 u16Avg;
+  uint16 u16Deferred;
+  uint16 u16Polled;
+} MG_S_LATENCY;
+#endif
+
+#if I2CPRT_CONF_ISR_MEASURE
+/* Run time of the I2C interrupt, time stamp counts */
+typedef struct
+{
+  uint32 u32Max;
+  uint32 u32ByteMax;
+  uint16 u16ByteOver;
+} MG_S_ISR_TIME;
+#endif
+
+#if I2CPRT_CONF_CMD_STATS
+/* Traffic of one command code */
+typedef struct
+{
+  uint8  u8Cmd;
+  uint8  u8PecErr;          /* Write frames with wrong PEC */
+  uint8  u8Nack;            /* Reads NACKed before the whole response */
+  uint8  u8Ovr;             /* Receive overruns */
+  uint16 u16Rd;             /* Read frames */
+  uint16 u16Wr;             /* Write frames */
+  uint16 u16TimeMax;        /* Frame time ADDR to STOP, us */
+  uint16 u16TimeAvg;
+} MG_S_CMD_STATS;
+#endif
+
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
@@ -53,12 +96,45 @@ static GLOBAL_U_U8BIT  mg_u8I2cAddrWrOld;
 static GLOBAL_U_U8BIT  mg_u8I2cAddrRd; 
 
 static uint8 mg_u8I2cState;
+static uint8 mg_u8InDeferredIsr;
+#if I2CPRT_CONF_SMBALERT_ARA
+static uint8 mg_u8AraLost;              /* Arbitration of the alert response lost */
+#endif
+
+#if I2CPRT_CONF_LAT_MEASURE
+static volatile uint32 mg_u32RxStamp;
+static MG_S_LATENCY mg_sLatency;
+#endif
+
+#if I2CPRT_CONF_ISR_MEASURE
+static MG_S_ISR_TIME mg_sIsrTime;
+#endif
+
+#if I2CPRT_CONF_CMD_STATS
+static MG_S_CMD_STATS mg_asCmdStats[I2CPRT_CONF_CMD_STATS_NUM + 1u];
+static uint8 mg_u8CmdStatsNum;          /* Own entries in use */
+static uint8 mg_u8CmdStatsIdx;          /* Entry of the current frame */
+static uint8 mg_u8FrameOpen;            /* ADDR seen, STOP not yet */
+static uint8 mg_u8FrameRead;
+static uint8 mg_u8FrameCmd;             /* Command byte received */
+static uint32 mg_u32FrameStamp;
+#endif
 
 /*******************************************************************************
  * Local function prototypes (private to module)
  ******************************************************************************/
  
 static void mg_vSetI2cAddress( uint8 u8Addr );
+#if I2CPRT_CONF_LAT_MEASURE
+static void mg_vUpdateLatency( void );
+#endif
+#if I2CPRT_CONF_ISR_MEASURE
+static void mg_vUpdateIsrTime( uint32 u32Isr, uint32 u32Start );
+#endif
+#if I2CPRT_CONF_CMD_STATS
+static uint8 mg_u8CmdStatsFind( uint8 u8Cmd );
+static void mg_vCmdStatsFrameEnd( void );
+#endif
 
 /*******************************************************************************
  * Global data (public to other modules)
@@ -102,6 +178,18 @@ void I2CPRT_vInit(void)
 	mg_u8I2cTxCnt             = 0x00;
   mg_u8I2cAddrWr.ALL        = I2CPRT_CFG_BASE_SLA_ADR;
   mg_u8I2cAddrRd.ALL        = mg_u8I2cAddrWr.ALL + 0x01u;
+
+#if I2CPRT_CONF_CMD_STATS
+  I2CPRT_vClearCmdStats();
+#endif
+
+#if I2CPRT_CONF_SMBALERT_ARA
+  I2CPRT_SCFG_vSetOAR2(I2CPRT_CFG_ARA_ADR);
+#endif
+
+#if I2CPRT_CONF_DEFERRED_HANDLE
+  I2CPRT_SCFG_vInitDeferredIsr();
+#endif
 } /* I2C_vI2cDataInit() */
 
 /********************************************************************************
@@ -185,7 +273,11 @@ void I2CPRT_CFG_vI2cIsr( void )
 	uint8 u8I2cPEC;
   
   uint32 u32Isr;
-  
+#if I2CPRT_CONF_ISR_MEASURE
+  uint32 u32Start;
+
+  u32Start = I2CPRT_SCFG_u32GetTimeStamp();
+#endif
   
 	u32Isr = I2C1->ISR;
   
@@ -194,10 +286,19 @@ void I2CPRT_CFG_vI2cIsr( void )
 	if(u32Isr & I2C_IT_OVR) //(I2CPRT_SCFG_eGetRxOVRFlg())          /* Overrun error detect */
 	{
 		I2CPRT_SCFG_vClearRxOVRFlg();        /* clear interrupt flag */
+#if I2CPRT_CONF_CMD_STATS
+    MG_U8_INC_SAT(mg_asCmdStats[mg_u8CmdStatsIdx].u8Ovr);
+#endif
 	}
 	else if(u32Isr & I2C_IT_ARLO) // (I2CPRT_SCFG_eGetRxARLOFlg())          /* Arbitration lost interrupt */
 	{
 		I2CPRT_SCFG_vClearRxARLOFlg();        /* clear interrupt flag */
+#if I2CPRT_CONF_SMBALERT_ARA
+    if (mg_u8I2cState == I2CPRT_CFG_E_I2C_ARA)
+    {
+      mg_u8AraLost = TRUE;                  /* A lower address answered, keep SMBALERT# */
+    }
+#endif
 	}
 	else if(u32Isr & I2C_IT_BERR) // (I2CPRT_SCFG_eGetRxBERRFlg())          /* Bus error interrupt */
 	{
@@ -206,6 +307,17 @@ void I2CPRT_CFG_vI2cIsr( void )
 	else if(u32Isr & I2C_IT_NACKF) //  (I2CPRT_SCFG_eGetNACKFlg())          /* Bus error interrupt */
 	{
 		I2CPRT_SCFG_vClearNACKFlg();        /* clear interrupt flag */
+#if I2CPRT_CONF_CMD_STATS
+    /*
+     * The host NACKs the last byte it reads, the byte after it is already
+     * in TXDR: early if the last response byte has not been written yet
+     */
+    I2CPRT_Rte_Read_R_u8I2cTxLen(&u8I2cTxLen);
+    if (mg_u8I2cTxCnt < (u8I2cTxLen + ((I2CPRT_RTE_Read_B_R_PEC_Enable()) ? 1u : 0u)))
+    {
+      MG_U8_INC_SAT(mg_asCmdStats[mg_u8CmdStatsIdx].u8Nack);
+    }
+#endif
 	}
   else
   {
@@ -222,18 +334,50 @@ void I2CPRT_CFG_vI2cIsr( void )
     if(u32Isr & I2C_IT_ADDR) // (I2CPRT_SCFG_eGetRxADDRFlg())
     {
       I2CPRT_SCFG_vClearRxADDRFlg();
+#if I2CPRT_CONF_CMD_STATS
+      if (mg_u8I2cState == I2CPRT_CFG_E_I2C_IDLE)
+      {
+        /* First address of the frame, a repeated start keeps the stamp */
+        mg_u32FrameStamp = I2CPRT_SCFG_u32GetTimeStamp();
+        mg_u8FrameOpen = TRUE;
+        mg_u8FrameRead = FALSE;
+        mg_u8FrameCmd = FALSE;
+      }
+#endif
       if(I2CPRT_SCFG_u16TransferDirection())
       {
         /* Last received byte is slave address */
         I2CPRT_Rte_Write_P_u8I2cTxLen(0x00);
+        I2CPRT_Rte_Write_P_pu8TxData(I2CPRT_CFG_au8I2cTxBuf);  /* PMBus may select a read image instead */
+        I2CPRT_RTE_Write_B_P_TX_PEC_RDY(FALSE);                /* and its precomputed PEC */
         mg_u8I2cTxCnt = 0;
 
-        if(I2CPRT_RTE_Read_B_R_PEC_Enable())
+#if I2CPRT_CONF_SMBALERT_ARA
+        if (I2CPRT_CFG_ARA_ADR == I2CPRT_SCFG_u8GetAddrCode(u32Isr))
+        {
+          /* Alert response: own address, the lowest one wins the arbitration */
+          I2CPRT_Rte_Write_P_u8TxBuf(mg_u8I2cAddrWr.ALL, 0u);
+          I2CPRT_Rte_Write_P_u8I2cTxLen(1u);
+          I2CPRT_Rte_Write_P_u8I2cPEC(I2CPRT_SCFG_u8GetCrc8(0x00, I2CPRT_CFG_ARA_ADR | 0x01u));
+          mg_u8AraLost = FALSE;
+          mg_u8I2cState = I2CPRT_CFG_E_I2C_ARA;
+#if I2CPRT_CONF_CMD_STATS
+          mg_u8FrameOpen = FALSE;             /* Not a PMBus command */
+#endif
+        }
+        else
+#endif
         {
-          I2CPRT_Rte_Write_P_u8I2cPEC(I2CPRT_SCFG_u8GetCrc8(RTE_u8I2cPEC, mg_u8I2cAddrRd.ALL));
+          if(I2CPRT_RTE_Read_B_R_PEC_Enable())
+          {
+            I2CPRT_Rte_Write_P_u8I2cPEC(I2CPRT_SCFG_u8GetCrc8(RTE_u8I2cPEC, mg_u8I2cAddrRd.ALL));
+          }
+          I2CPRT_SCFG_vPMBusSendData();
+          mg_u8I2cState = I2CPRT_CFG_E_I2C_READ;
+#if I2CPRT_CONF_CMD_STATS
+          mg_u8FrameRead = TRUE;
+#endif
         }
-        I2CPRT_SCFG_vPMBusSendData();
-        mg_u8I2cState = I2CPRT_CFG_E_I2C_READ;
       }
       else
       {
@@ -277,9 +421,19 @@ void I2CPRT_CFG_vI2cIsr( void )
       }
 
       I2CPRT_Rte_Read_R_u8I2cRxCnt(&u8I2cRxCnt);
+#if I2CPRT_CONF_LAT_MEASURE
+      mg_u32RxStamp = I2CPRT_SCFG_u32GetTimeStamp();
+#endif
       /* Last received byte is data */
       if (mg_u8I2cState == I2CPRT_CFG_E_I2C_WRITE)
       {
+#if I2CPRT_CONF_CMD_STATS
+        if (0U == u8I2cRxCnt)
+        {
+          mg_u8CmdStatsIdx = mg_u8CmdStatsFind(u8Data);
+          mg_u8FrameCmd = TRUE;
+        }
+#endif
         if (u8I2cRxCnt < I2C_RX_BUF_SIZE)
         {
           I2CPRT_CFG_au8I2cRxBuf[u8I2cRxCnt] = u8Data;
@@ -306,17 +460,21 @@ void I2CPRT_CFG_vI2cIsr( void )
       {
         if (mg_u8I2cTxCnt == u8I2cTxLen) 
         {
+          /* Sent directly, the transmit data may be a read image */
           if(I2CPRT_RTE_Read_B_R_PEC_Enable())
           {
             I2CPRT_Rte_Read_R_u8I2cPEC(&u8I2cPEC);
-            I2CPRT_Rte_Write_P_u8TxBuf(u8I2cPEC,mg_u8I2cTxCnt);
+            u8data = u8I2cPEC;
           }
           else
           {
-            I2CPRT_Rte_Write_P_u8TxBuf(I2CPRT_CFG_I2C_DEFAULT_VAL,mg_u8I2cTxCnt);
+            u8data = I2CPRT_CFG_I2C_DEFAULT_VAL;
           }
         }
-        u8data = I2CPRT_Rte_Read_R_u8TxBuf(mg_u8I2cTxCnt);
+        else
+        {
+          u8data = I2CPRT_Rte_Read_R_u8TxData(mg_u8I2cTxCnt);
+        }
         mg_u8I2cTxCnt++;
       } /* end else */ 
       else
@@ -326,15 +484,53 @@ void I2CPRT_CFG_vI2cIsr( void )
       
       I2CPRT_SCFG_u8WriteData(u8data); 	
 
-      /* Calculate the PEC if supported */
-      if(I2CPRT_RTE_Read_B_R_PEC_Enable())
+      /* Calculate the PEC if supported and not precomputed with the response */
+      if ((I2CPRT_RTE_Read_B_R_PEC_Enable()) && (!I2CPRT_RTE_Read_B_R_TX_PEC_RDY()))
       {
         I2CPRT_Rte_Write_P_u8I2cPEC(I2CPRT_SCFG_u8GetCrc8(RTE_u8I2cPEC, u8data)); 
       }
     }
+#if I2CPRT_CONF_DEFERRED_HANDLE
+    else if(u32Isr & I2C_ISR_STOPF)
+    {
+      /* Frame complete: keep the I2C interrupt off (the host is stretched
+       * on the next address) until the deferred interrupt has handled it */
+      I2CPRT_SCFG_vDisableInt();
+      I2CPRT_SCFG_vPendDeferredIsr();
+    }
+#endif
   }
+#if I2CPRT_CONF_ISR_MEASURE
+  mg_vUpdateIsrTime(u32Isr, u32Start);
+#endif
 } /* I2C_vI2cIsr */
 
+/********************************************************************************
+ * \brief         Deferred interrupt pended by the STOP detection, runs at the
+ *                lowest priority right after the I2C interrupt. The polling in
+ *                the scheduler stays as fallback.
+ *                It preempts the scheduler tasks: write frames of commands
+ *                that share state with them (blackbox, MFR data, see
+ *                PMBUS_u8IsThreadCmd()) stay latched, with the I2C interrupt
+ *                off and the host stretched, until the polling handles them.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+void I2CPRT_CFG_vDeferredIsr( void )
+{
+  if ((mg_u8I2cState == I2CPRT_CFG_E_I2C_READ) || (FALSE == I2CPRT_SCFG_u8IsThreadCmd()))
+  {
+    mg_u8InDeferredIsr = TRUE;
+    I2CPRT_vProcessReceiveData();
+    mg_u8InDeferredIsr = FALSE;
+  }
+}
+
 /********************************************************************************
  * \brief         Detect Stop bit and check wait flag to handle received frame 
  *
@@ -378,9 +574,15 @@ void I2CPRT_vProcessReceiveData( void )
           }
           
           I2CPRT_SCFG_vPMBusHandleData(); 
+#if I2CPRT_CONF_LAT_MEASURE
+          mg_vUpdateLatency();
+#endif
         }
         else 
         {
+#if I2CPRT_CONF_CMD_STATS
+          MG_U8_INC_SAT(mg_asCmdStats[mg_u8CmdStatsIdx].u8PecErr);
+#endif
           if(FALSE == I2CPRT_RTE_Read_B_R_PEC_ERR_FLG()) 
           { 
             I2CPRT_RTE_Write_B_P_PEC_ERR_FLG(TRUE);
@@ -395,6 +597,17 @@ void I2CPRT_vProcessReceiveData( void )
     } 
     if(I2CPRT_SCFG_eGetRxSTOPFlg())
     {
+#if I2CPRT_CONF_CMD_STATS
+      mg_vCmdStatsFrameEnd();
+#endif
+#if I2CPRT_CONF_SMBALERT_ARA
+      if ((mg_u8I2cState == I2CPRT_CFG_E_I2C_ARA) && (FALSE == mg_u8AraLost))
+      {
+        /* Address sent: release SMBALERT# until PMBus sees new status bits */
+        I2CPRT_SCFG_vDisableOAR2();
+        I2CPRT_RTE_Write_B_P_SMBALERT_ARA(TRUE);
+      }
+#endif
       I2CPRT_SCFG_vClearRxSTOPFlg();
       mg_u8I2cState = I2CPRT_CFG_E_I2C_IDLE; 
     }
@@ -407,6 +620,226 @@ void I2CPRT_vSetI2cState(uint8 u8State)
 {
 	mg_u8I2cState = u8State;
 }
+
+/********************************************************************************
+ * \brief         A read frame is on the bus (addressed, STOP not handled yet)
+ *                and its data is streamed from the area
+ *
+ * \param[in]     pu8Area   start of the area
+ *                u16Size   bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE / FALSE
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8IsReadingArea(const uint8 *pu8Area, uint16 u16Size)
+{
+  const volatile uint8 *pu8Data = I2CPRT_Rte_Read_R_pu8TxData();
+
+  return ((I2CPRT_CFG_E_I2C_READ == mg_u8I2cState) &&
+          (pu8Data >= pu8Area) && (pu8Data < (pu8Area + u16Size))) ? TRUE : FALSE;
+}
+
+/********************************************************************************
+ * \brief         Read the latency from the last data byte of a write frame to
+ *                the end of its PMBus handling, or the I2C interrupt run time
+ *
+ * \param[in]     eItem   value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Latency in 0.1us or frame counter, 0 if not measured
+ *
+ *******************************************************************************/
+uint16 I2CPRT_u16GetLatency(I2CPRT_E_LAT eItem)
+{
+  uint16 u16Val = 0U;
+#if I2CPRT_CONF_LAT_MEASURE
+
+  switch (eItem)
+  {
+    case I2CPRT_E_LAT_MIN:
+    {
+      u16Val = mg_sLatency.u16Min;
+      break;
+    }
+    case I2CPRT_E_LAT_AVG:
+    {
+      u16Val = mg_sLatency.u16Avg;
+      break;
+    }
+    case I2CPRT_E_LAT_MAX:
+    {
+      u16Val = mg_sLatency.u16Max;
+      break;
+    }
+    case I2CPRT_E_LAT_DEFERRED:
+    {
+      u16Val = mg_sLatency.u16Deferred;
+      break;
+    }
+    case I2CPRT_E_LAT_POLLED:
+    {
+      u16Val = mg_sLatency.u16Polled;
+      break;
+    }
+#if I2CPRT_CONF_ISR_MEASURE
+    case I2CPRT_E_LAT_ISR_MAX:
+    {
+      u16Val = (uint16)MIN((mg_sIsrTime.u32Max * 10u) / I2CPRT_CONF_STAMP_CNT_PER_US, 0xFFFFu);
+      break;
+    }
+    case I2CPRT_E_LAT_ISR_BYTE_MAX:
+    {
+      u16Val = (uint16)MIN((mg_sIsrTime.u32ByteMax * 10u) / I2CPRT_CONF_STAMP_CNT_PER_US, 0xFFFFu);
+      break;
+    }
+    case I2CPRT_E_LAT_ISR_OVER:
+    {
+      u16Val = mg_sIsrTime.u16ByteOver;
+      break;
+    }
+#endif
+    default:
+    {
+      break;
+    }
+  }
+#endif
+  return u16Val;
+}
+
+/********************************************************************************
+ * \brief         PEC state of a plain read of u8Cmd before the first data
+ *                byte: write address, command and read address
+ *
+ * \param[in]     u8Cmd   PMBus command
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        PEC seed for the response data
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8GetReadPecSeed(uint8 u8Cmd)
+{
+  uint8 u8Pec;
+
+  u8Pec = I2CPRT_SCFG_u8GetCrc8(0x00, mg_u8I2cAddrWr.ALL);
+  u8Pec = I2CPRT_SCFG_u8GetCrc8(u8Pec, u8Cmd);
+  u8Pec = I2CPRT_SCFG_u8GetCrc8(u8Pec, mg_u8I2cAddrRd.ALL);
+
+  return u8Pec;
+}
+
+/********************************************************************************
+ * \brief         Answer the SMBus Alert Response Address while SMBALERT# is
+ *                asserted and not yet answered. The I2C interrupt is off, an
+ *                alert response in progress cannot be enabled again.
+ *
+ * \param[in]     u8Alert   TRUE = SMBALERT# asserted
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+void I2CPRT_vUpdateAra(uint8 u8Alert)
+{
+#if I2CPRT_CONF_SMBALERT_ARA
+  I2CPRT_SCFG_vDisableInt();
+  if ((FALSE != u8Alert) && (FALSE == I2CPRT_RTE_Read_B_R_SMBALERT_ARA()))
+  {
+    I2CPRT_SCFG_vEnableOAR2();
+  }
+  else
+  {
+    I2CPRT_SCFG_vDisableOAR2();
+  }
+  I2CPRT_SCFG_vEnableInt();
+#endif
+}
+
+/********************************************************************************
+ * \brief         Copy the per command statistics, one I2CPRT_CMD_STATS_SIZE
+ *                record per command code seen since the last clear, the other
+ *                commands last if there were any
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    pu8Data   records
+ *
+ * \return        Number of bytes written, 0 if not measured
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8GetCmdStats(uint8 *pu8Data)
+{
+  uint8 u8Len = 0U;
+#if I2CPRT_CONF_CMD_STATS
+  const MG_S_CMD_STATS *psStats;
+  uint8 u8Idx;
+
+  for (u8Idx = 0U; u8Idx <= MG_CMD_STATS_OTHER_IDX; u8Idx++)
+  {
+    psStats = &mg_asCmdStats[u8Idx];
+    if ((u8Idx < mg_u8CmdStatsNum)
+        || ((u8Idx == MG_CMD_STATS_OTHER_IDX) && ((psStats->u16Rd | psStats->u16Wr) != 0U)))
+    {
+      pu8Data[u8Len++] = psStats->u8Cmd;
+      pu8Data[u8Len++] = (uint8)psStats->u16Rd;
+      pu8Data[u8Len++] = (uint8)(psStats->u16Rd >> 8);
+      pu8Data[u8Len++] = (uint8)psStats->u16Wr;
+      pu8Data[u8Len++] = (uint8)(psStats->u16Wr >> 8);
+      pu8Data[u8Len++] = psStats->u8PecErr;
+      pu8Data[u8Len++] = psStats->u8Nack;
+      pu8Data[u8Len++] = psStats->u8Ovr;
+      pu8Data[u8Len++] = (uint8)psStats->u16TimeMax;
+      pu8Data[u8Len++] = (uint8)(psStats->u16TimeMax >> 8);
+      pu8Data[u8Len++] = (uint8)psStats->u16TimeAvg;
+      pu8Data[u8Len++] = (uint8)(psStats->u16TimeAvg >> 8);
+    }
+  }
+#endif
+  return u8Len;
+}
+
+/********************************************************************************
+ * \brief         Clear the per command statistics. Called with the I2C
+ *                interrupt disabled, a frame in progress continues in the
+ *                entry of its command.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+void I2CPRT_vClearCmdStats(void)
+{
+#if I2CPRT_CONF_CMD_STATS
+  uint8 u8Cmd;
+  uint8 u8Idx;
+
+  u8Cmd = (mg_u8CmdStatsIdx < mg_u8CmdStatsNum) ? mg_asCmdStats[mg_u8CmdStatsIdx].u8Cmd : I2CPRT_CONF_CMD_STATS_OTHER;
+
+  for (u8Idx = 0U; u8Idx <= MG_CMD_STATS_OTHER_IDX; u8Idx++)
+  {
+    mg_asCmdStats[u8Idx].u8Cmd = 0U;
+    mg_asCmdStats[u8Idx].u8PecErr = 0U;
+    mg_asCmdStats[u8Idx].u8Nack = 0U;
+    mg_asCmdStats[u8Idx].u8Ovr = 0U;
+    mg_asCmdStats[u8Idx].u16Rd = 0U;
+    mg_asCmdStats[u8Idx].u16Wr = 0U;
+    mg_asCmdStats[u8Idx].u16TimeMax = 0U;
+    mg_asCmdStats[u8Idx].u16TimeAvg = 0U;
+  }
+  mg_asCmdStats[MG_CMD_STATS_OTHER_IDX].u8Cmd = I2CPRT_CONF_CMD_STATS_OTHER;
+  mg_u8CmdStatsNum = 0U;
+  mg_u8CmdStatsIdx = mg_u8CmdStatsFind(u8Cmd);
+#endif
+}
+
 /*******************************************************************************
  * Local functions (private to module)
  ******************************************************************************/
@@ -427,4 +860,179 @@ static void mg_vSetI2cAddress( uint8 u8Addr )
   I2CPRT_SCFG_vEnableOAR1();   /* After change the Addr, set OA1EN=1(ENABLE). This operation only supply on STM32 MCU*/
 }
 
+#if I2CPRT_CONF_LAT_MEASURE
+/********************************************************************************
+ * \brief         Add the latency of the frame just handled
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vUpdateLatency( void )
+{
+  uint32 u32Lat;
+
+  u32Lat = I2CPRT_SCFG_u32GetTimeStamp() - mg_u32RxStamp;
+  u32Lat = (u32Lat * 10u) / I2CPRT_CONF_STAMP_CNT_PER_US;
+  u32Lat = MIN(u32Lat, 0xFFFFu);
+
+  if (((uint16)u32Lat < mg_sLatency.u16Min) || (0U == mg_sLatency.u16Max))
+  {
+    mg_sLatency.u16Min = (uint16)u32Lat;
+  }
+  if ((uint16)u32Lat > mg_sLatency.u16Max)
+  {
+    mg_sLatency.u16Max = (uint16)u32Lat;
+  }
+  if (0U == mg_sLatency.u16Avg)
+  {
+    mg_sLatency.u16Avg = (uint16)u32Lat;
+  }
+  else
+  {
+    mg_sLatency.u16Avg = (uint16)((sint32)mg_sLatency.u16Avg +
+                                  (((sint32)u32Lat - (sint32)mg_sLatency.u16Avg) >> I2CPRT_CONF_LAT_AVG_SHIFT));
+  }
+
+  if (FALSE != mg_u8InDeferredIsr)
+  {
+    if (mg_sLatency.u16Deferred < 0xFFFFU)
+    {
+      mg_sLatency.u16Deferred++;
+    }
+  }
+  else if (mg_sLatency.u16Polled < 0xFFFFU)
+  {
+    mg_sLatency.u16Polled++;
+  }
+}
+#endif
+
+#if I2CPRT_CONF_ISR_MEASURE
+/********************************************************************************
+ * \brief         Add the run time of the I2C interrupt just handled. No
+ *                division here, the conversion to 0.1us is done when read.
+ * \param[in]     u32Isr     interrupt flags the interrupt has handled
+ *                u32Start   time stamp at the interrupt entry
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vUpdateIsrTime( uint32 u32Isr, uint32 u32Start )
+{
+  uint32 u32Time;
+
+  u32Time = I2CPRT_SCFG_u32GetTimeStamp() - u32Start;
+  if (u32Time > mg_sIsrTime.u32Max)
+  {
+    mg_sIsrTime.u32Max = u32Time;
+  }
+
+  /* Data byte only, the branches before it take precedence */
+  if ((0U == (u32Isr & (I2C_IT_OVR | I2C_IT_ARLO | I2C_IT_BERR | I2C_IT_NACKF | I2C_IT_ADDR))) &&
+      (0U != (u32Isr & (I2C_IT_RXNE | I2C_IT_TXIS))))
+  {
+    if (u32Time > mg_sIsrTime.u32ByteMax)
+    {
+      mg_sIsrTime.u32ByteMax = u32Time;
+    }
+    if ((u32Time > I2CPRT_CONF_ISR_BYTE_BUDGET) && (mg_sIsrTime.u16ByteOver < 0xFFFFU))
+    {
+      mg_sIsrTime.u16ByteOver++;
+    }
+  }
+}
+#endif
+
+#if I2CPRT_CONF_CMD_STATS
+/********************************************************************************
+ * \brief         Entry of a command code, a new one while there is room
+ * \param[in]     u8Cmd   PMBus command
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Index in mg_asCmdStats
+ *
+ *******************************************************************************/
+static uint8 mg_u8CmdStatsFind( uint8 u8Cmd )
+{
+  uint8 u8Idx = 0U;
+
+  if (u8Cmd == I2CPRT_CONF_CMD_STATS_OTHER)
+  {
+    u8Idx = MG_CMD_STATS_OTHER_IDX;
+  }
+  else
+  {
+    while ((u8Idx < mg_u8CmdStatsNum) && (mg_asCmdStats[u8Idx].u8Cmd != u8Cmd))
+    {
+      u8Idx++;
+    }
+
+    if (u8Idx == mg_u8CmdStatsNum)
+    {
+      if (u8Idx < I2CPRT_CONF_CMD_STATS_NUM)
+      {
+        mg_asCmdStats[u8Idx].u8Cmd = u8Cmd;
+        mg_u8CmdStatsNum++;
+      }
+      else
+      {
+        u8Idx = MG_CMD_STATS_OTHER_IDX;
+      }
+    }
+  }
+
+  return u8Idx;
+}
+
+/********************************************************************************
+ * \brief         Count the frame ended by the STOP and add its time
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vCmdStatsFrameEnd( void )
+{
+  MG_S_CMD_STATS *psStats = &mg_asCmdStats[mg_u8CmdStatsIdx];
+  uint32 u32Time;
+
+  if ((FALSE != mg_u8FrameOpen) && ((FALSE != mg_u8FrameRead) || (FALSE != mg_u8FrameCmd)))
+  {
+    if (FALSE != mg_u8FrameRead)
+    {
+      MG_U16_INC_SAT(psStats->u16Rd);
+    }
+    else
+    {
+      MG_U16_INC_SAT(psStats->u16Wr);
+    }
+
+    u32Time = (I2CPRT_SCFG_u32GetTimeStamp() - mg_u32FrameStamp) / I2CPRT_CONF_STAMP_CNT_PER_US;
+    u32Time = MIN(u32Time, 0xFFFFu);
+    if ((uint16)u32Time > psStats->u16TimeMax)
+    {
+      psStats->u16TimeMax = (uint16)u32Time;
+    }
+    if (0U == psStats->u16TimeAvg)
+    {
+      psStats->u16TimeAvg = (uint16)u32Time;
+    }
+    else
+    {
+      psStats->u16TimeAvg = (uint16)((sint32)psStats->u16TimeAvg +
+                                     (((sint32)u32Time - (sint32)psStats->u16TimeAvg) >> I2CPRT_CONF_CMD_STATS_AVG_SHIFT));
+    }
+  }
+  mg_u8FrameOpen = FALSE;
+}
+#endif
+
 /* End of file */
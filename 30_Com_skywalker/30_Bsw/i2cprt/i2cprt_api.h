@@ -27,11 +27,115 @@
 
 #include "global.h"
 
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+/* Read over PMB_F5_DEBUG_REG at debug index RTE_DEBUG_ADR_I2C_LAT_START + item */
+typedef enum I2CPRT_E_LAT_
+{
+  I2CPRT_E_LAT_MIN = 0,      /* Minimum frame latency (0.1us) */
+  I2CPRT_E_LAT_AVG,          /* Moving average of the frame latency (0.1us) */
+  I2CPRT_E_LAT_MAX,          /* Maximum frame latency (0.1us) */
+  I2CPRT_E_LAT_DEFERRED,     /* Frames handled by the deferred interrupt */
+  I2CPRT_E_LAT_POLLED,       /* Frames handled by the polling fallback */
+  I2CPRT_E_LAT_ISR_MAX,      /* Longest I2C interrupt (0.1us) */
+  I2CPRT_E_LAT_ISR_BYTE_MAX, /* Longest data byte (RXNE/TXIS) interrupt (0.1us) */
+  I2CPRT_E_LAT_ISR_OVER,     /* Data byte interrupts longer than the 1 MHz byte budget */
+  I2CPRT_E_LAT_COUNT
+} I2CPRT_E_LAT;
+
+/*
+ * Record of one command code as written by I2CPRT_u8GetCmdStats(), words low
+ * byte first, counters saturate
+ */
+#define I2CPRT_CMD_STATS_SIZE     12u
+
 /*******************************************************************************
  * Global function prototypes (public to other modules)
  ******************************************************************************/
 void I2CPRT_vSetI2cState(uint8 u8State);
 
+/********************************************************************************
+ * \brief         A read frame is on the bus (addressed, STOP not handled yet)
+ *                and its data is streamed from the area
+ *
+ * \param[in]     pu8Area   start of the area
+ *                u16Size   bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE / FALSE
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8IsReadingArea(const uint8 *pu8Area, uint16 u16Size);
+
+/********************************************************************************
+ * \brief         Read the latency from the last data byte of a write frame to
+ *                the end of its PMBus handling, or the I2C interrupt run time
+ *
+ * \param[in]     eItem   value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Latency in 0.1us or frame counter
+ *
+ *******************************************************************************/
+uint16 I2CPRT_u16GetLatency(I2CPRT_E_LAT eItem);
+
+/********************************************************************************
+ * \brief         PEC state of a plain read of u8Cmd before the first data
+ *                byte: write address, command and read address
+ *
+ * \param[in]     u8Cmd   PMBus command
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        PEC seed for the response data
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8GetReadPecSeed(uint8 u8Cmd);
+
+/********************************************************************************
+ * \brief         Answer the SMBus Alert Response Address while SMBALERT# is
+ *                asserted and not yet answered
+ *
+ * \param[in]     u8Alert   TRUE = SMBALERT# asserted
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+void I2CPRT_vUpdateAra(uint8 u8Alert);
+
+/********************************************************************************
+ * \brief         Copy the per command statistics, one I2CPRT_CMD_STATS_SIZE
+ *                record per command code seen since the last clear:
+ *                code, reads, writes, PEC errors, early NACKs, overruns,
+ *                maximum and average frame time ADDR to STOP (us)
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    pu8Data   records
+ *
+ * \return        Number of bytes written, 0 if not measured
+ *
+ *******************************************************************************/
+uint8 I2CPRT_u8GetCmdStats(uint8 *pu8Data);
+
+/********************************************************************************
+ * \brief         Clear the per command statistics
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+void I2CPRT_vClearCmdStats(void);
+
 #ifdef __cplusplus
   }
 #endif
@@ -39,8 +39,13 @@
 #define I2CPRT_CFG_BASE_SLA_ADR        I2C_CFG_I2C1_BASE_SLA_ADR	
 		
 #define I2CPRT_CFG_I2C_DEFAULT_VAL        0xffu
+
+#define I2CPRT_CFG_ARA_ADR             0x18u            /* SMBus Alert Response Address 0x0C, write form */
 		
 #define I2CPRT_CFG_vI2cIsr             I2C1_IRQHandler
+#define I2CPRT_CFG_vDeferredIsr        PendSV_Handler   /* Frame handling after STOP */
+
+#define I2CPRT_CFG_DEFERRED_ISR_PRIO   3u               /* Lowest, below all peripheral interrupts */
 
 typedef enum I2CPRT_CFG_E_I2C_STATE_
 {
@@ -48,6 +53,7 @@ typedef enum I2CPRT_CFG_E_I2C_STATE_
   I2CPRT_CFG_E_I2C_READ,           
   I2CPRT_CFG_E_I2C_WRITE,     
   I2CPRT_CFG_E_I2C_BLOCK_WRITE,       
+  I2CPRT_CFG_E_I2C_ARA,                 /* Read of the Alert Response Address */
 } I2CPRT_CFG_E_I2C_STATE;
 
 
@@ -33,6 +33,33 @@
  ******************************************************************************/
 #define I2CPRT_CONF_RX_BUF_SIZE         I2C_RX_BUF_SIZE
 #define I2CPRT_CONF_TX_BUF_SIZE         I2C_TX_BUF_SIZE
+
+/***********************************************
+ * Frame handling
+ **********************************************/
+#define I2CPRT_CONF_DEFERRED_HANDLE     1       /* 1 = STOP pends the deferred interrupt, 0 = polling only */
+#define I2CPRT_CONF_LAT_MEASURE         1       /* 1 = Measure last data byte to frame handled */
+#define I2CPRT_CONF_LAT_AVG_SHIFT       4u      /* Moving average over 2^4 frames */
+#define I2CPRT_CONF_STAMP_CNT_PER_US    (RTE_U32_CPU_CLK_FREQ / 1000000u)
+#define I2CPRT_CONF_SMBALERT_ARA        1       /* 1 = Answer the Alert Response Address while SMBALERT# is asserted */
+
+/***********************************************
+ * I2C interrupt run time
+ **********************************************/
+#define I2CPRT_CONF_ISR_MEASURE         1       /* 1 = Measure the worst case run time of the I2C interrupt */
+/*
+ * A data byte interrupt has to be done before the next byte is shifted, else
+ * the peripheral stretches SCL: 8 bit times at 1 MHz, less the interrupt entry
+ */
+#define I2CPRT_CONF_ISR_BYTE_BUDGET     (7u * I2CPRT_CONF_STAMP_CNT_PER_US)
+
+/***********************************************
+ * Per command statistics
+ **********************************************/
+#define I2CPRT_CONF_CMD_STATS           1       /* 1 = Count the traffic per command code */
+#define I2CPRT_CONF_CMD_STATS_NUM       16u     /* Command codes with an own entry */
+#define I2CPRT_CONF_CMD_STATS_OTHER     0xFFu   /* Code of the entry of all further commands */
+#define I2CPRT_CONF_CMD_STATS_AVG_SHIFT 3u      /* Moving average of the frame time over 2^3 frames */
 /***********************************************
  * Baud rate
  **********************************************/
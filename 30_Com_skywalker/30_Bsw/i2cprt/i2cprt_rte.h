@@ -37,10 +37,12 @@
 #define RTE_Read_B_R_PEC_ERR_FLG           (RTE_I2C_PEC_ERR_FLG)
 #define RTE_Read_B_R_PEC_CHANGE_FLG        (RTE_I2C_PEC_CHANGE_FLG)
 #define RTE_Read_B_R_CMD_DETECTED          (RTE_I2C_CMD_DETECTED)
+#define RTE_Read_B_R_TX_PEC_RDY            (RTE_I2C_TX_PEC_RDY)
 #define RTE_Read_B_R_I2C_ADDRESS0          (RTE_B_DIO_I2C_ADDRESS0)
 #define RTE_Read_B_R_I2C_ADDRESS1          (RTE_B_DIO_I2C_ADDRESS1)
 #define RTE_Read_B_R_I2C_ADDRESS2          (RTE_B_DIO_I2C_ADDRESS2)
 #define RTE_Read_B_R_PEC_Enable            (RTE_bPEC_Enable)
+#define RTE_Read_B_R_SMBALERT_ARA          (RTE_u8SmbAlertAra)
 
 /****  Variables ******/
 #define Rte_Read_R_u8PMBusCmd(var)         ((**var) = RTE_u8PmbusCommand)
@@ -59,7 +61,9 @@
 #define RTE_Write_B_P_PEC_ERR_FLG               (RTE_I2C_PEC_ERR_FLG)
 #define RTE_Write_B_P_PEC_CHANGE_FLG            (RTE_I2C_PEC_CHANGE_FLG)
 #define RTE_Write_B_P_CMD_DETECTED              (RTE_I2C_CMD_DETECTED)
+#define RTE_Write_B_P_TX_PEC_RDY                (RTE_I2C_TX_PEC_RDY)
 #define RTE_Write_B_P_PMBUS_PEC_FAULT           (PMBUS_tStatus.u8StatusCmlP0.Bits.PEC_FAULT) 
+#define RTE_Write_B_P_SMBALERT_ARA              (RTE_u8SmbAlertAra)
  
 /****  Variables ******/
 #define Rte_Write_P_u8PecErrCmd                 (RTE_u8I2cPECErrCmd)
@@ -114,11 +118,21 @@ SINLINE uint8 I2CPRT_RTE_Read_B_R_CMD_DETECTED(void)
 	return RTE_Read_B_R_CMD_DETECTED;
 }
 
+SINLINE uint8 I2CPRT_RTE_Read_B_R_TX_PEC_RDY(void)
+{
+	return RTE_Read_B_R_TX_PEC_RDY;
+}
+
 SINLINE uint8 I2CPRT_RTE_Read_B_R_PEC_Enable(void)
 {
 	return RTE_Read_B_R_PEC_Enable;
 }
 
+SINLINE uint8 I2CPRT_RTE_Read_B_R_SMBALERT_ARA(void)
+{
+	return RTE_Read_B_R_SMBALERT_ARA;
+}
+
 
 SINLINE void I2CPRT_Rte_Read_R_u8PMBusCmd(uint8 *var)
 {
@@ -155,6 +169,16 @@ SINLINE uint8 I2CPRT_Rte_Read_R_u8TxBuf(uint8 u8Index)
 	return RTE_au8I2cTxBuf[u8Index];
 }
 
+SINLINE uint8 I2CPRT_Rte_Read_R_u8TxData(uint8 u8Index)
+{
+	return RTE_pu8I2cTxData[u8Index];
+}
+
+SINLINE const volatile uint8 *I2CPRT_Rte_Read_R_pu8TxData(void)
+{
+	return RTE_pu8I2cTxData;
+}
+
 
 
 /* Write */
@@ -178,6 +202,16 @@ SINLINE void I2CPRT_RTE_Write_B_P_CMD_DETECTED(uint8 u8Status)
 	RTE_Write_B_P_CMD_DETECTED = u8Status;
 }
 
+SINLINE void I2CPRT_RTE_Write_B_P_TX_PEC_RDY(uint8 u8Status)
+{
+	RTE_Write_B_P_TX_PEC_RDY = u8Status;
+}
+
+SINLINE void I2CPRT_RTE_Write_B_P_SMBALERT_ARA(uint8 u8Status)
+{
+	RTE_Write_B_P_SMBALERT_ARA = u8Status;
+}
+
 SINLINE void I2CPRT_RTE_Write_B_P_PMBUS_PEC_FAULT(uint8 u8Status)
 {
 	RTE_Write_B_P_PMBUS_PEC_FAULT = u8Status;
@@ -218,6 +252,11 @@ SINLINE void I2CPRT_Rte_Write_P_u8TxBuf(uint8 u8Data,uint8 u8Index)
 	RTE_au8I2cTxBuf[u8Index] = u8Data;
 }
 
+SINLINE void I2CPRT_Rte_Write_P_pu8TxData(const volatile uint8 *pu8Data)
+{
+	RTE_pu8I2cTxData = pu8Data;
+}
+
 
 
 
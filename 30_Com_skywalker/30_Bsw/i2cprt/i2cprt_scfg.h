@@ -31,6 +31,8 @@
 #include "i2c_cfg.h"
 #include "crc_api.h"
 #include "pmbus_api.h"
+#include "schm_api.h"
+#include "i2cprt_cfg.h"
 		
 #define MG_I2C_TX_DATA_REG         I2C1->TXDR                   /* TX register */
 #define MG_I2C_RX_DATA_REG         I2C1->RXDR                   /* RX register */
@@ -131,6 +133,26 @@ SINLINE void I2CPRT_SCFG_vSetOAR1(uint32 u32Address)
 	I2C1->OAR1 |= u32Address;  /* I2C change own addr */
 }
 
+SINLINE void I2CPRT_SCFG_vDisableOAR2(void)
+{
+	I2C1->OAR2 &= ~I2C_OAR2_OA2EN; /* I2C disable own address 2 */
+}
+
+SINLINE void I2CPRT_SCFG_vEnableOAR2(void)
+{
+	I2C1->OAR2 |= I2C_OAR2_OA2EN;  /* I2C enable own address 2 */
+}
+
+SINLINE void I2CPRT_SCFG_vSetOAR2(uint32 u32Address)
+{
+	I2C1->OAR2 = u32Address & I2C_OAR2_OA2;  /* No mask, disabled */
+}
+
+SINLINE uint8 I2CPRT_SCFG_u8GetAddrCode(uint32 u32Isr)
+{
+	return (uint8)((u32Isr & I2C_ISR_ADDCODE) >> 16);  /* Matched address, write form */
+}
+
 SINLINE ITStatus I2CPRT_SCFG_eGetRxSTOPFlg(void)
 {
 	return I2C_GetFlagStatus(I2C1, I2C_FLAG_STOPF); /* I2C received stop flag  */
@@ -176,6 +198,27 @@ SINLINE void I2CPRT_SCFG_vPMBusHandleData(void)
 	vPMBus_HandleData();
 }
 
+SINLINE uint8 I2CPRT_SCFG_u8IsThreadCmd(void)
+{
+	return PMBUS_u8IsThreadCmd();
+}
+
+SINLINE void I2CPRT_SCFG_vInitDeferredIsr(void)
+{
+	NVIC_SetPriority(PendSV_IRQn, I2CPRT_CFG_DEFERRED_ISR_PRIO);
+	I2C_ITConfig(I2C1, I2C_IT_STOPI, ENABLE);  /* STOP detection interrupt */
+}
+
+SINLINE void I2CPRT_SCFG_vPendDeferredIsr(void)
+{
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;  /* Runs after all active interrupts */
+}
+
+SINLINE uint32 I2CPRT_SCFG_u32GetTimeStamp(void)
+{
+	return SCHM_u32GetTimeStamp();
+}
+
 #ifdef __cplusplus
   }
 #endif
@@ -35,15 +35,59 @@
  * Local constants and macros (private to module)
  ******************************************************************************/
 
+/* The Emem page n is the EEPROM page (MEM_CFG_EEPROM_ADDRESS_START / PAGE_SIZE + n) */
+#if ((MEM_CFG_EEPROM_ADDRESS_START % MEM_CFG_EEPROM_PAGE_SIZE) != 0)
+#error "MEM_CFG_EEPROM_ADDRESS_START is not page aligned"
+#endif
+
+#define MG_FLUSH_MASK                   (MEM_CONF_FLUSH_NUM - 1u)
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
 
+typedef enum MG_E_FLUSH_
+{
+  MG_E_FLUSH_PEND = 0,
+  MG_E_FLUSH_OK,
+  MG_E_FLUSH_FAIL
+} MG_E_FLUSH;
+
+typedef struct MG_S_DIRTY_
+{
+  uint8 u8Lo;                         /* First changed byte in the page */
+  uint8 u8End;                        /* One past the last changed byte, 0: page clean */
+} MG_S_DIRTY;
+
+typedef struct MG_S_FLUSH_
+{
+  uint16 u16Offset;                   /* Emem area of the queued write */
+  uint16 u16Len;
+  volatile uint8 u8Result;            /* MG_E_FLUSH, set by mg_vFlushDone() */
+} MG_S_FLUSH;
+
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
 static uint8 mg_u8DataBuf[5];
 static uint8 mg_au8DataBase[MEM_CFG_LENGHT_EMEM];
+static uint8 mg_u8BlcBoxPageWrDis;
+static uint8 mg_au8MfrInfoBuf[MG_EE_ADR_MFR_INFO_SIZE];   /* Source of the queued MFR information write */
+static volatile uint8 mg_u8MfrInfoBusy;
+
+/* Emem bytes changed since they were written to EEPROM */
+static MG_S_DIRTY mg_asDirty[MEM_CFG_PAGE_NUM];
+/* Emem writes in the EEPROM queue, completed in queue order */
+static MG_S_FLUSH mg_asFlush[MEM_CONF_FLUSH_NUM];
+static uint8 mg_u8FlushHead;
+static uint8 mg_u8FlushTail;
+static volatile uint8 mg_u8FlushDone;
+/* Write cycles of each Emem page, for the wear report */
+static uint32 mg_au32PageWrCnt[MEM_CFG_PAGE_NUM];
+static uint8 mg_u8WrCntUnsaved;
+static uint8 mg_au8WrCntBuf[EEP_ADR_MEM_PAGE_WR_CNT_SIZE];   /* Source of the queued counter write */
+static volatile uint8 mg_u8WrCntBusy;
+static volatile uint8 mg_u8WrCntRetry;
 /*******************************************************************************
  * Local function prototypes (private to module)
  ******************************************************************************/
@@ -56,6 +100,14 @@ static void mg_vReadAcOffset(void);
 static void mg_vSaveAcOffset(void);
 static void mg_vReadMfrInfoData(void);
 static void mg_vSaveMfrInfoData(void);
+static void mg_vMfrInfoDone(EEPROM_E_RESULT eResult);
+static void mg_vMarkDirty(uint16 u16Offset, uint16 u16Len);
+static uint8 mg_u8QueueFlush(uint16 u16Offset, uint16 u16Len);
+static void mg_vFlushDone(EEPROM_E_RESULT eResult);
+static void mg_vCheckFlush(void);
+static void mg_vReadWrCnt(void);
+static void mg_vSaveWrCnt(void);
+static void mg_vWrCntDone(EEPROM_E_RESULT eResult);
 
 /*******************************************************************************
  * Global functions (public to other modules)
@@ -77,6 +129,8 @@ void MEM_vInit(void)
   mg_vReadTrimData();
   mg_vReadAcOffset();
   mg_vReadMfrInfoData();
+  MEM_SCFG_vReadMem(&mg_u8BlcBoxPageWrDis,EEP_ADR_BLACK_BOX_PAGE_W_DIS,1u);
+  mg_vReadWrCnt();
 }
 
 /*******************************************************************************
@@ -98,7 +152,7 @@ void MEM_vDeInit(void)
  * \param[in]  -  
  * \param[out] -
  *
- * \return  -Write to mem (Ram)
+ * \return  -Write to mem (Ram), the changed bytes are marked for the EEPROM
  *
  **************************************************************************** */
 void MEM_vWriteToMem(uint32 u32WriteAddr,const uint8 *pu8Buffer,uint32 u32NumByteToWrite )
@@ -106,7 +160,11 @@ void MEM_vWriteToMem(uint32 u32WriteAddr,const uint8 *pu8Buffer,uint32 u32NumByt
 	uint32 u32CntLoop = 0;
 	for(u32CntLoop = 0; u32CntLoop < u32NumByteToWrite ; u32CntLoop++ )
 	{
-		mg_au8DataBase[u32WriteAddr + u32CntLoop] = pu8Buffer[u32CntLoop];
+		if (mg_au8DataBase[u32WriteAddr + u32CntLoop] != pu8Buffer[u32CntLoop])
+		{
+			mg_au8DataBase[u32WriteAddr + u32CntLoop] = pu8Buffer[u32CntLoop];
+			mg_vMarkDirty((uint16)(u32WriteAddr + u32CntLoop), 1u);
+		}
 	}
 }
  
@@ -154,24 +212,73 @@ uint16 MEM_u16GetOffset(uint8 index)
 	return MEM_CFG_SETUP[index].u16Offset;
 } 
  /** ****************************************************************************
- * \brief  emem_u16Getlenght
+ * \brief  emem_u8Write2EEPORM, queue the changed bytes of the Emem(RAM) pages
+ *         in the area to EEPROM. Changed bytes running over a page boundary
+ *         are one write, a clean page is never written.
  * \param[in]  -  
  * \param[out] -
  *
- * \return  - 
+ * \return  - TRUE if all queued, FALSE if a queue is full (the rest stays marked)
  *
  **************************************************************************** */
-void MEM_vWrite2EEPORM(uint16 u16Lenght , uint16 u16Offset)
+uint8 MEM_u8Write2EEPORM(uint16 u16Lenght , uint16 u16Offset)
 {		
-	uint16 u16TmpAddrEEP;
-	uint16 u16TmpAddrEmem;
-	uint8 u8Buff[MEM_CFG_BIFFER_MAX_LEN];
+	uint8 u8Ret = TRUE;
+	uint16 u16Page;
+	uint16 u16Last;
+	uint16 u16PageEnd;
+	uint16 u16Start;
+	uint16 u16Len;
 
-	/*=========== Write to EEPROM =====================================================*/
-	u16TmpAddrEEP = MEM_CFG_EEPROM_ADDRESS_START + u16Offset;
-	u16TmpAddrEmem = u16Offset;
-	MEM_vReadFromMem(u16TmpAddrEmem ,u8Buff,u16Lenght);
-	MEM_SCFG_vWriteMem(u16TmpAddrEEP,u8Buff,u16Lenght);
+	mg_vCheckFlush();
+
+	u16Page = u16Offset / MEM_CFG_EEPROM_PAGE_SIZE;
+	u16PageEnd = (u16Offset + u16Lenght + MEM_CFG_EEPROM_PAGE_SIZE - 1u) / MEM_CFG_EEPROM_PAGE_SIZE;
+	if (u16PageEnd > MEM_CFG_PAGE_NUM)
+	{
+		u16PageEnd = MEM_CFG_PAGE_NUM;
+	}
+
+	while ((u16Page < u16PageEnd) && (TRUE == u8Ret))
+	{
+		/* MEM_vWriteToMem() may mark from an interrupt: the span is taken out
+		 * of the marks in one go, a mark set afterwards starts a new one */
+		MEM_SCFG_vDisableIrq();
+		if (0u == mg_asDirty[u16Page].u8End)
+		{
+			MEM_SCFG_vEnableIrq();
+			u16Page++;
+		}
+		else
+		{
+			/* Go on into the next page while the changed bytes are adjacent */
+			u16Last = u16Page;
+			while (((u16Last + 1u) < u16PageEnd) &&
+			       (MEM_CFG_EEPROM_PAGE_SIZE == mg_asDirty[u16Last].u8End) &&
+			       (0u != mg_asDirty[u16Last + 1u].u8End) &&
+			       (0u == mg_asDirty[u16Last + 1u].u8Lo))
+			{
+				u16Last++;
+			}
+			u16Start = (u16Page * MEM_CFG_EEPROM_PAGE_SIZE) + mg_asDirty[u16Page].u8Lo;
+			u16Len = (uint16)((u16Last * MEM_CFG_EEPROM_PAGE_SIZE) + mg_asDirty[u16Last].u8End - u16Start);
+			for (; u16Page <= u16Last; u16Page++)
+			{
+				mg_asDirty[u16Page].u8End = 0u;
+			}
+			MEM_SCFG_vEnableIrq();
+
+			/* Queued straight from the Emem, a change before the page is written
+			 * goes along and is written again with its own mark */
+			u8Ret = mg_u8QueueFlush(u16Start, u16Len);
+			if (TRUE != u8Ret)
+			{
+				/* Queue full: merge the span back into the marks */
+				mg_vMarkDirty(u16Start, u16Len);
+			}
+		}
+	}
+	return u8Ret;
 } 
 
  /** ****************************************************************************
@@ -185,15 +292,10 @@ void MEM_vWrite2EEPORM(uint16 u16Lenght , uint16 u16Offset)
 void MEM_vRead2EEPORM(uint16 u16Lenght ,uint16 u16Offset)
 {		
 	uint16 u16TmpAddrEEP;
-	uint16 u16TmpAddrEmem;
-	uint8 u8Buff[MEM_CFG_BIFFER_MAX_LEN];
 	
 	/*============== Read from EEPROM To Emem ============================*/	
 	u16TmpAddrEEP = MEM_CFG_EEPROM_ADDRESS_START + u16Offset;
-	u16TmpAddrEmem = u16Offset;
-
-		MEM_SCFG_vReadMem(u8Buff,u16TmpAddrEEP,u16Lenght);		
-		MEM_vWriteToMem(u16TmpAddrEmem,u8Buff,u16Lenght);
+	MEM_SCFG_vReadMem(&mg_au8DataBase[u16Offset],u16TmpAddrEEP,u16Lenght);		
 } 
 
 /*******************************************************************************
@@ -232,6 +334,12 @@ void MEM_vSaveData(void)
    case 3:
    {
      mg_vSaveMfrInfoData();
+     u8State =4u;
+     break;
+   }
+   case 4:
+   {
+     mg_vSaveWrCnt();
      u8State =0;
      break;
    }
@@ -255,11 +363,7 @@ void MEM_vSaveData(void)
  ******************************************************************************/
 uint8 MEM_vReadBlcBoxPageWrDis(void)
 {
-	uint8 u8Data;
-	
-	MEM_SCFG_vReadMem(&u8Data,EEP_ADR_BLACK_BOX_PAGE_W_DIS,1u);
-	
-	return u8Data;
+	return mg_u8BlcBoxPageWrDis;
 }
 
 /*******************************************************************************
@@ -274,8 +378,32 @@ uint8 MEM_vReadBlcBoxPageWrDis(void)
  ******************************************************************************/
 void MEM_vWriteBlcBoxPageWrDis(uint8 u8Data)
 {
-	MEM_SCFG_vWriteMem(EEP_ADR_BLACK_BOX_PAGE_W_DIS,&u8Data,1u);
+	if (TRUE == MEM_SCFG_u8WriteMem(EEP_ADR_BLACK_BOX_PAGE_W_DIS,&u8Data,1u,NULL))
+	{
+		mg_u8BlcBoxPageWrDis = u8Data;
+	}
+}
+
+/*******************************************************************************
+ * \brief         Read the write cycles of an Emem page, for the wear report
+ *
+ * \param[in]     u8Page : Emem page, 0 .. MEM_CFG_PAGE_NUM - 1
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Page writes since the counters were first saved
+ *
+ ******************************************************************************/
+uint32 MEM_u32GetPageWrCnt(uint8 u8Page)
+{
+	uint32 u32Cnt = 0u;
+	if (u8Page < MEM_CFG_PAGE_NUM)
+	{
+		u32Cnt = mg_au32PageWrCnt[u8Page];
+	}
+	return u32Cnt;
 }
+
 /*******************************************************************************
  * Local functions (private to module)
  ******************************************************************************/
@@ -369,10 +497,9 @@ static void mg_vSaveTrimData(void)
     u8Crc = MEM_CFG_CRC_INIT;
     u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, uTrimGain.Bytes.LB);      /* calculat CRC */
     au8EepromWriteBuf[2] = MEM_SCFG_u8GetCrc8(u8Crc, uTrimGain.Bytes.HB);    /*get CRC*/
-		if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+		if(MEM_SCFG_u8WriteMem(EEP_ADR_VSB_TRIM_LSB, au8EepromWriteBuf, 3u, NULL) == TRUE)
 		{
 			 MEM_Rte_Write_B_R_VSB_TRIM(FALSE);
-       MEM_SCFG_vWriteMem(EEP_ADR_VSB_TRIM_LSB, au8EepromWriteBuf, 3u);
 		}
   }
 
@@ -385,10 +512,9 @@ static void mg_vSaveTrimData(void)
     u8Crc = MEM_CFG_CRC_INIT;
     u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, uTrimGain.Bytes.LB);      /* calculat CRC */
     au8EepromWriteBuf[2] = MEM_SCFG_u8GetCrc8(u8Crc, uTrimGain.Bytes.HB);    /*get CRC*/
-		if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+		if(MEM_SCFG_u8WriteMem(EEP_ADR_V1_1_TRIM_LSB, au8EepromWriteBuf, 3u, NULL) == TRUE)
 		{
 			MEM_Rte_Write_B_R_V1_TRIM(FALSE);
-			MEM_SCFG_vWriteMem(EEP_ADR_V1_1_TRIM_LSB, au8EepromWriteBuf, 3u);
 		}
   }
 } /* mg_vSaveTrimData */ 
@@ -559,9 +685,8 @@ static void mg_vSaveFwRevData(void)
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.LB);
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.HB);
 				au8EepromWriteBuf[3] = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.UB);
-				if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(MEM_SCFG_u8WriteMem(EEP_REVI_PRI_APP_MAJOR, au8EepromWriteBuf, 4u, NULL) == TRUE)
 				{
-					MEM_SCFG_vWriteMem(EEP_REVI_PRI_APP_MAJOR, au8EepromWriteBuf, 4u);
 					u8SavePriState = 1;
 				}
 				break;
@@ -577,10 +702,9 @@ static void mg_vSaveFwRevData(void)
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.LB);
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.HB);
 				au8EepromWriteBuf[3] = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.UB);
-				if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(MEM_SCFG_u8WriteMem(EEP_REVI_PRI_BOOT_MAJOR, au8EepromWriteBuf, 4u, NULL) == TRUE)
 				{
 					MEM_Rte_Write_B_R_PRI_REV_UPDATE(FALSE);
-					MEM_SCFG_vWriteMem(EEP_REVI_PRI_BOOT_MAJOR, au8EepromWriteBuf, 4u);
 					u8SavePriState = 0;
 				}
 				break;
@@ -609,9 +733,8 @@ static void mg_vSaveFwRevData(void)
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.LB);
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.HB);
 				au8EepromWriteBuf[3] = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.UB);
-				if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(MEM_SCFG_u8WriteMem(EEP_REVI_SEC_APP_MAJOR, au8EepromWriteBuf, 4u, NULL) == TRUE)
 				{
-					MEM_SCFG_vWriteMem(EEP_REVI_SEC_APP_MAJOR, au8EepromWriteBuf, 4u);
 					u8SaveSecState = 1;
 				}
 				break;
@@ -627,10 +750,9 @@ static void mg_vSaveFwRevData(void)
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.LB);
 				u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.HB);
 				au8EepromWriteBuf[3] = MEM_SCFG_u8GetCrc8(u8Crc, u32EepFwRev.Bytes.UB);
-				if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(MEM_SCFG_u8WriteMem(EEP_REVI_SEC_BOOT_MAJOR, au8EepromWriteBuf, 4u, NULL) == TRUE)
 				{
 					MEM_Rte_Write_B_R_SEC_REV_UPDATE(FALSE);
-					MEM_SCFG_vWriteMem(EEP_REVI_SEC_BOOT_MAJOR, au8EepromWriteBuf, 4u);
 					u8SaveSecState = 0;
 				}
 				break;
@@ -696,28 +818,50 @@ static void mg_vReadMfrInfoData(void)
 static void mg_vSaveMfrInfoData(void)
 {
   uint8 u8Crc = 0;
-  uint8 au8EepromWriteBuf[MG_EE_ADR_MFR_INFO_SIZE];
   uint8 u8Loop;
 	
-  if (MEM_Rte_Read_B_R_MFR_INFO_UPDATE() != FALSE)
+  /* The buffer is the write source until mg_vMfrInfoDone() */
+  if ((MEM_Rte_Read_B_R_MFR_INFO_UPDATE() != FALSE) && (FALSE == mg_u8MfrInfoBusy))
   {
-    MEM_Rte_Read_R_au8MfrInfo(au8EepromWriteBuf);
+    MEM_Rte_Read_R_au8MfrInfo(mg_au8MfrInfoBuf);
     u8Crc = MEM_CFG_CRC_INIT;
 		for(u8Loop=0;u8Loop<(MG_EE_ADR_MFR_INFO_SIZE -1u);u8Loop++)	
     {
-      u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, au8EepromWriteBuf[u8Loop]);
+      u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, mg_au8MfrInfoBuf[u8Loop]);
     }
-    au8EepromWriteBuf[MG_EE_ADR_MFR_INFO_SIZE-1u] = u8Crc;
+    mg_au8MfrInfoBuf[MG_EE_ADR_MFR_INFO_SIZE-1u] = u8Crc;
 
-    if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+    mg_u8MfrInfoBusy = TRUE;
+    if(MEM_SCFG_u8WriteMem(MG_EE_ADR_MFR_INFO_STR, mg_au8MfrInfoBuf, MG_EE_ADR_MFR_INFO_SIZE, mg_vMfrInfoDone) == TRUE)
     {
-      MEM_SCFG_vWriteMem(MG_EE_ADR_MFR_INFO_STR, au8EepromWriteBuf, MG_EE_ADR_MFR_INFO_SIZE);
+      MONCTRL_Rte_Write_B_P_MFR_INFO_UPDATE(FALSE);
+    }
+    else
+    {
+      mg_u8MfrInfoBusy = FALSE;
     }
-    
-    MONCTRL_Rte_Write_B_P_MFR_INFO_UPDATE(FALSE);
   }
 } /* REV_vSaveMfrInfoData */
 
+/*******************************************************************************
+ * \brief         MFR information written, save it again if the write failed
+ *
+ * \param[in]     eResult : EEPROM request result
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vMfrInfoDone(EEPROM_E_RESULT eResult)
+{
+  if (EEPROM_E_RESULT_OK != eResult)
+  {
+    MONCTRL_Rte_Write_B_P_MFR_INFO_UPDATE(TRUE);
+  }
+  mg_u8MfrInfoBusy = FALSE;
+}
+
 
 /*******************************************************************************
  * \brief         Read AC Offset to EEPROM
@@ -779,15 +923,262 @@ static void mg_vSaveAcOffset(void)
     u8Crc = MEM_CFG_CRC_INIT;
     u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, uAcOffset.Bytes.LB);
     au8EepromWriteBuf[2] = MEM_SCFG_u8GetCrc8(u8Crc, uAcOffset.Bytes.HB);
-    if(MEM_SCFG_u8IsEepromStandbyState() == TRUE)
+    if(MEM_SCFG_u8WriteMem(EEP_ADR_AC_CURR_OFFSET_LSB, au8EepromWriteBuf, 3u, NULL) == TRUE)
     {
-      MEM_SCFG_vWriteMem(EEP_ADR_AC_CURR_OFFSET_LSB, au8EepromWriteBuf, 3u);
+      MONCTRL_Rte_Write_B_P_AC_OFFSET_NEED_SAVE(FALSE);
+      MONCTRL_Rte_Write_B_P_AC_OFFSET_SAVEED(TRUE);
     }
-    
-    MONCTRL_Rte_Write_B_P_AC_OFFSET_NEED_SAVE(FALSE);
-    MONCTRL_Rte_Write_B_P_AC_OFFSET_SAVEED(TRUE);
   }
 }
+
+/*******************************************************************************
+ * \brief         Mark Emem bytes as changed since they were written to EEPROM
+ *
+ * \param[in]     u16Offset : Emem offset
+ *                u16Len    : Number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vMarkDirty(uint16 u16Offset, uint16 u16Len)
+{
+  MG_S_DIRTY *psDirty;
+  uint8 u8Lo;
+  uint16 u16Num;
+
+  /* Marks from an interrupt and from the tasks, see MEM_u8Write2EEPORM() */
+  MEM_SCFG_vDisableIrq();
+  while (u16Len > 0u)
+  {
+    psDirty = &mg_asDirty[u16Offset / MEM_CFG_EEPROM_PAGE_SIZE];
+    u8Lo = (uint8)(u16Offset % MEM_CFG_EEPROM_PAGE_SIZE);
+    u16Num = MEM_CFG_EEPROM_PAGE_SIZE - u8Lo;
+    if (u16Num > u16Len)
+    {
+      u16Num = u16Len;
+    }
+
+    if (0u == psDirty->u8End)
+    {
+      psDirty->u8Lo = u8Lo;
+      psDirty->u8End = (uint8)(u8Lo + u16Num);
+    }
+    else
+    {
+      if (u8Lo < psDirty->u8Lo)
+      {
+        psDirty->u8Lo = u8Lo;
+      }
+      if ((u8Lo + u16Num) > psDirty->u8End)
+      {
+        psDirty->u8End = (uint8)(u8Lo + u16Num);
+      }
+    }
+    u16Offset += u16Num;
+    u16Len -= u16Num;
+  }
+  MEM_SCFG_vEnableIrq();
+}
+
+/*******************************************************************************
+ * \brief         Queue an Emem area to EEPROM
+ *
+ * \param[in]     u16Offset : Emem offset
+ *                u16Len    : Number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE if queued, FALSE if the EEPROM queue or mg_asFlush is full
+ *
+ ******************************************************************************/
+static uint8 mg_u8QueueFlush(uint16 u16Offset, uint16 u16Len)
+{
+  MG_S_FLUSH *psFlush;
+
+  if ((uint8)(mg_u8FlushHead - mg_u8FlushTail) >= MEM_CONF_FLUSH_NUM)
+  {
+    return FALSE;
+  }
+
+  psFlush = &mg_asFlush[mg_u8FlushHead & MG_FLUSH_MASK];
+  psFlush->u16Offset = u16Offset;
+  psFlush->u16Len = u16Len;
+  psFlush->u8Result = MG_E_FLUSH_PEND;
+  if (MEM_SCFG_u8WriteMem(MEM_CFG_EEPROM_ADDRESS_START + u16Offset, &mg_au8DataBase[u16Offset], u16Len, mg_vFlushDone) != TRUE)
+  {
+    return FALSE;
+  }
+  mg_u8FlushHead++;
+  return TRUE;
+}
+
+/*******************************************************************************
+ * \brief         Emem area written, the result is handled in mg_vCheckFlush()
+ *
+ * \param[in]     eResult : EEPROM request result
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vFlushDone(EEPROM_E_RESULT eResult)
+{
+  mg_asFlush[mg_u8FlushDone & MG_FLUSH_MASK].u8Result =
+    (EEPROM_E_RESULT_OK == eResult) ? (uint8)MG_E_FLUSH_OK : (uint8)MG_E_FLUSH_FAIL;
+  mg_u8FlushDone++;
+}
+
+/*******************************************************************************
+ * \brief         Count the page writes of the written Emem areas, mark the
+ *                failed ones changed again
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vCheckFlush(void)
+{
+  MG_S_FLUSH *psFlush;
+  uint16 u16Page;
+  uint16 u16Last;
+
+  while (mg_u8FlushTail != mg_u8FlushDone)
+  {
+    psFlush = &mg_asFlush[mg_u8FlushTail & MG_FLUSH_MASK];
+    if (MG_E_FLUSH_OK == psFlush->u8Result)
+    {
+      u16Last = (psFlush->u16Offset + psFlush->u16Len - 1u) / MEM_CFG_EEPROM_PAGE_SIZE;
+      for (u16Page = psFlush->u16Offset / MEM_CFG_EEPROM_PAGE_SIZE; u16Page <= u16Last; u16Page++)
+      {
+        if (mg_au32PageWrCnt[u16Page] < 0xFFFFFFFFu)
+        {
+          mg_au32PageWrCnt[u16Page]++;
+        }
+        if (mg_u8WrCntUnsaved < 0xFFu)
+        {
+          mg_u8WrCntUnsaved++;
+        }
+      }
+    }
+    else
+    {
+      mg_vMarkDirty(psFlush->u16Offset, psFlush->u16Len);
+    }
+    mg_u8FlushTail++;
+  }
+}
+
+/*******************************************************************************
+ * \brief         Read the Emem page write counters from EEPROM
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vReadWrCnt(void)
+{
+  uint8 u8Crc;
+  uint8 u8Loop;
+
+  MEM_SCFG_vReadMem(mg_au8WrCntBuf, EEP_ADR_MEM_PAGE_WR_CNT_STR, EEP_ADR_MEM_PAGE_WR_CNT_SIZE);
+
+  u8Crc = MEM_CFG_CRC_INIT;
+  for (u8Loop = 0; u8Loop < EEP_ADR_MEM_PAGE_WR_CNT_SIZE; u8Loop++)
+  {
+    u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, mg_au8WrCntBuf[u8Loop]);
+  }
+
+  /* Blank or corrupted: count from 0 */
+  for (u8Loop = 0; u8Loop < MEM_CFG_PAGE_NUM; u8Loop++)
+  {
+    mg_au32PageWrCnt[u8Loop] = 0u;
+    if (0u == u8Crc)
+    {
+      mg_au32PageWrCnt[u8Loop] = (uint32)mg_au8WrCntBuf[u8Loop * 4u] |
+                                 ((uint32)mg_au8WrCntBuf[u8Loop * 4u + 1u] << 8) |
+                                 ((uint32)mg_au8WrCntBuf[u8Loop * 4u + 2u] << 16) |
+                                 ((uint32)mg_au8WrCntBuf[u8Loop * 4u + 3u] << 24);
+    }
+  }
+}
+
+/*******************************************************************************
+ * \brief         Save the Emem page write counters to EEPROM, every
+ *                MEM_CONF_WR_CNT_SAVE_STEP page writes
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vSaveWrCnt(void)
+{
+  uint8 u8Crc;
+  uint8 u8Loop;
+
+  mg_vCheckFlush();
+
+  /* The buffer is the write source until mg_vWrCntDone() */
+  if ((FALSE == mg_u8WrCntBusy) &&
+      ((mg_u8WrCntUnsaved >= MEM_CONF_WR_CNT_SAVE_STEP) || (FALSE != mg_u8WrCntRetry)))
+  {
+    for (u8Loop = 0; u8Loop < MEM_CFG_PAGE_NUM; u8Loop++)
+    {
+      mg_au8WrCntBuf[u8Loop * 4u]      = (uint8)(mg_au32PageWrCnt[u8Loop]);
+      mg_au8WrCntBuf[u8Loop * 4u + 1u] = (uint8)(mg_au32PageWrCnt[u8Loop] >> 8);
+      mg_au8WrCntBuf[u8Loop * 4u + 2u] = (uint8)(mg_au32PageWrCnt[u8Loop] >> 16);
+      mg_au8WrCntBuf[u8Loop * 4u + 3u] = (uint8)(mg_au32PageWrCnt[u8Loop] >> 24);
+    }
+    u8Crc = MEM_CFG_CRC_INIT;
+    for (u8Loop = 0; u8Loop < (EEP_ADR_MEM_PAGE_WR_CNT_SIZE - 1u); u8Loop++)
+    {
+      u8Crc = MEM_SCFG_u8GetCrc8(u8Crc, mg_au8WrCntBuf[u8Loop]);
+    }
+    mg_au8WrCntBuf[EEP_ADR_MEM_PAGE_WR_CNT_SIZE - 1u] = u8Crc;
+
+    mg_u8WrCntBusy = TRUE;
+    if (MEM_SCFG_u8WriteMem(EEP_ADR_MEM_PAGE_WR_CNT_STR, mg_au8WrCntBuf, EEP_ADR_MEM_PAGE_WR_CNT_SIZE, mg_vWrCntDone) == TRUE)
+    {
+      mg_u8WrCntUnsaved = 0u;
+      mg_u8WrCntRetry = FALSE;
+    }
+    else
+    {
+      mg_u8WrCntBusy = FALSE;
+    }
+  }
+}
+
+/*******************************************************************************
+ * \brief         Page write counters written, save them again if the write failed
+ *
+ * \param[in]     eResult : EEPROM request result
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+static void mg_vWrCntDone(EEPROM_E_RESULT eResult)
+{
+  if (EEPROM_E_RESULT_OK != eResult)
+  {
+    mg_u8WrCntRetry = TRUE;
+  }
+  mg_u8WrCntBusy = FALSE;
+}
+
 /*
  * End of file
  */
@@ -117,14 +117,28 @@ uint16 MEM_u16Getlenght(uint8 index);
  **************************************************************************** */
 uint16 MEM_u16GetOffset(uint8 index);
  /** ****************************************************************************
- * \brief  emem_u16Getlenght
+ * \brief  emem_u8Write2EEPORM, queue the changed bytes of the Emem(RAM) pages
+ *         in the area to EEPROM. Changed bytes running over a page boundary
+ *         are one write, a clean page is never written.
  * \param[in]  -  
  * \param[out] -
  *
- * \return  - 
+ * \return  - TRUE if all queued, FALSE if a queue is full (the rest stays marked)
  *
  **************************************************************************** */
-void MEM_vWrite2EEPORM(uint16 u16Lenght , uint16 u16Offset);
+uint8 MEM_u8Write2EEPORM(uint16 u16Lenght , uint16 u16Offset);
+
+/*******************************************************************************
+ * \brief         Read the write cycles of an Emem page, for the wear report
+ *
+ * \param[in]     u8Page : Emem page, 0 .. MEM_CFG_PAGE_NUM - 1
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Page writes since the counters were first saved
+ *
+ ******************************************************************************/
+uint32 MEM_u32GetPageWrCnt(uint8 u8Page);
 
  /** ****************************************************************************
  * \brief  emem_vRead2EEPORM
@@ -56,6 +56,9 @@
 #define MEM_CFG_BIFFER_MAX_LEN_1        (MEM_CFG_BLABOX_LENGHT_EMEM >  MEM_CFG_MFRPMBUS_LENGHT_EMEM ? MEM_CFG_BLABOX_LENGHT_EMEM : MEM_CFG_MFRPMBUS_LENGHT_EMEM)
 #define MEM_CFG_BIFFER_MAX_LEN          (MEM_CFG_BIFFER_MAX_LEN_1 >  MEM_CFG_FWREV_LENGHT_EMEM ? MEM_CFG_BIFFER_MAX_LEN_1 : MEM_CFG_FWREV_LENGHT_EMEM)
 
+/* EEPROM pages of the Emem, dirty tracked and write counted page by page */
+#define MEM_CFG_PAGE_NUM                ((MEM_CFG_LENGHT_EMEM + MEM_CFG_EEPROM_PAGE_SIZE - 1u) / MEM_CFG_EEPROM_PAGE_SIZE)
+
 /*******************************************************************************
  * Global data types (typedefs / structs / enums)
  ******************************************************************************/
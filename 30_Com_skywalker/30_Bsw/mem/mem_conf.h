@@ -84,6 +84,10 @@
 #define EEP_ADR_EXIT_SLEEP_LS_STR	    		  		0x0090
 #define EEP_ADR_EXIT_SLEEP_LS_END	    		  		0x0094
 
+/* Emem page write counters: MEM_CFG_PAGE_NUM x 4 bytes little endian + CRC */
+#define EEP_ADR_MEM_PAGE_WR_CNT_STR             0x00A0
+#define EEP_ADR_MEM_PAGE_WR_CNT_SIZE            (MEM_CFG_PAGE_NUM * 4u + 1u)
+
 /* EEPROM address for black box  */
 #define EEP_ADR_BLACK_BOX_STR           0x0300
 #define EEP_ADR_BLACK_BOX_SIZE          384u   
@@ -100,6 +104,11 @@
 #define EEP_V1_CHA_TRIM_DEFAULT                 4095
 #define EEP_V1_CHB_TRIM_DEFAULT                 4095
 
+/* Emem writes waiting in the EEPROM queue, power of 2 */
+#define MEM_CONF_FLUSH_NUM                      4u
+/* Emem page writes before the page write counters are saved */
+#define MEM_CONF_WR_CNT_SAVE_STEP               16u
+
 
 #ifdef __cplusplus
   }
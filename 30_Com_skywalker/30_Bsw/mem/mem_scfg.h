@@ -38,9 +38,9 @@ SINLINE void MEM_SCFG_vReadMem(uint8* pu8Buffer, uint16 u16ReadAddr, uint16 u16N
 	(void)EEPROM_u32ReadBuffer(pu8Buffer, u16ReadAddr,u16NumByteToRead);
 }
 
-SINLINE void MEM_SCFG_vWriteMem(uint16 u16ReadAddr, const uint8* pu8Buffer,  uint16 u16NumByteToWrite)
+SINLINE uint8 MEM_SCFG_u8WriteMem(uint16 u16WriteAddr, const uint8* pu8Buffer, uint16 u16NumByteToWrite, EEPROM_pfvDone pfvDone)
 {
-	(void)EEPROM_u32WriteBuffer(pu8Buffer, u16ReadAddr,u16NumByteToWrite);
+	return EEPROM_u8QueueWrite(pu8Buffer, u16WriteAddr, u16NumByteToWrite, pfvDone);
 }
 
 SINLINE uint8 MEM_SCFG_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
@@ -53,14 +53,19 @@ SINLINE void MEM_SCFG_vVsbTrimDuty(uint16 u16Duty)
 	PWM_vPwmDutyUpdate(PWM_CFG_E_INDEX_PWM_Vsb_Trim,u16Duty);
 }
 
-SINLINE uint8 MEM_SCFG_u8IsEepromStandbyState()
+SINLINE uint32 MEM_SCFG_u32ReadBootloaderFwVer()
 {
-  return TRUE;//(uint8)(EEPROM_u32WaitEepromStandbyState() == 0?1u:0U);
+  return FLASH_u32BootloaderFwVer();
 }
 
-SINLINE uint32 MEM_SCFG_u32ReadBootloaderFwVer()
+SINLINE void MEM_SCFG_vDisableIrq(void)
 {
-  return FLASH_u32BootloaderFwVer();
+	__disable_irq();
+}
+
+SINLINE void MEM_SCFG_vEnableIrq(void)
+{
+	__enable_irq();
 }
 
 
@@ -156,9 +156,11 @@ volatile uint8 RTE_u8I2cExpTxCnt;
 volatile uint8 RTE_u8I2cExpRxCnt;
 volatile uint8 RTE_u8I2cRxCnt;
 volatile uint8 RTE_u8I2cPECErrCmd;
+volatile uint8 RTE_u8SmbAlertAra;     /* TRUE = alert response sent, SMBALERT# released */
 volatile uint8 RTE_u8I2cTxLen;
 volatile uint8 RTE_u8I2cPEC;
 volatile uint8 RTE_au8I2cTxBuf[I2C_TX_BUF_SIZE+1];
+const volatile uint8 *volatile RTE_pu8I2cTxData = RTE_au8I2cTxBuf;   /* Read data streamed by the I2C ISR */
 volatile uint8 RTE_au8I2cRxBuf[I2C_RX_BUF_SIZE+1];
 
 uint8 RTE_u8InputLedState;
@@ -172,7 +174,6 @@ FANCTRL_U_STATUS_12 FANCTRL_uFanStatus34;
 PMBUS_U_OPERATION PMBUS_uOperation;
 PMBUS_U_SYS_STATUS0 PMBUS_uSysStatu0;
 PMBUS_U_SYS_STATUS1 PMBUS_uSysStatu1;
-PMBUS_U_UPD_STATUS0 PMBUS_uDataUpdStatus;
 PMBUS_U_UPD_STATUS1 PMBUS_uDataUpdStatus1;
 PMBUS_S_DATA   PMBUS_tData;
 PMBUS_S_STATUS PMBUS_tStatus;
@@ -246,6 +247,7 @@ void RTE_vInit(void)
   RTE_Sec.u16SecStatus01.ALL = 0;
   RTE_Sec.u16SecDebug1.u16Val = 0;
   RTE_Sec.u16SecDebug2.u16Val = 0;
+  RTE_Sec.u16SecCpuLoad.u16Val = 0;
 	RTE_Sec.u161mVSrNtcAvg.u16Val = 0;
 	RTE_Sec.u161mVOringNtcAvg.u16Val = 0;
 	
@@ -117,6 +117,9 @@
 #define RTE_UART1_TX_PRI_2                1U
 #define RTE_UART1_TX_PRI_ALL              2U
 
+/* Secondary ISR timing monitor: time base and LLC control ISR, each jitter, average and maximum execution time (0.1us), overruns */
+#define RTE_SEC_ISR_MON_NUM               8U
+
 #if (2U == RTE_UART_CHANNEL_USED)
 /* 0: only TX to SEC1, 1: TX to SEC1 and SEC2, 2: TX to SEC1 and SEC2 and broadcast*/
   #define RTE_UART2_TX_SEC_SEQUENCE       0U
@@ -646,6 +649,7 @@ typedef struct CALI_S_DATA_
  **********************************************/
 #define I2C_RX_BUF_SIZE            255u
 #define I2C_TX_BUF_SIZE            255u
+#define RTE_I2C_PMBUS_FM_PLUS      1u      /* 1 = PMBus slave for Fast-mode Plus (1 MHz), 0 = up to 400 kHz */
 
 #define RTE_COM_A0_FLG           RTE_u16I2cStatus0.Bits.f0  
 #define RTE_COM_A1_FLG           RTE_u16I2cStatus0.Bits.f1 
@@ -659,6 +663,7 @@ typedef struct CALI_S_DATA_
 #define RTE_I2C_PEC_ERR_FLG      RTE_u16I2cStatus0.Bits.f9
 #define RTE_I2C_PEC_CHANGE_FLG   RTE_u16I2cStatus0.Bits.fa
 #define RTE_I2C_CMD_DETECTED     RTE_u16I2cStatus0.Bits.fb
+#define RTE_I2C_TX_PEC_RDY       RTE_u16I2cStatus0.Bits.fc   /* 1 = RTE_u8I2cPEC already holds the PEC of the read */
 
 /***********************************************
  * UART
@@ -721,6 +726,8 @@ typedef struct RTE_S_INTCOM2_DATA_
   WORD_VAL u16SecDebug0;
   WORD_VAL u16SecDebug1;
   WORD_VAL u16SecDebug2;
+  WORD_VAL u16SecCpuLoad;
+  WORD_VAL au16SecIsrMon[RTE_SEC_ISR_MON_NUM];
   WORD_VAL u1610mVIntV1Avg;
   WORD_VAL u1610mVExtV1Avg;
   WORD_VAL u1610mAIoutAvg;
@@ -1050,49 +1057,16 @@ typedef union PMBUS_U_STATUS_FAN_34_
   } Bits;
 } PMBUS_U_STATUS_FAN_34;
 
-typedef union PMBUS_U_UPD_STATUS0_
-{
-  uint16 ALL;
-
-  struct
-  {
-    uint16 VIN_UPDTING : 1; /* bit0 */
-    uint16 IIN_UPDTING : 1; /* bit1 */
-    uint16 PIN_UPDTING : 1; /* bit2 */
-    uint16 VOUT_V1_UPDTING : 1; /* bit3 */
-    uint16 IOUT_V1_UPDTING : 1; /* bit4 */
-    uint16 VOUT_VSB_UPDTING : 1; /* bit5 */
-    uint16 IOUT_VSB_UPDTING : 1; /* bit6 */
-    uint16 POUT_V1_UPDTING : 1; /* bit7 */
-    uint16 TEMP_INLET_UPDTING : 1; /* bit8 */
-    uint16 TEMP_PFC_UPDTING : 1; /* bit9 */
-    uint16 TEMP_SR_UPDTING : 1; /* bitA */
-		uint16 HOURS_USED_UPDTING : 1; /* bitB */
-    uint16 FAN_SPD_1_UPDTING : 1; /* bitC */
-    uint16 FAN_SPD_2_UPDTING : 1; /* bitD */
-    uint16 FAN_SPD_3_UPDTING : 1; /* bitE */
-    uint16 FAN_SPD_4_UPDTING : 1; /* bitF */
-  } Bits;
-} PMBUS_U_UPD_STATUS0;
-
 typedef union PMBUS_U_UPD_STATUS1_
 {
   uint16 ALL;
 
   struct
   {
-    uint16 EIN_UPDTING : 1;           /* bit0 */
-    uint16 EOUT_UPDTING : 1;          /* bit1 */
-    uint16 STATUS_78_82_UPDTING : 1;  /* bit2 */
-    uint16 POUT_VSB_UPDTING : 1;      /* bit3 */
-    uint16 FALT_UPDT_V1_VI_OUT : 1;   /* bit4 */
-    uint16 FALT_UPDT_VSB_VI_OUT : 1;  /* bit5 */
-		uint16 VOUT_V1_ISHARE_UPDTING :1; /* bit6 */
-		uint16 VOUT_V1_SENSE_UPDTING :1;  /* bit7 */
-		uint16 VCAP_UPDTING :1;      /* bit8 */
-    uint16 MFR_POS_TOTAL:1;      /* bit9 */
-    uint16 MFR_POS_LAST:1;       /* bitA */
-    uint16 RESERVED : 5;         /* bitB~F */
+    uint16 STATUS_78_82_UPDTING : 1;  /* bit0 */
+    uint16 FALT_UPDT_V1_VI_OUT : 1;   /* bit1 */
+    uint16 FALT_UPDT_VSB_VI_OUT : 1;  /* bit2 */
+    uint16 RESERVED : 13;             /* bit3~F */
   } Bits;
 } PMBUS_U_UPD_STATUS1;
 
@@ -1235,24 +1209,15 @@ typedef struct PMBUS_S_DATA_
   WORD_VAL u16FanCmd_3_Linear;
   WORD_VAL u16FanCmd_4_Linear;
   DWORD_VAL u32HoursUsed;
-  DWORD_VAL u32DataCopy;
 
   DWORD_VAL u32PinEnergyCtr;
   DWORD_VAL u32PinSampleCount;
   uint8 u8PinRolloverCount;
 
-  DWORD_VAL u32PinEnergyCtr_Old;
-  DWORD_VAL u32PinSampleCount_Old;
-  uint8 u8PinRolloverCount_Old;
-
   DWORD_VAL u32PoutEnergyCtr;
   DWORD_VAL u32PoutSampleCount;
   uint8 u8PoutRolloverCount;
 
-  DWORD_VAL u32PoutEnergyCtr_Old;
-  DWORD_VAL u32PoutSampleCount_Old;
-  uint8 u8PoutRolloverCount_Old;
-
   uint8 u8CrMode;
 
   struct
@@ -1427,6 +1392,7 @@ extern uint16 RTE_u16CaliIout;
 extern uint8  RTE_au8MfrData[6][17];
 
 extern volatile uint8 RTE_au8I2cTxBuf[I2C_TX_BUF_SIZE+1];
+extern const volatile uint8 *volatile RTE_pu8I2cTxData;
 extern volatile uint8 RTE_au8I2cRxBuf[I2C_RX_BUF_SIZE+1];
 extern volatile uint8 RTE_u8I2cPEC;
 extern volatile uint8 RTE_u8I2cExpTxCnt;
@@ -1434,6 +1400,7 @@ extern volatile uint8 RTE_u8I2cExpRxCnt;
 extern volatile uint8 RTE_u8I2cRxCnt;
 extern volatile uint8 RTE_u8I2cTxLen;
 extern volatile uint8 RTE_u8I2cPECErrCmd;
+extern volatile uint8 RTE_u8SmbAlertAra;
 extern uint16 RTE_u16VoutIntVsbFast;
 extern uint16 RTE_u16VoutExtVsbFast;
 extern uint16 RTE_u16IoutVsbFast;
@@ -1464,7 +1431,6 @@ extern uint8 RTE_u8PmbusCommand;
 extern PMBUS_U_OPERATION PMBUS_uOperation;
 extern PMBUS_U_SYS_STATUS0 PMBUS_uSysStatu0;
 extern PMBUS_U_SYS_STATUS1 PMBUS_uSysStatu1;
-extern PMBUS_U_UPD_STATUS0 PMBUS_uDataUpdStatus;
 extern PMBUS_U_UPD_STATUS1 PMBUS_uDataUpdStatus1;
 extern PMBUS_S_DATA   PMBUS_tData;
 extern PMBUS_S_STATUS PMBUS_tStatus;
@@ -19,6 +19,8 @@
  * Included header
  ******************************************************************************/
 
+#include <StdPeriphDriver.h>
+
 /* Module header */
 #define SCHM_EXPORT_H
 	#include "schm_api.h"
@@ -31,26 +33,122 @@
 /*******************************************************************************
  * Local constants and macros (private to module)
  ******************************************************************************/
- 
 
-  
+/* Levels of the scheduler, one per task period except the tick tasks */
+#define MG_LEVEL_NUM            ((uint8)(SCHM_CFG_E_PERIOD_COUNT - SCHM_CFG_E_PERIOD_1MS))
+
+/* Task slots: tick tasks, then the slots of the levels (see SCHM_u16GetSlotProf) */
+#define MG_SLOT_TICK            ((uint8)0U)
+#define MG_SLOT_FIRST_LEVEL     ((uint8)1U)
+#define MG_SLOT_COUNT           ((uint8)(MG_SLOT_FIRST_LEVEL + SCHM_SLOT_NUM))
+
+#define MG_TASK_NUM             DIM(SCHM_mg_asTask)
+
+/* Slots of a task period */
+#define MG_PHASE_NUM(ePeriod)   (((ePeriod) == SCHM_CFG_E_PERIOD_TICK)  ? 1U :                  \
+                                 ((ePeriod) == SCHM_CFG_E_PERIOD_1MS)   ? SCHM_SLOT_1MS_NUM :   \
+                                 ((ePeriod) == SCHM_CFG_E_PERIOD_10MS)  ? SCHM_SLOT_10MS_NUM :  \
+                                 ((ePeriod) == SCHM_CFG_E_PERIOD_100MS) ? SCHM_SLOT_100MS_NUM : \
+                                                                          SCHM_SLOT_500MS_NUM)
+
+/***************************************
+ * Build time check of the task table
+ **************************************/
+#define MG_TASK_ENTRY(A, B, pvTask, ePeriod, u8Phase, u16Wcet) \
+  { pvTask, (uint8)(ePeriod), (uint8)(u8Phase), (uint16)(u16Wcet) },
+
+/* Number of tasks whose phase is outside of their period */
+#define MG_TASK_BAD_PHASE(A, B, pvTask, ePeriod, u8Phase, u16Wcet) \
+  + (((u8Phase) >= MG_PHASE_NUM(ePeriod)) ? 1U : 0U)
+
+/* WCET budget sum of the tasks of one slot */
+#define MG_TASK_WCET(ePer, u8Ph, pvTask, ePeriod, u8Phase, u16Wcet) \
+  + ((((ePer) == (ePeriod)) && ((u8Ph) == (u8Phase))) ? (u16Wcet) : 0U)
+#define MG_SLOT_WCET(ePer, u8Ph) \
+  (0U SCHM_CFG_TASK_TABLE(MG_TASK_WCET, ePer, u8Ph))
+
+/* Tick tasks and the tasks of one slot fit into the tick */
+#define MG_SLOT_FITS(ePer, u8Ph) \
+  ((MG_SLOT_WCET(SCHM_CFG_E_PERIOD_TICK, 0U) + MG_SLOT_WCET(ePer, u8Ph)) <= MG_SCHM_TICK_US)
+#define MG_PERIOD_FITS(ePer) \
+  (MG_SLOT_FITS(ePer, 0U) && MG_SLOT_FITS(ePer, 1U) && MG_SLOT_FITS(ePer, 2U) && \
+   MG_SLOT_FITS(ePer, 3U) && MG_SLOT_FITS(ePer, 4U) && MG_SLOT_FITS(ePer, 5U) && \
+   MG_SLOT_FITS(ePer, 6U) && MG_SLOT_FITS(ePer, 7U) && MG_SLOT_FITS(ePer, 8U) && \
+   MG_SLOT_FITS(ePer, 9U))
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
 
 typedef struct
 {
-  uint8 u8CtrBase;
-  uint8 u8Ctr1ms;
-  uint8 u8Ctr10ms;
-  uint8 u8Ctr100ms;
-} MG_S_FLOW_CTRL;
+  void (*pvTask)(void);
+  uint8  u8Period;     /* SCHM_CFG_E_PERIOD */
+  uint8  u8Phase;      /* Slot within the period */
+  uint16 u16WcetUs;    /* Run time budget (us) */
+} MG_S_TASK;
+
+/* Compilation fails here if the task table does not fit into the tick */
+typedef char MG_AC_CHECK_TASK_PHASE[((0U SCHM_CFG_TASK_TABLE(MG_TASK_BAD_PHASE, 0U, 0U)) == 0U) ? 1 : -1];
+typedef char MG_AC_CHECK_SLOT_BUDGET[(MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_1MS)   &&
+                                      MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_10MS)  &&
+                                      MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_100MS) &&
+                                      MG_PERIOD_FITS(SCHM_CFG_E_PERIOD_500MS)) ? 1 : -1];
+
+#if MG_SCHM_PROFILE
+/* Run time of one slot in timer counts */
+typedef struct
+{
+  uint16 u16Min;
+  uint16 u16Max;
+  uint16 u16Avg;       /* Average of the last completed window */
+  uint16 u16Overrun;
+  uint32 u32Sum;
+  uint8  u8Cnt;
+} MG_S_SLOT_PROF;
+#endif
 
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
 
-static MG_S_FLOW_CTRL   SCHM_mg_sFlowCtrl;
+static const MG_S_TASK SCHM_mg_asTask[] =
+{
+  SCHM_CFG_TASK_TABLE(MG_TASK_ENTRY, 0U, 0U)
+};
+
+/* Slots per level, the last slot of a level (but the slowest) runs the next level */
+static const uint8 SCHM_mg_au8LevelSlots[MG_LEVEL_NUM] =
+{
+  SCHM_SLOT_1MS_NUM + 1U,
+  SCHM_SLOT_10MS_NUM + 1U,
+  SCHM_SLOT_100MS_NUM + 1U,
+  SCHM_SLOT_500MS_NUM
+};
+
+/* First task slot of each level */
+static const uint8 SCHM_mg_au8LevelFirstSlot[MG_LEVEL_NUM] =
+{
+  MG_SLOT_FIRST_LEVEL,
+  MG_SLOT_FIRST_LEVEL + SCHM_SLOT_1MS_NUM,
+  MG_SLOT_FIRST_LEVEL + SCHM_SLOT_1MS_NUM + SCHM_SLOT_10MS_NUM,
+  MG_SLOT_FIRST_LEVEL + SCHM_SLOT_1MS_NUM + SCHM_SLOT_10MS_NUM + SCHM_SLOT_100MS_NUM
+};
+
+static uint8            SCHM_mg_au8LevelCtr[MG_LEVEL_NUM];
+/* Tasks sorted by slot: tasks of slot n are SCHM_mg_au8TaskIdx[au8SlotFirst[n] .. au8SlotFirst[n + 1] - 1] */
+static uint8            SCHM_mg_au8TaskIdx[MG_TASK_NUM];
+static uint8            SCHM_mg_au8SlotFirst[MG_SLOT_COUNT + 1U];
+/* Ticks handled by SCHM_vSchmRoutine(), base of SCHM_u32GetTimeStamp() */
+static volatile uint32  SCHM_mg_u32TickCnt;
+#if MG_SCHM_CPU_LOAD
+static uint32           SCHM_mg_u32IdleCnt;       /* Idle timer counts of the running window */
+static uint16           SCHM_mg_u16LoadTickCtr;
+static uint16           SCHM_mg_u16CpuLoad = 1000U;
+#endif
+#if MG_SCHM_PROFILE
+static MG_S_SLOT_PROF   SCHM_mg_asSlotProf[SCHM_SLOT_NUM];
+#endif
 uint16 ADC_Test=0;
 
 /*******************************************************************************
@@ -59,6 +157,15 @@ uint16 ADC_Test=0;
 #if !MG_TIME_BASE_ISR
 void SCHM_vSchmRoutine(void);
 #endif
+static uint8 mg_u8TaskSlot(uint8 u8Task);
+static void mg_vBuildTaskIndex(void);
+static void mg_vRunSlot(uint8 u8Slot);
+#if MG_SCHM_PROFILE
+static void mg_vProfileSlot(uint8 u8Slot, uint16 u16StartCnt);
+#endif
+#if MG_SCHM_CPU_LOAD
+static void mg_vUpdateCpuLoad(void);
+#endif
 /*******************************************************************************
  * Global functions (public to other modules)
  ******************************************************************************/
@@ -66,6 +173,9 @@ void SCHM_vInit(void)
 {
   /* Disable IRQ Interrupts */
   SCHM_scfg_vDisableIrq();
+
+  /* Sort the task table by slot */
+  mg_vBuildTaskIndex();
 	
   /***************************************
    * Initialize MCAL modules
@@ -117,6 +227,11 @@ void SCHM_vInit(void)
   /* Check if boot loader existing flag is written to flash */
   SCHM_cfg_vHwioCheckBootLoaderExistFlg();
 
+  #if ((!MG_TIME_BASE_ISR) && MG_SCHM_IDLE_SLEEP)
+  /* The time base tick wakes up the idle loop */
+  SCHM_scfg_vTimerEnableWakeUp();
+  #endif
+
   /* Set the watch dog time out delay */
   SCHM_scfg_vWdgSetTimeOutDly(MG_WDG_TIME_OUT_DLY);
 	
@@ -154,6 +269,10 @@ void SCHM_vDeInit(void)
  ***************************************************************************** */
 void SCHM_vSchmIdleLoop(void)
 {
+  #if ((!MG_TIME_BASE_ISR) && MG_SCHM_CPU_LOAD)
+  uint32 u32IdleStart;
+  #endif
+
   /* Feed the watchdog */
   SCHM_scfg_vWdgFeed();
 
@@ -163,6 +282,28 @@ void SCHM_vSchmIdleLoop(void)
     {
       SCHM_vSchmRoutine();
     }
+    else
+    {
+      #if MG_SCHM_CPU_LOAD
+      /* Interrupts that wake up the CPU run after the idle time is taken */
+      SCHM_scfg_vDisableIrq();
+      u32IdleStart = SCHM_u32GetTimeStamp();
+      #endif
+
+      #if MG_SCHM_IDLE_SLEEP
+      /* The pending bit of the handled tick would not be a new event */
+      SCHM_scfg_vTimerClearWakeUp();
+      if (FALSE == SCHM_scfg_u8TimerGetUpdateItFlg())
+      {
+        SCHM_scfg_vWaitForEvent();
+      }
+      #endif
+
+      #if MG_SCHM_CPU_LOAD
+      SCHM_mg_u32IdleCnt += SCHM_u32GetTimeStamp() - u32IdleStart;
+      SCHM_scfg_vEnableIrq();
+      #endif
+    }
   #endif
 }
 
@@ -182,256 +323,345 @@ void MG_VECT_TIME_BASE_ISR
 void SCHM_vSchmRoutine(void)
 #endif
 {
-	
+	#if MG_SCHM_PROFILE
+	uint16 u16ProfStartCnt = SCHM_scfg_u16TimerGetCounter();
+	#endif
+	uint8 u8Level = 0U;
+	uint8 u8Slot;
+
+	/* Flag and tick counter change together for SCHM_u32GetTimeStamp() */
+	SCHM_scfg_vDisableIrq();
 	SCHM_scfg_vTimerClearUpdateItFlg();
+	SCHM_mg_u32TickCnt++;
+	SCHM_scfg_vEnableIrq();
+
+	#if MG_SCHM_CPU_LOAD
+	mg_vUpdateCpuLoad();
+	#endif
+
+	/* Tasks of every tick */
+	mg_vRunSlot(MG_SLOT_TICK);
 
-	SCHM_cfg_vUartPrtTxData();
-	SCHM_scfg_vI2cTimeOutHandler();
-	SCHM_cfg_vFanSpeedCnt();
-	SCHM_cfg_vHwioReadGpioPin();
-  SCHM_cfg_vHwioSetGpioPin();
-  SCHM_cfg_vCalibrateIShare();
-  SCHM_cfg_vCaliFast();
-  SCHM_cfg_vMonCtrlCheckVsbOvp();
-
-	/* Increase basic counter */
-	SCHM_mg_sFlowCtrl.u8CtrBase++;
-	/***********************************************
-	* 1ms task repetition
-	**********************************************/
-	switch (SCHM_mg_sFlowCtrl.u8CtrBase)
+	/* The last slot of a level passes the tick on to the next level */
+	while ((u8Level < (MG_LEVEL_NUM - 1U)) &&
+	       (SCHM_mg_au8LevelCtr[u8Level] >= (SCHM_mg_au8LevelSlots[u8Level] - 1U)))
 	{
-		case 1:
-		{
-			SCHM_cfg_vUartPrtTmOutMon();
-			break;
-		}
-		case 2:
-		{
-			SCHM_cfg_vUartPrtHandleTxData();
-			break;
-		}
-		case 3:
-		{
-			SCHM_cfg_vUartPrtHandleRxData();
-			break;
-		}
-		case 4:
-		{
-                        SCHM_cfg_vMonCtrlVsbOutput();
-			SCHM_cfg_vPsuCtrlVsbOut();
-			break;
-		}
-		case 5:
-		{
-			SCHM_cfg_vPsuCtrlV1Out();
-			break;
-		}
-		case 6:
-		{
-			SCHM_cfg_vTempCtrlNtcVoltAverage();
-			break;
-		}
-		case 7:
-		{
-			SCHM_cfg_vI2cprtProcessRxData();
-			SCHM_cfg_vPmbusCopyPecAndOringStatus();
-			break;
-		}
-		case 8:
-		{
-			SCHM_cfg_vIntComTmOutMOn();
-      SCHM_cfg_vBufferCalc1ms();
-			break;
-		}
-		case 9:
-		{
-      SCHM_cfg_vMonCtrlVin();
-			break;
-		}
-		case 10:
+		SCHM_mg_au8LevelCtr[u8Level] = 0U;
+		u8Level++;
+	}
+
+	u8Slot = SCHM_mg_au8LevelFirstSlot[u8Level] + SCHM_mg_au8LevelCtr[u8Level];
+	SCHM_mg_au8LevelCtr[u8Level]++;
+	if (SCHM_mg_au8LevelCtr[u8Level] >= SCHM_mg_au8LevelSlots[u8Level])
+	{
+		/* Slowest level wraps around */
+		SCHM_mg_au8LevelCtr[u8Level] = 0U;
+	}
+
+	mg_vRunSlot(u8Slot);
+
+	#if MG_SCHM_PROFILE
+	mg_vProfileSlot(u8Slot - MG_SLOT_FIRST_LEVEL, u16ProfStartCnt);
+	#endif
+}
+
+/** *****************************************************************************
+ * \brief         Read one value of the slot run time profiler
+ *
+ * \param[in]     u8Slot: slot index, 100us cases first, then 1ms, 10ms, 100ms
+ * \param[in]     eItem:  value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Run time in 0.1us or overrun counter, 0 if not profiled
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetSlotProf(uint8 u8Slot, SCHM_E_PROF eItem)
+{
+	uint32 u32Val = 0U;
+	#if MG_SCHM_PROFILE
+	MG_S_SLOT_PROF *psProf;
+
+	if (u8Slot < SCHM_SLOT_NUM)
+	{
+		psProf = &SCHM_mg_asSlotProf[u8Slot];
+		switch (eItem)
 		{
-			/* Reset basic counter */
-			SCHM_mg_sFlowCtrl.u8CtrBase = 0U;
-			/* Increase 1ms counter */
-			SCHM_mg_sFlowCtrl.u8Ctr1ms++;
-		
-			/***********************************************
-			 * 10ms task repetition
-			 **********************************************/
-			switch(SCHM_mg_sFlowCtrl.u8Ctr1ms)
+			case SCHM_E_PROF_MIN:
 			{
-				case 1:
-				{
-					SCHM_cfg_vCaliHandler();
-					break;
-				}
-				case 2:
-				{
-					SCHM_cfg_vPmbusCopySensorData();
-					break;
-				}
-				case 3:
-				{
-					SCHM_cfg_vMonCtrlUpdateStatus();
-					SCHM_cfg_vLedControl();
-					break;
-				}
-				case 4:
-				{
-					SCHM_cfg_vPsuCtrlTrim();
-          SCHM_cfg_vCalcCaliPara();
-					break;
-				}
-				case 5:
-				{
-					SCHM_cfg_vFanSpeedCalc();
-					break;
-				}
-				case 6:
-				{
-				  SCHM_cfg_vPmbusCheckBootMode();
-          SCHM_cfg_vBufferCalc10ms();
-					break;
-				}
-				case 7:
-				{
-					SCHM_cfg_vI2cprtUpdateI2cAddr();
-					break;
-				}
-				case 8:
-				{
-					SCHM_cfg_vProcessBlackbox();
-					break;
-				}
-				case 9:
-				{
-					SCHM_cfg_vMemSaveData();
-					break;
-				}
-				case 10:
+				u32Val = psProf->u16Min;
+				break;
+			}
+			case SCHM_E_PROF_AVG:
+			{
+				/* Running average until the first window is completed */
+				if ((0U == psProf->u16Avg) && (0U != psProf->u8Cnt))
 				{
-					/* Reset 1ms counter */
-					SCHM_mg_sFlowCtrl.u8Ctr1ms = 0U;
-					/* Increase 10ms counter */
-					SCHM_mg_sFlowCtrl.u8Ctr10ms++;
-				
-					/***********************************************
-					 * 100ms task repetition
-					 **********************************************/
-					switch(SCHM_mg_sFlowCtrl.u8Ctr10ms)
-					{
-						case 1:
-						{
-							SCHM_cfg_vFanCtrl();
-							SCHM_cfg_vCheckACBlackBox();
-							break;
-						}
-						case 2:
-						{
-							SCHM_cfg_vMonCtrlCheckStatusReset();
-							SCHM_cfg_vTimePSONBlackBox();
-							break;
-						}
-						case 3:
-						{
-							SCHM_cfg_vPmbusCopyStatusData();
-							SCHM_cfg_vCountRealTimeClockDataSystemBlackbox();
-							break;
-						}
-						case 4:
-						{
-							SCHM_cfg_vTempCtrlLookUpNtcTemperature();
-							SCHM_cfg_vClearWarning();
-							break;
-						}
-						case 5:
-						{
-						  SCHM_cfg_vPmbusCopyDebugData();
-							break;
-						}
-						case 6:
-						{
-              SCHM_cfg_vTempCtrlNtcVoltMonitor();
-							break;
-						}
-						case 7:
-						{
-							SCHM_cfg_vMonCtrlAxuModeDetect();
-							break;
-						}
-						case 8:
-						{
-							SCHM_cfg_vCheckPSONBlackBox();
-							break;
-						}
-						case 9:
-						{
-							SCHM_cfg_vTimeCtrlSaveHoursUsed();
-							break;
-						}
-						case 10:
-						{
-							/* Reset 10ms counter */
-							SCHM_mg_sFlowCtrl.u8Ctr10ms = 0U;
-							/* Increase 100ms counter */
-							SCHM_mg_sFlowCtrl.u8Ctr100ms++;
-
-							/***********************************************
-							 * 500ms task repetition
-							 **********************************************/
-							switch(SCHM_mg_sFlowCtrl.u8Ctr100ms)
-							{
-								case 1:
-								{
-									break;
-								}
-								case 2:
-								{
-									break;
-								}
-								case 3:
-								{
-									break;
-								}
-								case 4:
-								{
-									break;
-								}
-								case 5:
-								{
-									SCHM_mg_sFlowCtrl.u8Ctr100ms = 0U;
-									break;
-								}
-							}
-							break;
-						}
-						default:
-						{
-							/* Reset 10ms counter */
-							SCHM_mg_sFlowCtrl.u8Ctr10ms = 0U;
-							break;
-						}
-					} /* switch(10ms) */
-					break;
+					u32Val = psProf->u32Sum / psProf->u8Cnt;
 				}
-				default:
+				else
 				{
-					/* Reset 1ms counter */
-					SCHM_mg_sFlowCtrl.u8Ctr1ms = 0U;
-					break;
+					u32Val = psProf->u16Avg;
 				}
-			} /* switch(1ms) */
-			break;
+				break;
+			}
+			case SCHM_E_PROF_MAX:
+			{
+				u32Val = psProf->u16Max;
+				break;
+			}
+			case SCHM_E_PROF_OVERRUN:
+			{
+				return psProf->u16Overrun;
+			}
+			default:
+			{
+				break;
+			}
+		}
+		/* Timer counts to 0.1us */
+		u32Val = (u32Val * 10U) / MG_SCHM_PROF_CNT_PER_US;
+	}
+	#endif
+	return (uint16)u32Val;
+}
+
+/** *****************************************************************************
+ * \brief         Free running time stamp in time base timer counts. Can be
+ *                called from interrupts; exact as long as the scheduler routine
+ *                keeps up with the ticks.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Time stamp, MG_SCHM_PROF_TICK_CNT counts per tick
+ *
+ ***************************************************************************** */
+uint32 SCHM_u32GetTimeStamp(void)
+{
+	uint32 u32Tick;
+	uint16 u16Cnt;
+	uint8  u8Due;
+
+	do
+	{
+		u32Tick = SCHM_mg_u32TickCnt;
+		u8Due = SCHM_scfg_u8TimerGetUpdateItFlg();
+		u16Cnt = SCHM_scfg_u16TimerGetCounter();
+		/* Update event between the two reads: take the counter after the wrap */
+		if ((FALSE == u8Due) && (FALSE != SCHM_scfg_u8TimerGetUpdateItFlg()))
+		{
+			u8Due = TRUE;
+			u16Cnt = SCHM_scfg_u16TimerGetCounter();
 		}
-		default:
+	} while (u32Tick != SCHM_mg_u32TickCnt);
+
+	/* A due tick that the routine has not handled yet */
+	if (FALSE != u8Due)
+	{
+		u32Tick++;
+	}
+	return (u32Tick * MG_SCHM_PROF_TICK_CNT) + u16Cnt;
+}
+
+/** *****************************************************************************
+ * \brief         CPU load of the last 1s window. Time not spent in the idle
+ *                loop counts as busy, 1000 if the load is not measured.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        CPU load (0.1%)
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetCpuLoad(void)
+{
+	#if MG_SCHM_CPU_LOAD
+	return SCHM_mg_u16CpuLoad;
+	#else
+	return 1000U;
+	#endif
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Task slot of a task table entry
+ *
+ * \param[in]     u8Task: index in the task table
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Task slot
+ *
+ ***************************************************************************** */
+static uint8 mg_u8TaskSlot(uint8 u8Task)
+{
+	const MG_S_TASK *psTask = &SCHM_mg_asTask[u8Task];
+
+	if (SCHM_CFG_E_PERIOD_TICK == psTask->u8Period)
+	{
+		return MG_SLOT_TICK;
+	}
+	return (SCHM_mg_au8LevelFirstSlot[psTask->u8Period - SCHM_CFG_E_PERIOD_1MS] + psTask->u8Phase);
+}
+
+/** *****************************************************************************
+ * \brief         Sort the task table by slot, keeping the table order within a
+ *                slot
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vBuildTaskIndex(void)
+{
+	uint8 au8Next[MG_SLOT_COUNT];
+	uint8 u8Slot;
+	uint8 u8Task;
+
+	for (u8Slot = 0U; u8Slot <= MG_SLOT_COUNT; u8Slot++)
+	{
+		SCHM_mg_au8SlotFirst[u8Slot] = 0U;
+	}
+	for (u8Slot = 0U; u8Slot < MG_LEVEL_NUM; u8Slot++)
+	{
+		SCHM_mg_au8LevelCtr[u8Slot] = 0U;
+	}
+
+	/* Count the tasks per slot */
+	for (u8Task = 0U; u8Task < MG_TASK_NUM; u8Task++)
+	{
+		SCHM_mg_au8SlotFirst[mg_u8TaskSlot(u8Task) + 1U]++;
+	}
+	for (u8Slot = 0U; u8Slot < MG_SLOT_COUNT; u8Slot++)
+	{
+		SCHM_mg_au8SlotFirst[u8Slot + 1U] += SCHM_mg_au8SlotFirst[u8Slot];
+		au8Next[u8Slot] = SCHM_mg_au8SlotFirst[u8Slot];
+	}
+
+	for (u8Task = 0U; u8Task < MG_TASK_NUM; u8Task++)
+	{
+		u8Slot = mg_u8TaskSlot(u8Task);
+		SCHM_mg_au8TaskIdx[au8Next[u8Slot]++] = u8Task;
+	}
+}
+
+/** *****************************************************************************
+ * \brief         Run the tasks of a slot
+ *
+ * \param[in]     u8Slot: task slot
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vRunSlot(uint8 u8Slot)
+{
+	uint8 u8Idx;
+
+	for (u8Idx = SCHM_mg_au8SlotFirst[u8Slot]; u8Idx < SCHM_mg_au8SlotFirst[u8Slot + 1U]; u8Idx++)
+	{
+		SCHM_mg_asTask[SCHM_mg_au8TaskIdx[u8Idx]].pvTask();
+	}
+}
+
+#if MG_SCHM_PROFILE
+/** *****************************************************************************
+ * \brief         Account the run time of the routine to the executed slot.
+ *                Cortex-M0 has no DWT cycle counter, the time base timer
+ *                counts CPU cycles within the tick instead.
+ *
+ * \param[in]     u8Slot:      slot index
+ * \param[in]     u16StartCnt: timer counter at routine entry
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vProfileSlot(uint8 u8Slot, uint16 u16StartCnt)
+{
+	MG_S_SLOT_PROF *psProf = &SCHM_mg_asSlotProf[u8Slot];
+	uint8  u8Overrun = SCHM_scfg_u8TimerGetUpdateItFlg();
+	uint16 u16EndCnt = SCHM_scfg_u16TimerGetCounter();
+	uint32 u32Exec;
+
+	/* Update event between the two reads: take the counter after the wrap */
+	if ((FALSE == u8Overrun) && (FALSE != SCHM_scfg_u8TimerGetUpdateItFlg()))
+	{
+		u8Overrun = TRUE;
+		u16EndCnt = SCHM_scfg_u16TimerGetCounter();
+	}
+
+	if (FALSE != u8Overrun)
+	{
+		/* Next tick is already due, the slot missed its deadline */
+		u32Exec = MG_SCHM_PROF_TICK_CNT - u16StartCnt + u16EndCnt;
+		if (psProf->u16Overrun < 0xFFFFU)
 		{
-			/* Reset basic counter */
-			SCHM_mg_sFlowCtrl.u8CtrBase = 0U;
-			break;
+			psProf->u16Overrun++;
 		}
-	} /* switch(basic) */
+	}
+	else
+	{
+		u32Exec = (uint32)u16EndCnt - u16StartCnt;
+	}
+	u32Exec = MIN(u32Exec, 0xFFFFU);
+
+	if (((uint16)u32Exec < psProf->u16Min) || (0U == psProf->u16Max))
+	{
+		psProf->u16Min = (uint16)u32Exec;
+	}
+	if ((uint16)u32Exec > psProf->u16Max)
+	{
+		psProf->u16Max = (uint16)u32Exec;
+	}
+
+	psProf->u32Sum += u32Exec;
+	psProf->u8Cnt++;
+	if (psProf->u8Cnt >= (1U << MG_SCHM_PROF_AVG_SHIFT))
+	{
+		psProf->u16Avg = (uint16)(psProf->u32Sum >> MG_SCHM_PROF_AVG_SHIFT);
+		psProf->u32Sum = 0U;
+		psProf->u8Cnt = 0U;
+	}
+}
+#endif
+
+#if MG_SCHM_CPU_LOAD
+/** *****************************************************************************
+ * \brief         Close the CPU load window every MG_SCHM_LOAD_WINDOW_TICKS
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vUpdateCpuLoad(void)
+{
+	uint32 u32IdlePermille;
+
+	SCHM_mg_u16LoadTickCtr++;
+	if (SCHM_mg_u16LoadTickCtr >= MG_SCHM_LOAD_WINDOW_TICKS)
+	{
+		u32IdlePermille = SCHM_mg_u32IdleCnt / MG_SCHM_LOAD_CNT_PER_PERMILLE;
+		SCHM_mg_u16CpuLoad = (uint16)(1000U - MIN(u32IdlePermille, 1000U));
+		SCHM_mg_u32IdleCnt = 0U;
+		SCHM_mg_u16LoadTickCtr = 0U;
+	}
 }
+#endif
 
 /*
  * End of file
@@ -27,6 +27,73 @@
 
 #include "global.h"
 
+/*******************************************************************************
+ * Global constants and macros (public to other modules)
+ ******************************************************************************/
+
+/* Scheduler slots (phases) per task period, one slot runs per tick */
+#define SCHM_SLOT_1MS_NUM               9u      /* 100us slots, 10th tick runs the 10ms slots */
+#define SCHM_SLOT_10MS_NUM              9u      /* 1ms slots, 10th runs the 100ms slots */
+#define SCHM_SLOT_100MS_NUM             9u      /* 10ms slots, 10th runs the 500ms slots */
+#define SCHM_SLOT_500MS_NUM             5u      /* 100ms slots */
+#define SCHM_SLOT_NUM                   (SCHM_SLOT_1MS_NUM + SCHM_SLOT_10MS_NUM + \
+                                         SCHM_SLOT_100MS_NUM + SCHM_SLOT_500MS_NUM)
+
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef enum SCHM_E_PROF_
+{
+  SCHM_E_PROF_MIN = 0,     /* Minimum run time (0.1us) */
+  SCHM_E_PROF_AVG,         /* Average run time (0.1us) */
+  SCHM_E_PROF_MAX,         /* Maximum run time (0.1us) */
+  SCHM_E_PROF_OVERRUN,     /* Number of runs that missed the next tick */
+  SCHM_E_PROF_COUNT
+} SCHM_E_PROF;
+
+/*******************************************************************************
+ * Global function prototypes (public to other modules)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Read one value of the slot run time profiler
+ *
+ * \param[in]     u8Slot: slot index, 1ms period slots first, then 10ms, 100ms, 500ms
+ * \param[in]     eItem:  value to read
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Run time in 0.1us or overrun counter, 0 if not profiled
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetSlotProf(uint8 u8Slot, SCHM_E_PROF eItem);
+
+/** *****************************************************************************
+ * \brief         Free running time stamp of the time base timer, CPU clock
+ *                counts. Differences are valid across scheduler ticks.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Time stamp
+ *
+ ***************************************************************************** */
+uint32 SCHM_u32GetTimeStamp(void);
+
+/** *****************************************************************************
+ * \brief         CPU load of the last 1s window, busy time / total time
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        CPU load (0.1%)
+ *
+ ***************************************************************************** */
+uint16 SCHM_u16GetCpuLoad(void);
+
 
 #ifdef __cplusplus
   }
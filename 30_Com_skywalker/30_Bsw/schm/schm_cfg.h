@@ -300,6 +300,13 @@ SINLINE void SCHM_cfg_vEepromDeInit(void)
 	#endif
 }
 
+SINLINE void SCHM_cfg_vEepromTask(void)
+{
+  #if MG_EEPROM_MODULE
+	EEPROM_vTask();
+	#endif
+}
+
 /* I2CPRT module section*/
 SINLINE void SCHM_cfg_vI2cprtInit(void)
 {
@@ -753,6 +760,80 @@ SINLINE void SCHM_cfg_vClearWarning(void)
   #endif
 }
 
+/*******************************************************************************
+ * Task table
+ ******************************************************************************/
+
+/* Task periods, one scheduler level each */
+typedef enum SCHM_CFG_E_PERIOD_
+{
+  SCHM_CFG_E_PERIOD_TICK = 0,   /* Every 100us tick, phase 0 */
+  SCHM_CFG_E_PERIOD_1MS,        /* Phase 0..8 = 100us slot within the 1ms */
+  SCHM_CFG_E_PERIOD_10MS,       /* Phase 0..8 = 1ms slot within the 10ms */
+  SCHM_CFG_E_PERIOD_100MS,      /* Phase 0..8 = 10ms slot within the 100ms */
+  SCHM_CFG_E_PERIOD_500MS,      /* Phase 0..4 = 100ms slot within the 500ms */
+  SCHM_CFG_E_PERIOD_COUNT
+} SCHM_CFG_E_PERIOD;
+
+/*
+ * Tasks of SCHM_vSchmRoutine(). Tasks of the same period and phase run in the
+ * listed order. The WCET budget (us) is checked at build time: the tick tasks
+ * plus the tasks of any slot must fit into one tick. Refine the budgets with
+ * the slot profiler (PMB_F5_DEBUG_REG, debug index 0x80..).
+ *
+ * TASK(A, B, task, period, phase, WCET budget)
+ */
+#define SCHM_CFG_TASK_TABLE(TASK, A, B) \
+  TASK(A, B, SCHM_cfg_vUartPrtTxData,                         SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_scfg_vI2cTimeOutHandler,                    SCHM_CFG_E_PERIOD_TICK,  0u,  3u) \
+  TASK(A, B, SCHM_cfg_vFanSpeedCnt,                           SCHM_CFG_E_PERIOD_TICK,  0u,  3u) \
+  TASK(A, B, SCHM_cfg_vHwioReadGpioPin,                       SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_cfg_vHwioSetGpioPin,                        SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  TASK(A, B, SCHM_cfg_vCalibrateIShare,                       SCHM_CFG_E_PERIOD_TICK,  0u,  5u) \
+  TASK(A, B, SCHM_cfg_vCaliFast,                              SCHM_CFG_E_PERIOD_TICK,  0u,  5u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlCheckVsbOvp,                    SCHM_CFG_E_PERIOD_TICK,  0u,  4u) \
+  \
+  TASK(A, B, SCHM_cfg_vUartPrtTmOutMon,                       SCHM_CFG_E_PERIOD_1MS,   0u,  5u) \
+  TASK(A, B, SCHM_cfg_vEepromTask,                            SCHM_CFG_E_PERIOD_1MS,   0u,  5u) \
+  TASK(A, B, SCHM_cfg_vUartPrtHandleTxData,                   SCHM_CFG_E_PERIOD_1MS,   1u, 20u) \
+  TASK(A, B, SCHM_cfg_vUartPrtHandleRxData,                   SCHM_CFG_E_PERIOD_1MS,   2u, 30u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlVsbOutput,                      SCHM_CFG_E_PERIOD_1MS,   3u, 15u) \
+  TASK(A, B, SCHM_cfg_vPsuCtrlVsbOut,                         SCHM_CFG_E_PERIOD_1MS,   3u, 15u) \
+  TASK(A, B, SCHM_cfg_vPsuCtrlV1Out,                          SCHM_CFG_E_PERIOD_1MS,   4u, 20u) \
+  TASK(A, B, SCHM_cfg_vTempCtrlNtcVoltAverage,                SCHM_CFG_E_PERIOD_1MS,   5u, 20u) \
+  TASK(A, B, SCHM_cfg_vI2cprtProcessRxData,                   SCHM_CFG_E_PERIOD_1MS,   6u, 40u) \
+  TASK(A, B, SCHM_cfg_vPmbusCopyPecAndOringStatus,            SCHM_CFG_E_PERIOD_1MS,   6u, 10u) \
+  TASK(A, B, SCHM_cfg_vIntComTmOutMOn,                        SCHM_CFG_E_PERIOD_1MS,   7u,  5u) \
+  TASK(A, B, SCHM_cfg_vBufferCalc1ms,                         SCHM_CFG_E_PERIOD_1MS,   7u, 25u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlVin,                            SCHM_CFG_E_PERIOD_1MS,   8u, 20u) \
+  \
+  TASK(A, B, SCHM_cfg_vCaliHandler,                           SCHM_CFG_E_PERIOD_10MS,  0u, 30u) \
+  TASK(A, B, SCHM_cfg_vPmbusCopySensorData,                   SCHM_CFG_E_PERIOD_10MS,  1u, 50u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlUpdateStatus,                   SCHM_CFG_E_PERIOD_10MS,  2u, 30u) \
+  TASK(A, B, SCHM_cfg_vLedControl,                            SCHM_CFG_E_PERIOD_10MS,  2u, 10u) \
+  TASK(A, B, SCHM_cfg_vPsuCtrlTrim,                           SCHM_CFG_E_PERIOD_10MS,  3u, 20u) \
+  TASK(A, B, SCHM_cfg_vCalcCaliPara,                          SCHM_CFG_E_PERIOD_10MS,  3u, 30u) \
+  TASK(A, B, SCHM_cfg_vFanSpeedCalc,                          SCHM_CFG_E_PERIOD_10MS,  4u, 20u) \
+  TASK(A, B, SCHM_cfg_vPmbusCheckBootMode,                    SCHM_CFG_E_PERIOD_10MS,  5u, 10u) \
+  TASK(A, B, SCHM_cfg_vBufferCalc10ms,                        SCHM_CFG_E_PERIOD_10MS,  5u, 30u) \
+  TASK(A, B, SCHM_cfg_vI2cprtUpdateI2cAddr,                   SCHM_CFG_E_PERIOD_10MS,  6u, 10u) \
+  TASK(A, B, SCHM_cfg_vProcessBlackbox,                       SCHM_CFG_E_PERIOD_10MS,  7u, 50u) \
+  TASK(A, B, SCHM_cfg_vMemSaveData,                           SCHM_CFG_E_PERIOD_10MS,  8u, 50u) \
+  \
+  TASK(A, B, SCHM_cfg_vFanCtrl,                               SCHM_CFG_E_PERIOD_100MS, 0u, 30u) \
+  TASK(A, B, SCHM_cfg_vCheckACBlackBox,                       SCHM_CFG_E_PERIOD_100MS, 0u, 20u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlCheckStatusReset,               SCHM_CFG_E_PERIOD_100MS, 1u, 20u) \
+  TASK(A, B, SCHM_cfg_vTimePSONBlackBox,                      SCHM_CFG_E_PERIOD_100MS, 1u, 20u) \
+  TASK(A, B, SCHM_cfg_vPmbusCopyStatusData,                   SCHM_CFG_E_PERIOD_100MS, 2u, 30u) \
+  TASK(A, B, SCHM_cfg_vCountRealTimeClockDataSystemBlackbox,  SCHM_CFG_E_PERIOD_100MS, 2u, 20u) \
+  TASK(A, B, SCHM_cfg_vTempCtrlLookUpNtcTemperature,          SCHM_CFG_E_PERIOD_100MS, 3u, 40u) \
+  TASK(A, B, SCHM_cfg_vClearWarning,                          SCHM_CFG_E_PERIOD_100MS, 3u, 10u) \
+  TASK(A, B, SCHM_cfg_vPmbusCopyDebugData,                    SCHM_CFG_E_PERIOD_100MS, 4u, 40u) \
+  TASK(A, B, SCHM_cfg_vTempCtrlNtcVoltMonitor,                SCHM_CFG_E_PERIOD_100MS, 5u, 20u) \
+  TASK(A, B, SCHM_cfg_vMonCtrlAxuModeDetect,                  SCHM_CFG_E_PERIOD_100MS, 6u, 10u) \
+  TASK(A, B, SCHM_cfg_vCheckPSONBlackBox,                     SCHM_CFG_E_PERIOD_100MS, 7u, 20u) \
+  TASK(A, B, SCHM_cfg_vTimeCtrlSaveHoursUsed,                 SCHM_CFG_E_PERIOD_100MS, 8u, 50u)
+
 
 
 #ifdef __cplusplus
@@ -33,6 +33,23 @@
 
 #define MG_TIME_BASE_ISR                0       /* 1 = Time base routine as ISR */
 #define MG_TIME_BASE_PERIOD_US          200     /* (uS) */
+#define MG_SCHM_TICK_US                 (1000000u / TIMER_CFG_TIMER_FRQ_SCHM)   /* (uS) scheduler tick */
+
+/***************************************
+ * Slot run time profiler
+ **************************************/
+#define MG_SCHM_PROFILE                 1       /* 1 = Measure the run time of every scheduler slot */
+#define MG_SCHM_PROF_AVG_SHIFT          6u      /* Average over 2^6 runs of a slot */
+#define MG_SCHM_PROF_TICK_CNT           ((uint32)TIMER_CFG_TIMER_SCHM_PERIOD + 1u)   /* Timer counts per tick */
+#define MG_SCHM_PROF_CNT_PER_US         (RTE_U32_CPU_CLK_FREQ / 1000000u)
+
+/***************************************
+ * Idle sleep and CPU load
+ **************************************/
+#define MG_SCHM_IDLE_SLEEP              1       /* 1 = Sleep (WFE) in the idle loop until the next tick */
+#define MG_SCHM_CPU_LOAD                1       /* 1 = Measure the CPU load from the idle time */
+#define MG_SCHM_LOAD_WINDOW_TICKS       ((uint16)TIMER_CFG_TIMER_FRQ_SCHM)   /* 1s window */
+#define MG_SCHM_LOAD_CNT_PER_PERMILLE   (((uint32)MG_SCHM_LOAD_WINDOW_TICKS * MG_SCHM_PROF_TICK_CNT) / 1000u)
 
 #define MG_HRTIMER_BASE_FREQ            65000   /* (Hz) */
 #define MG_U32_nS_HRTIMER_BASE_PERIOD   (uint32)(F64_ONE_BY_NANO / MG_HRTIMER_BASE_FREQ)
@@ -160,6 +160,29 @@ SINLINE uint8 SCHM_scfg_u8TimerGetUpdateItFlg(void)
   #endif
 }
 
+SINLINE uint16 SCHM_scfg_u16TimerGetCounter(void)
+{
+  #if MG_TIMER_MODULE
+  return TIMER_u16GetCounter(TIMER_CFG_E_INDEX_TIMER_Schm);
+  #endif
+}
+
+SINLINE void SCHM_scfg_vTimerEnableWakeUp(void)
+{
+  #if MG_TIMER_MODULE
+  TIMER_vEnableWakeUpEvent(TIMER_CFG_E_INDEX_TIMER_Schm);
+  #endif
+  /* Pending bits of disabled interrupts wake up WFE */
+  SCB->SCR |= SCB_SCR_SEVONPEND_Msk;
+}
+
+SINLINE void SCHM_scfg_vTimerClearWakeUp(void)
+{
+  #if MG_TIMER_MODULE
+  TIMER_vClearWakeUpEvent(TIMER_CFG_E_INDEX_TIMER_Schm);
+  #endif
+}
+
 /* HRTIMER module section */
 SINLINE void SCHM_scfg_vHrTimerInit(void)
 {
@@ -333,7 +356,7 @@ inline void SCHM_scfg_vI2cDeInit(void)
   #endif
 }
 
-inline void SCHM_scfg_vI2cTimeOutHandler(void)
+SINLINE void SCHM_scfg_vI2cTimeOutHandler(void)
 {
   #if MG_I2C_MODULE
   I2C_vI2cTimeOutHandler();
@@ -381,6 +404,11 @@ SINLINE void SCHM_scfg_vEnableIrq(void)
 	__enable_irq();
 }
 
+SINLINE void SCHM_scfg_vWaitForEvent(void)
+{
+	__WFE();
+}
+
 
 #ifdef __cplusplus
   }
@@ -155,6 +155,54 @@ uint8 TIMER_u8GetUpdateFlg(TIMER_CFG_E_INDEX eTimerIndex)
 	return (uint8)TIM_GetFlagStatus(TIMER_CFG_TIMER_SETUP[eTimerIndex].pTimx,TIMER_CFG_TIMER_SETUP[eTimerIndex].u16TIM_EventSource);
 }
 
+/*******************************************************************************
+ * \brief         Read the current counter value of the timer.
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter value
+ *
+ ******************************************************************************/
+uint16 TIMER_u16GetCounter(TIMER_CFG_E_INDEX eTimerIndex)
+{
+	return (uint16)TIM_GetCounter(TIMER_CFG_TIMER_SETUP[eTimerIndex].pTimx);
+}
+
+/*******************************************************************************
+ * \brief         Let the update event of the timer set its pending bit in the
+ *                NVIC. The interrupt itself stays disabled, the pending bit
+ *                only wakes up the CPU from WFE (SEVONPEND).
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+void TIMER_vEnableWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex)
+{
+	TIM_ITConfig(TIMER_CFG_TIMER_SETUP[eTimerIndex].pTimx, TIM_IT_Update, ENABLE);
+}
+
+/*******************************************************************************
+ * \brief         Clear the NVIC pending bit of the timer, so that the next
+ *                update event is a new wake up event.
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+void TIMER_vClearWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex)
+{
+	NVIC_ClearPendingIRQ(TIMER_CFG_TIMER_SETUP[eTimerIndex].eIrqn);
+}
+
 
 
 /*
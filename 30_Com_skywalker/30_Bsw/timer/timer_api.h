@@ -80,6 +80,43 @@ void TIMER_vClearUpdateFlg(TIMER_CFG_E_INDEX eTimerIndex);
  ******************************************************************************/
 uint8 TIMER_u8GetUpdateFlg(TIMER_CFG_E_INDEX eTimerIndex);
 
+/*******************************************************************************
+ * \brief         Read the current counter value of the timer
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Counter value (CPU clock cycles since the last update event)
+ *
+ ******************************************************************************/
+uint16 TIMER_u16GetCounter(TIMER_CFG_E_INDEX eTimerIndex);
+
+/*******************************************************************************
+ * \brief         Let the update event wake up the CPU from WFE, the update
+ *                interrupt stays disabled in the NVIC
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+void TIMER_vEnableWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex);
+
+/*******************************************************************************
+ * \brief         Clear the NVIC pending bit left by the last update event
+ *
+ * \param[in]     eTimerIndex: timer index
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ******************************************************************************/
+void TIMER_vClearWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex);
+
 
 
 
@@ -87,6 +87,9 @@ typedef struct
 	uint16 u16TIM_IT;
 	uint16 u16TIM_EventSource;
 	
+	/* NVIC channel of the update interrupt, also used as wake up event */
+	IRQn_Type eIrqn;
+	
 }tTimerSetup;
 
 static const tTimerSetup TIMER_CFG_TIMER_SETUP[] =
@@ -103,7 +106,8 @@ static const tTimerSetup TIMER_CFG_TIMER_SETUP[] =
  .u8RepetitionCounter  = 0x00,
  .u8IsEnableIT         = FALSE,
  .u16TIM_IT            = 0x00,
- .u16TIM_EventSource   = TIM_EventSource_Update
+ .u16TIM_EventSource   = TIM_EventSource_Update,
+ .eIrqn                = TIM17_IRQn
 }
 }; /* */
 #endif
@@ -85,11 +85,7 @@ void SVC_Handler(void)
   mg_vError();
 }
 
-/* This function handles PendSVC exception */
-void PendSV_Handler(void)
-{
-  mg_vError();
-}
+/* PendSV exception is the deferred PMBus frame handling, see i2cprt.c */
 
 /* This function handles Debug Monitor exception */
 void DebugMon_Handler(void)
@@ -36,6 +36,12 @@
 
 static void (*mg_Uart1RxIsrCallback)(uint8 u8Data);
 static void (*mg_Uart2RxIsrCallback)(uint8 u8Data);
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static uint16 mg_au16RxDmaSize[UART_CFG_E_INDEX_COUNT];
   
 /*******************************************************************************
  * Global functions (public to other modules)
@@ -55,8 +61,11 @@ void UART_vInit(void)
 {
   /* Initialize UART */
   USART_InitTypeDef     USART_InitStructure;
+  DMA_InitTypeDef       DMA_InitStructure;
 	uint8 u8Loop;
 	
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
 	for(u8Loop=0;u8Loop<(uint8)UART_CFG_E_INDEX_COUNT;u8Loop++)
 	{
 		/* Enable USART clock */
@@ -80,6 +89,31 @@ void UART_vInit(void)
 
 		/* USART configuration */
 		USART_Init(UART_CFG_UART_SETUP[u8Loop].UARTx, &USART_InitStructure);
+
+		/* TX and RX data by DMA, a frame at a time. The memory address and the
+		 * size are set per frame by UART_vStartTxDma() / UART_vStartRxDma() */
+		DMA_DeInit(UART_CFG_UART_SETUP[u8Loop].TxDmaCh);
+		DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32)&UART_CFG_UART_SETUP[u8Loop].UARTx->TDR;
+		DMA_InitStructure.DMA_MemoryBaseAddr = 0u;
+		DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralDST;
+		DMA_InitStructure.DMA_BufferSize = 0u;
+		DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+		DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+		DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+		DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+		DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+		DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+		DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+		DMA_Init(UART_CFG_UART_SETUP[u8Loop].TxDmaCh, &DMA_InitStructure);
+
+		DMA_DeInit(UART_CFG_UART_SETUP[u8Loop].RxDmaCh);
+		DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32)&UART_CFG_UART_SETUP[u8Loop].UARTx->RDR;
+		DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+		DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+		DMA_Init(UART_CFG_UART_SETUP[u8Loop].RxDmaCh, &DMA_InitStructure);
+
+		USART_DMACmd(UART_CFG_UART_SETUP[u8Loop].UARTx, USART_DMAReq_Tx | USART_DMAReq_Rx, ENABLE);
+
 		/* Enable USART */
 		USART_Cmd(UART_CFG_UART_SETUP[u8Loop].UARTx, ENABLE);
 
@@ -133,18 +167,18 @@ void UART_vDeInit(void)
 
 void USART1_IRQHandler(void)
 {
-	if(USART_GetITStatus(USART1,USART_IT_RXNE) != FALSE)
+	if(USART_GetITStatus(USART1,USART_IT_IDLE) != FALSE)
   {
-		USART_ClearITPendingBit(USART1,USART_IT_RXNE);
+		USART_ClearITPendingBit(USART1,USART_IT_IDLE);
 		(*mg_Uart1RxIsrCallback)(0);
 	}
 }
 
 void USART2_IRQHandler(void)
 {
-	if(USART_GetITStatus(USART2,USART_IT_RXNE) != FALSE)
+	if(USART_GetITStatus(USART2,USART_IT_IDLE) != FALSE)
   {
-		USART_ClearITPendingBit(USART2,USART_IT_RXNE);
+		USART_ClearITPendingBit(USART2,USART_IT_IDLE);
 		(*mg_Uart2RxIsrCallback)(1u);
 	}
 }
@@ -173,6 +207,96 @@ uint16 UART_u16UartReadBaudrate(uint8 u8UartIndex)
 	return (uint16)UART_CFG_UART_SETUP[u8UartIndex].u32BaudRate;
 }
 
+/** *****************************************************************************
+ * \brief         Send a frame by DMA, the buffer has to stay unchanged until
+ *                UART_u16ReadTxDmaCnt() returns 0
+ *
+ * \param[in]     u8UartIndex
+ *                pu8Data     - frame
+ *                u16Len      - number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartTxDma(uint8 u8UartIndex, const uint8 *pu8Data, uint16 u16Len)
+{
+	DMA_Channel_TypeDef *psCh = UART_CFG_UART_SETUP[u8UartIndex].TxDmaCh;
+
+	DMA_Cmd(psCh, DISABLE);
+	psCh->CMAR = (uint32)pu8Data;
+	DMA_SetCurrDataCounter(psCh, u16Len);
+	UART_CFG_UART_SETUP[u8UartIndex].UARTx->ICR = USART_ICR_TCCF; /* TC of the last frame */
+	DMA_Cmd(psCh, ENABLE);
+}
+
+/** *****************************************************************************
+ * \brief         Bytes of the TX frame not written to the data register yet.
+ *                At 0 the next frame can follow without a gap, the line is
+ *                idle with UART_u8UartReadTxEmptyFlg() as well.
+ *
+ * \param[in]     u8UartIndex
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadTxDmaCnt(uint8 u8UartIndex)
+{
+	return DMA_GetCurrDataCounter(UART_CFG_UART_SETUP[u8UartIndex].TxDmaCh);
+}
+
+/** *****************************************************************************
+ * \brief         Receive the next frame by DMA into the buffer, the frame ends
+ *                with the idle line interrupt (RX ISR call back)
+ *
+ * \param[in]     u8UartIndex
+ *                u16Size     - buffer size, more bytes of a frame are lost
+ * \param[in,out] -
+ * \param[out]    pu8Buf      - buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartRxDma(uint8 u8UartIndex, uint8 *pu8Buf, uint16 u16Size)
+{
+	DMA_Channel_TypeDef *psCh = UART_CFG_UART_SETUP[u8UartIndex].RxDmaCh;
+	USART_TypeDef *psUart = UART_CFG_UART_SETUP[u8UartIndex].UARTx;
+
+	DMA_Cmd(psCh, DISABLE);
+	(void)psUart->RDR; /* Byte received while stopped */
+	psUart->ICR = USART_ICR_ORECF | USART_ICR_IDLECF;
+	psCh->CMAR = (uint32)pu8Buf;
+	DMA_SetCurrDataCounter(psCh, u16Size);
+	mg_au16RxDmaSize[u8UartIndex] = u16Size;
+	DMA_Cmd(psCh, ENABLE);
+}
+
+/** *****************************************************************************
+ * \brief         Stop the RX DMA, the buffer is not written any more
+ *
+ * \param[in]     u8UartIndex
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes received, 0 if stopped already
+ *
+ ***************************************************************************** */
+uint16 UART_u16StopRxDma(uint8 u8UartIndex)
+{
+	DMA_Channel_TypeDef *psCh = UART_CFG_UART_SETUP[u8UartIndex].RxDmaCh;
+	uint16 u16Cnt = 0u;
+
+	if (0u != (psCh->CCR & DMA_CCR_EN))
+	{
+		DMA_Cmd(psCh, DISABLE);
+		u16Cnt = mg_au16RxDmaSize[u8UartIndex] - DMA_GetCurrDataCounter(psCh);
+	}
+	return u16Cnt;
+}
+
 /*******************************************************************************
  * Local functions (privat for module)
  ******************************************************************************/
@@ -75,6 +75,59 @@ uint8 UART_u8UartReadRxIsrFlg(uint8 u8UartIndex);
 
 uint16 UART_u16UartReadBaudrate(uint8 u8UartIndex);
 
+/** *****************************************************************************
+ * \brief         Send a frame by DMA, the buffer has to stay unchanged until
+ *                UART_u16ReadTxDmaCnt() returns 0
+ *
+ * \param[in]     u8UartIndex
+ *                pu8Data     - frame
+ *                u16Len      - number of bytes
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartTxDma(uint8 u8UartIndex, const uint8 *pu8Data, uint16 u16Len);
+
+/** *****************************************************************************
+ * \brief         Bytes of the TX frame not written to the data register yet
+ *
+ * \param[in]     u8UartIndex
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes
+ *
+ ***************************************************************************** */
+uint16 UART_u16ReadTxDmaCnt(uint8 u8UartIndex);
+
+/** *****************************************************************************
+ * \brief         Receive the next frame by DMA into the buffer, the frame ends
+ *                with the idle line interrupt (RX ISR call back)
+ *
+ * \param[in]     u8UartIndex
+ *                u16Size     - buffer size
+ * \param[in,out] -
+ * \param[out]    pu8Buf      - buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UART_vStartRxDma(uint8 u8UartIndex, uint8 *pu8Buf, uint16 u16Size);
+
+/** *****************************************************************************
+ * \brief         Stop the RX DMA
+ *
+ * \param[in]     u8UartIndex
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        Number of bytes received, 0 if stopped already
+ *
+ ***************************************************************************** */
+uint16 UART_u16StopRxDma(uint8 u8UartIndex);
+
 
 #ifdef __cplusplus
   }
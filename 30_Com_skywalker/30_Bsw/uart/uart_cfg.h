@@ -84,8 +84,12 @@ typedef struct
   /* Specifies the priority level for the IRQ channel specified in NVIC_IRQChannel. */
   uint8_t u8NvicIRQChannelPrio;  
 	
-  /* Rx ISR call back */
+  /* Rx ISR call back, on the idle line after a frame */
 	void (* Receive)(uint8_t);  
+
+  /* DMA channels of the TX and RX data register */
+  DMA_Channel_TypeDef *TxDmaCh;
+  DMA_Channel_TypeDef *RxDmaCh;
 	
 }tPwmSetup;
 
@@ -102,11 +106,13 @@ static const tPwmSetup UART_CFG_UART_SETUP[] =
  .u32Parity              = USART_Parity_No,
  .u32Mode                = USART_Mode_Rx | USART_Mode_Tx,
  .u32HardwareFlowControl = USART_HardwareFlowControl_None,
- .u32UsartIT             = USART_IT_RXNE,
+ .u32UsartIT             = USART_IT_IDLE,
  .eITNewState            = ENABLE,
  .u8NvicIRQChannel       = USART1_IRQn,
  .u8NvicIRQChannelPrio   = MG_USART1_RX_ISR_SUB_PRIO,
- .Receive                = UARTPRT_vUsartIrqHandler
+ .Receive                = UARTPRT_vUsartIrqHandler,
+ .TxDmaCh                = DMA1_Channel2,
+ .RxDmaCh                = DMA1_Channel3
 },
 
 /* UART2 initialised*/
@@ -120,11 +126,13 @@ static const tPwmSetup UART_CFG_UART_SETUP[] =
  .u32Parity              = USART_Parity_No,
  .u32Mode                = USART_Mode_Rx | USART_Mode_Tx,
  .u32HardwareFlowControl = USART_HardwareFlowControl_None,
- .u32UsartIT             = USART_IT_RXNE,
+ .u32UsartIT             = USART_IT_IDLE,
  .eITNewState            = ENABLE,
  .u8NvicIRQChannel       = USART2_IRQn,
  .u8NvicIRQChannelPrio   = MG_USART2_RX_ISR_SUB_PRIO,
- .Receive                = UARTPRT_vUsartIrqHandler
+ .Receive                = UARTPRT_vUsartIrqHandler,
+ .TxDmaCh                = DMA1_Channel4,
+ .RxDmaCh                = DMA1_Channel5
 },
 }; /* */
 #endif
@@ -30,6 +30,12 @@
   #include "uartprt_rte.h"
   #include "uartprt_conf.h"
 
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+#define MG_U16_INC_SAT(x)           ((x) = ((x) < 0xFFFFu) ? ((x) + 1u) : (x))
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
@@ -54,7 +60,7 @@ typedef union MG_U_UARTPRT_CTRL_
 {
   struct
   {
-    uint16 bRxByteTmOutEna   : 1;   /* bit0 */
+    uint16 bReserved         : 1;   /* bit0 */
     uint16 bTxTmOutEna       : 1;   /* bit1 */
     uint16 bTxBufUpdated     : 1;   /* bit2 */
     uint16 bRxNewFrame       : 1;   /* bit3 */
@@ -72,36 +78,60 @@ typedef union MG_U_UARTPRT_CTRL_
 typedef struct MG_S_UARTPRT_DATA_
 {
   uint16 u16TxDataCnt;
-  uint16 u16RxDataCnt;
-  uint16 u16RxByteTmOutCnt;
 	uint16 u16RxFrameTmOutCnt;
 	uint16 u16TxTmOutCnt;
   uint16 u16TxDataNbr;
   uint16 u16RxDataNbr;
-  uint16 u16RxCrc;
   uint8  u8SlaveAddr;
   MG_U_UARTPRT_STATUS uStatus;
   MG_U_UARTPRT_CTRL   uCtrl;
 } MG_S_UARTPRT_DATA;
 
+#if MG_LINK_STATS
+/* Status frames of one link, the sticky bits of uStatus per event */
+typedef struct MG_S_LINK_STATS_
+{
+  uint16 u16TxFrames;                       /* Status frames sent */
+  uint16 u16RxFrames;                       /* Frames received and checked ok */
+  uint16 u16StxErr;
+  uint16 u16AddrErr;
+  uint16 u16LenErr;
+  uint16 u16CrcErr;
+  uint16 u16Tmout;                          /* Frames sent without an answer in the frame timeout */
+  volatile uint16 u16Overrun;               /* Frames dropped, bRxNewFrame still set */
+  uint16 u16RttLast;                        /* Round trip TX complete to RX frame end, us */
+  uint16 u16RttMax;
+  uint16 u16RttAvg;
+  uint32 u32TxStamp;                        /* TX complete */
+  volatile uint32 u32RxStamp;               /* Idle line of the frame received */
+  uint8  bRttPend;                          /* Waiting for the answer to the frame sent */
+} MG_S_LINK_STATS;
+#endif
+
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
 static uint8 mg_au8SlaveAddress[MG_UART_NUM_MAX];
-static uint16 mg_u16Crc[MG_UART_NUM_MAX];
 
 static MG_S_UARTPRT_DATA mg_uUartPrtData[MG_UART_NUM_MAX];
 
-static uint8 mg_u8RxTimeOutDly[MG_UART_NUM_MAX];
 static uint8 mg_u8RxFrameTimeOutDly[MG_UART_NUM_MAX];
 static uint8 mg_u8TxTimeOutDly[MG_UART_NUM_MAX];
 uint8 mg_au8UartTxBuf[MG_UART_NUM_MAX][MG_TX_BUF_SIZE];
 static uint8 mg_au8UartRxBuf[MG_UART_NUM_MAX][MG_RX_BUF_SIZE];
 
+#if MG_LINK_STATS
+static MG_S_LINK_STATS mg_asLinkStats[MG_UART_NUM_MAX];
+#endif
+
 /*******************************************************************************
  * Local function prototypes (private to module)
  ******************************************************************************/
 
+#if MG_LINK_STATS
+static void mg_vLinkRtt(MG_S_LINK_STATS *psStats);
+#endif
+
 /*******************************************************************************
  * Global functions (public to other modules)
  ******************************************************************************/
@@ -124,10 +154,8 @@ void UARTPRT_vInit(void)
 	for(u32Loop=0;u32Loop<MG_UART_NUM_MAX;u32Loop++)
 	{
 		mg_uUartPrtData[u32Loop].u16TxDataCnt = 0;
-		mg_uUartPrtData[u32Loop].u16RxDataCnt = 0;
 		mg_uUartPrtData[u32Loop].u16TxDataNbr = 0;
 		mg_uUartPrtData[u32Loop].u16RxDataNbr = 0;	
-		mg_uUartPrtData[u32Loop].u16RxCrc = CRC_INIT_02;
 		mg_uUartPrtData[u32Loop].uStatus.ALL = 0;
 		mg_uUartPrtData[u32Loop].uCtrl.ALL = 0;
 		
@@ -140,8 +168,6 @@ void UARTPRT_vInit(void)
 
 		if (MG_BAUDRATE_4800 == u16BaudRate)
 		{
-			mg_u8RxTimeOutDly[u32Loop] = MG_RX_BYTE_TIMEOUT_4800;
-			mg_uUartPrtData[u32Loop].u16RxByteTmOutCnt = mg_u8RxTimeOutDly[u32Loop];
 			mg_u8RxFrameTimeOutDly[u32Loop] = MG_UART_RX_FRAME_TIMEOUT_4800; 
 			mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt = mg_u8RxFrameTimeOutDly[u32Loop];
 			mg_u8TxTimeOutDly[u32Loop] = MG_UART_TX_TIMEOUT_4800;
@@ -149,8 +175,6 @@ void UARTPRT_vInit(void)
 		}
 		else if (MG_BAUDRATE_38400 == u16BaudRate)
 		{
-			mg_u8RxTimeOutDly[u32Loop] = MG_RX_BYTE_TIMEOUT_38400;
-			mg_uUartPrtData[u32Loop].u16RxByteTmOutCnt = mg_u8RxTimeOutDly[u32Loop];
 			mg_u8RxFrameTimeOutDly[u32Loop] = MG_UART_RX_FRAME_TIMEOUT_38400; 
 			mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt = mg_u8RxFrameTimeOutDly[u32Loop];
 			mg_u8TxTimeOutDly[u32Loop] = MG_UART_TX_TIMEOUT_38400;
@@ -158,21 +182,22 @@ void UARTPRT_vInit(void)
 		}
 		else
 		{
-			mg_u8RxTimeOutDly[u32Loop] = MG_RX_BYTE_TIMEOUT_38400;
-			mg_uUartPrtData[u32Loop].u16RxByteTmOutCnt = mg_u8RxTimeOutDly[u32Loop];
 			mg_u8RxFrameTimeOutDly[u32Loop] = MG_UART_RX_FRAME_TIMEOUT_38400; 
 			mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt = mg_u8RxFrameTimeOutDly[u32Loop];
 			mg_u8TxTimeOutDly[u32Loop] = MG_UART_TX_TIMEOUT_38400;
 			mg_uUartPrtData[u32Loop].u16TxTmOutCnt = mg_u8TxTimeOutDly[u32Loop];
 		}
 		
-		mg_u16Crc[u32Loop] = CRC_INIT_02;
-		
 		mg_au8SlaveAddress[u32Loop] = au8SlaveAddr[u32Loop];
 		
 			/* Read local MCU address */
 		mg_uUartPrtData[u32Loop].u8SlaveAddr = mg_au8SlaveAddress[u32Loop];
+
+		/* Receive the first frame */
+		UARTPRT_scfg_vUartStartRxDma(u32Loop, mg_au8UartRxBuf[u32Loop], MG_RX_BUF_SIZE);
   }
+
+	UARTPRT_vClearLinkStats();
 }
 
 /** *****************************************************************************
@@ -202,6 +227,7 @@ void UARTPRT_vDeInit(void)
  ***************************************************************************** */
 void UARTPRT_vHandleTxData(void)
 {
+	WORD_VAL u16TxCrc;
 	uint32 u32Loop;
 	
 	for(u32Loop=0;u32Loop<MG_UART_NUM_MAX;u32Loop++)
@@ -227,11 +253,12 @@ void UARTPRT_vHandleTxData(void)
 
 			UARTPRT_cfg_vIntComTxData(u32Loop,mg_au8UartTxBuf[u32Loop], &mg_uUartPrtData[u32Loop].u16TxDataNbr); /* Load application data to TX buffer */
 
-			/* Calculate crc when TX data byte, add dummy crc here */
-			mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataNbr++] = CRC_INIT_02; /* dummy CRC16 */
-			mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataNbr++] = CRC_INIT_02; /* dummy CRC16 */
-			
-			mg_au8UartTxBuf[u32Loop][2] = mg_uUartPrtData[u32Loop].u16TxDataNbr - MG_FRAME_AUX_LEN; /* Fill LEN in TX buffer */
+			mg_au8UartTxBuf[u32Loop][2] = mg_uUartPrtData[u32Loop].u16TxDataNbr + 2u - MG_FRAME_AUX_LEN; /* Fill LEN in TX buffer */
+
+			/* Calculate crc16 of the whole frame in one go */
+			u16TxCrc.u16Val = UARTPRT_scfg_u16GetCrc16Blk(CRC_INIT_02, mg_au8UartTxBuf[u32Loop], mg_uUartPrtData[u32Loop].u16TxDataNbr);
+			mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataNbr++] = u16TxCrc.Bytes.LB; /* CRC16 */
+			mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataNbr++] = u16TxCrc.Bytes.HB; /* CRC16 */
 			
 			mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxBufUpdated = TRUE; /* Begin to TX */
 		}
@@ -270,29 +297,38 @@ void UARTPRT_vHandleRxData(void)
 			if (MG_FRAME_STX != mg_au8UartRxBuf[u32Loop][0]) /* Check STX */
 			{
 				mg_uUartPrtData[u32Loop].uStatus.Bit.u8InvalidData = TRUE;
+				#if MG_LINK_STATS
+				MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16StxErr);
+				#endif
 			} 
 			else if (mg_uUartPrtData[u32Loop].u8SlaveAddr != mg_au8UartRxBuf[u32Loop][1]) /* Check MCU address */
 			{
 				mg_uUartPrtData[u32Loop].uStatus.Bit.u8McuAddrErr = TRUE;
+				#if MG_LINK_STATS
+				MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16AddrErr);
+				#endif
 			}  
 			else if (mg_uUartPrtData[u32Loop].u16RxDataNbr != mg_au8UartRxBuf[u32Loop][2] + MG_FRAME_AUX_LEN) /* Check length of data */
 			{
 				mg_uUartPrtData[u32Loop].uStatus.Bit.u8LenErr = TRUE;
+				#if MG_LINK_STATS
+				MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16LenErr);
+				#endif
 			}   
 			else
 			{
-				if (mg_uUartPrtData[u32Loop].u16RxCrc) /* Check frame crc16 */
+				if (0u != UARTPRT_scfg_u16GetCrc16Blk(CRC_INIT_02, mg_au8UartRxBuf[u32Loop], mg_uUartPrtData[u32Loop].u16RxDataNbr)) /* Check frame crc16 */
 				{
 					mg_uUartPrtData[u32Loop].uStatus.Bit.u8CrcErr = TRUE;
+					#if MG_LINK_STATS
+					MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16CrcErr);
+					#endif
 				}
 				else
 				{
 					u8FrameCheckOk = TRUE;
 				}
 			}
-			/* Check frame end */
-			mg_uUartPrtData[u32Loop].u16RxCrc = CRC_INIT_02;
-			mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxNewFrame = FALSE; /* Begin to fill TX buffer */
 		}
 
 		/* Frame format is correct, Handle data */
@@ -305,13 +341,29 @@ void UARTPRT_vHandleRxData(void)
 				mg_uUartPrtData[u32Loop].uCtrl.Bit.bUartStaClrFlg = TRUE;
 			}
 			
+			#if MG_LINK_STATS
+			MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16RxFrames);
+			mg_vLinkRtt(&mg_asLinkStats[u32Loop]);
+			#endif
+
 			UARTPRT_cfg_vIntComRxData(u32Loop,mg_au8UartRxBuf[u32Loop], u8BroadcastFlg, MG_UART_STATUS_BYTE_CTR); /* Handle application data */
 		}
+
+		/* Check frame end, the RX buffer is free for the next frame */
+		if (mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxNewFrame)
+		{
+			#if MG_LINK_STATS
+			mg_asLinkStats[u32Loop].bRttPend = FALSE; /* Only the first frame after the TX answers it */
+			#endif
+			mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxNewFrame = FALSE; /* Begin to fill TX buffer */
+			UARTPRT_scfg_vUartStartRxDma(u32Loop, mg_au8UartRxBuf[u32Loop], MG_RX_BUF_SIZE);
+		}
   }
 }
 
 /** *****************************************************************************
- * \brief         TX data by UART
+ * \brief         TX data by UART, the frame is sent by DMA and its end is
+ *                polled here
  *                Note: should be implemented in <= 1ms routine
  *
  * \param[in]     -
@@ -323,60 +375,52 @@ void UARTPRT_vHandleRxData(void)
  ***************************************************************************** */
 void UARTPRT_vTxData(void)
 { 
-  static WORD_VAL u16CrcTemp[MG_UART_NUM_MAX];
 	uint32 u32Loop;
 
 	for(u32Loop=0;u32Loop<MG_UART_NUM_MAX;u32Loop++)
 	{
 		if (FALSE != mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxBufUpdated) /* Txbuf array is updated */
 		{
-			if (UARTPRT_scfg_u8UartReadTxEmptyFlg(u32Loop)) /* Last data TX is complete */
+			if (0u == mg_uUartPrtData[u32Loop].u16TxDataCnt) /* Frame not started */
 			{
-				if (mg_uUartPrtData[u32Loop].u16TxDataCnt < mg_uUartPrtData[u32Loop].u16TxDataNbr)
-				{
-					if (mg_uUartPrtData[u32Loop].u16TxDataCnt == mg_uUartPrtData[u32Loop].u16TxDataNbr - 2u)
-					{
-						u16CrcTemp[u32Loop].u16Val = mg_u16Crc[u32Loop];
-						mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataCnt] = u16CrcTemp[u32Loop].Bytes.LB; /* Add real crc16 into TxBuf */
-					}
-					else if (mg_uUartPrtData[u32Loop].u16TxDataCnt == mg_uUartPrtData[u32Loop].u16TxDataNbr - 1u)
-					{
-						mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataCnt] = u16CrcTemp[u32Loop].Bytes.HB; /* Add real crc16 into TxBuf */
-					}				
-					else
-					{
-						mg_u16Crc[u32Loop] = CRC_u16GetCrc16(mg_u16Crc[u32Loop], mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataCnt]);
-					}
-					UARTPRT_scfg_vUartWriteTxReg(u32Loop,mg_au8UartTxBuf[u32Loop][mg_uUartPrtData[u32Loop].u16TxDataCnt++]);
-				}
-				else /* A frame Tx complete */
+				UARTPRT_scfg_vUartStartTxDma(u32Loop, mg_au8UartTxBuf[u32Loop], mg_uUartPrtData[u32Loop].u16TxDataNbr);
+				mg_uUartPrtData[u32Loop].u16TxDataCnt = mg_uUartPrtData[u32Loop].u16TxDataNbr;
+			}
+			else if ((0u == UARTPRT_scfg_u16UartReadTxDmaCnt(u32Loop)) &&
+			         (UARTPRT_scfg_u8UartReadTxEmptyFlg(u32Loop))) /* A frame Tx complete */
+			{
+				mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxBufUpdated = FALSE; /* Tx array can be updated again */
+				mg_uUartPrtData[u32Loop].u16TxDataCnt = 0;
+				
+				/* Begin to monitor rx frame timeout */
+				if((FALSE == mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxDurTxFlg))
 				{
-					mg_u16Crc[u32Loop] = CRC_INIT_02; /* Reset crc for next frame */
-					mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxBufUpdated = FALSE; /* Tx array can be updated again */
-					mg_uUartPrtData[u32Loop].u16TxDataCnt = 0;
-					
-					/* Begin to monitor rx frame timeout */
-					if((FALSE == mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxDurTxFlg))
-					{
-						mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxFrameTmOutEna = TRUE;
-						mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt = mg_u8RxFrameTimeOutDly[u32Loop];
-					}
-					mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxDurTxFlg = FALSE;
-					
-					/* Begin to monitor TX timeout, the minimum duration between two TX */
-					mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxTmOutEna = TRUE;
-					mg_uUartPrtData[u32Loop].u16TxTmOutCnt = mg_u8TxTimeOutDly[u32Loop];
+					mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxFrameTmOutEna = TRUE;
+					mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt = mg_u8RxFrameTimeOutDly[u32Loop];
+					#if MG_LINK_STATS
+					mg_asLinkStats[u32Loop].u32TxStamp = UARTPRT_scfg_u32GetTimeStamp(); /* Round trip starts */
+					mg_asLinkStats[u32Loop].bRttPend = TRUE;
+					#endif
 				}
+				#if MG_LINK_STATS
+				MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16TxFrames);
+				#endif
+				mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxDurTxFlg = FALSE;
+				
+				/* Begin to monitor TX timeout, the minimum duration between two TX */
+				mg_uUartPrtData[u32Loop].uCtrl.Bit.bTxTmOutEna = TRUE;
+				mg_uUartPrtData[u32Loop].u16TxTmOutCnt = mg_u8TxTimeOutDly[u32Loop];
 			}
 		}
   }
 }
 
 /** *****************************************************************************
- * \brief         RX data by UART
+ * \brief         RX frame by UART, called by the idle line interrupt: the RX
+ *                DMA has written the frame to the RX buffer and the line is
+ *                quiet for one byte time
  *
- *
- * \param[in]     -
+ * \param[in]     u8UartIndex
  * \param[in,out] -
  * \param[out]    -
  *
@@ -385,41 +429,36 @@ void UARTPRT_vTxData(void)
  ***************************************************************************** */
 void UARTPRT_vUsartIrqHandler(uint8 u8UartIndex)
 {
-	uint8 u8Dummy;
+  uint16 u16RxCnt;
 
-  u8Dummy = UARTPRT_scfg_u8UartReadRxReg(u8UartIndex); /* Read RX REG */ 
-	
-  mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxByteTmOutEna = FALSE; /* Stop timer */
+  u16RxCnt = UARTPRT_scfg_u16UartStopRxDma(u8UartIndex); /* 0 if stopped already */
 
   if (FALSE == mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxNewFrame) /* Last frame has been handled */
   {
-    mg_au8UartRxBuf[u8UartIndex][mg_uUartPrtData[u8UartIndex].u16RxDataCnt++] = u8Dummy; /* RX data */
-    mg_uUartPrtData[u8UartIndex].u16RxCrc = UARTPRT_scfg_u16GetCrc16(mg_uUartPrtData[u8UartIndex].u16RxCrc, u8Dummy);
-
-    if (mg_uUartPrtData[u8UartIndex].u16RxDataCnt < MG_RX_BUF_SIZE)
-    {
-      /* Begin to monitor rx byte timeout */
-      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxByteTmOutEna = TRUE;
-      mg_uUartPrtData[u8UartIndex].u16RxByteTmOutCnt = mg_u8RxTimeOutDly[1];
-    }
-    else /* Rx buffer if full, begin to handle frame */
+    if (0u != u16RxCnt)
     {
-      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxByteTmOutEna = FALSE;
-      mg_uUartPrtData[u8UartIndex].u16RxDataNbr = mg_uUartPrtData[u8UartIndex].u16RxDataCnt;
-      mg_uUartPrtData[u8UartIndex].u16RxDataCnt = 0;
-      mg_uUartPrtData[u8UartIndex].uStatus.Bit.u8ByteTmout = TRUE;
-      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxNewFrame   = TRUE;
-    }
-		
-    /* if slaver begins to TX when receive local address */
-    if (FALSE != mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bTxBufUpdated) 
-    {
-      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxDurTxFlg = TRUE;/* data received when Tx is ongoing */
+      /* Idle line, new frame is received */
+      mg_uUartPrtData[u8UartIndex].uStatus.Bit.u8ByteTmout = TRUE; /* note: this is not a fault condition */
+      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bByteTmoutFlg = TRUE;
+      mg_uUartPrtData[u8UartIndex].u16RxDataNbr = u16RxCnt;
+      mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxNewFrame   = TRUE; /* Begin to handle data in RX buffer */
+      #if MG_LINK_STATS
+      mg_asLinkStats[u8UartIndex].u32RxStamp = UARTPRT_scfg_u32GetTimeStamp();
+      #endif
+
+      /* if slaver begins to TX when receive local address */
+      if (FALSE != mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bTxBufUpdated)
+      {
+        mg_uUartPrtData[u8UartIndex].uCtrl.Bit.bRxDurTxFlg = TRUE;/* data received when Tx is ongoing */
+      }
     }
   }
   else /* Tx too fast, Rx buffer has not been handled */
   {
     mg_uUartPrtData[u8UartIndex].uStatus.Bit.u8InvalidData = TRUE;
+    #if MG_LINK_STATS
+    MG_U16_INC_SAT(mg_asLinkStats[u8UartIndex].u16Overrun);
+    #endif
   }
 }
 /** *****************************************************************************
@@ -439,29 +478,7 @@ void UARTPRT_vTmOutMon(void)
 
 	for(u32Loop=0;u32Loop<MG_UART_NUM_MAX;u32Loop++)
 	{
-		/* Byte timeout timer */
-		if (TRUE == mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxByteTmOutEna)
-		{
-			if (0U < mg_uUartPrtData[u32Loop].u16RxByteTmOutCnt)
-			{
-				mg_uUartPrtData[u32Loop].u16RxByteTmOutCnt--;
-			}
-			else
-			{
-				/* Timeout, stop timer */
-				mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxByteTmOutEna = FALSE;
-
-				/* Byte timeout, new frame is received */
-				mg_uUartPrtData[u32Loop].uStatus.Bit.u8ByteTmout = TRUE; /* note: this is not a fault condition */
-				mg_uUartPrtData[u32Loop].uCtrl.Bit.bByteTmoutFlg = TRUE; 
-				mg_uUartPrtData[u32Loop].u16RxDataNbr = mg_uUartPrtData[u32Loop].u16RxDataCnt;
-				mg_uUartPrtData[u32Loop].u16RxDataCnt = 0;
-				mg_uUartPrtData[u32Loop].uCtrl.Bit.bByteTmoutFlg = TRUE;
-				mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxNewFrame   = TRUE; /* Begin to handle data in RX buffer */
-			}
-		}
-			
-		/* Frame timeout timer */
+		/* Frame timeout timer, the frame end is detected by the idle line */
 		if (TRUE == mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxFrameTmOutEna)
 		{
 			if (0U < mg_uUartPrtData[u32Loop].u16RxFrameTmOutCnt)
@@ -476,6 +493,14 @@ void UARTPRT_vTmOutMon(void)
 				/* Frame timeout, no data received, if host, begin to TX again */
 				mg_uUartPrtData[u32Loop].uStatus.Bit.u8FrameTmout = TRUE;
 				mg_uUartPrtData[u32Loop].uCtrl.Bit.bFrameTmoutFlg = TRUE;
+				#if MG_LINK_STATS
+				if ((FALSE != mg_asLinkStats[u32Loop].bRttPend) &&
+				    (FALSE == mg_uUartPrtData[u32Loop].uCtrl.Bit.bRxNewFrame)) /* No answer at all, not the TX period */
+				{
+					MG_U16_INC_SAT(mg_asLinkStats[u32Loop].u16Tmout);
+					mg_asLinkStats[u32Loop].bRttPend = FALSE;
+				}
+				#endif
 			}
 		}
 
@@ -515,6 +540,134 @@ void UARTPRT_vSetBootMode(uint8 u8Index)
   mg_uUartPrtData[u8Index].uStatus.Bit.u8BootMode = TRUE;
 }
 
+/** *****************************************************************************
+ * \brief         Copy the status frame statistics, one UARTPRT_LINK_STATS_SIZE
+ *                record per UART: MCU address, frames sent, frames received,
+ *                STX / address / length / CRC errors, frames sent without an
+ *                answer in the frame timeout, frames dropped while the last
+ *                one was not handled, last, maximum and average round trip
+ *                time TX complete to RX frame end (us)
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    pu8Data   records
+ *
+ * \return        Number of bytes written, 0 if not measured
+ *
+ ***************************************************************************** */
+uint8 UARTPRT_u8GetLinkStats(uint8 *pu8Data)
+{
+  uint8 u8Len = 0u;
+#if MG_LINK_STATS
+  const MG_S_LINK_STATS *psStats;
+  uint16 au16Val[11];
+  uint8 u8Uart;
+  uint8 u8Idx;
+
+  for (u8Uart = 0u; u8Uart < MG_UART_NUM_MAX; u8Uart++)
+  {
+    psStats = &mg_asLinkStats[u8Uart];
+    au16Val[0]  = psStats->u16TxFrames;
+    au16Val[1]  = psStats->u16RxFrames;
+    au16Val[2]  = psStats->u16StxErr;
+    au16Val[3]  = psStats->u16AddrErr;
+    au16Val[4]  = psStats->u16LenErr;
+    au16Val[5]  = psStats->u16CrcErr;
+    au16Val[6]  = psStats->u16Tmout;
+    au16Val[7]  = psStats->u16Overrun;
+    au16Val[8]  = psStats->u16RttLast;
+    au16Val[9]  = psStats->u16RttMax;
+    au16Val[10] = psStats->u16RttAvg;
+
+    pu8Data[u8Len++] = mg_uUartPrtData[u8Uart].u8SlaveAddr;
+    for (u8Idx = 0u; u8Idx < 11u; u8Idx++)
+    {
+      pu8Data[u8Len++] = (uint8)au16Val[u8Idx];
+      pu8Data[u8Len++] = (uint8)(au16Val[u8Idx] >> 8);
+    }
+  }
+#endif
+  return u8Len;
+}
+
+/** *****************************************************************************
+ * \brief         Clear the status frame statistics, a round trip in progress
+ *                is still measured
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UARTPRT_vClearLinkStats(void)
+{
+#if MG_LINK_STATS
+  uint8 u8Uart;
+
+  for (u8Uart = 0u; u8Uart < MG_UART_NUM_MAX; u8Uart++)
+  {
+    mg_asLinkStats[u8Uart].u16TxFrames = 0u;
+    mg_asLinkStats[u8Uart].u16RxFrames = 0u;
+    mg_asLinkStats[u8Uart].u16StxErr = 0u;
+    mg_asLinkStats[u8Uart].u16AddrErr = 0u;
+    mg_asLinkStats[u8Uart].u16LenErr = 0u;
+    mg_asLinkStats[u8Uart].u16CrcErr = 0u;
+    mg_asLinkStats[u8Uart].u16Tmout = 0u;
+    mg_asLinkStats[u8Uart].u16Overrun = 0u;
+    mg_asLinkStats[u8Uart].u16RttLast = 0u;
+    mg_asLinkStats[u8Uart].u16RttMax = 0u;
+    mg_asLinkStats[u8Uart].u16RttAvg = 0u;
+  }
+#endif
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+#if MG_LINK_STATS
+/** *****************************************************************************
+ * \brief         Round trip of the frame received ok: from the TX complete of
+ *                the frame before to the idle line of this one
+ *
+ * \param[in]     -
+ * \param[in,out] psStats
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vLinkRtt(MG_S_LINK_STATS *psStats)
+{
+  uint32 u32Time;
+
+  if (FALSE == psStats->bRttPend)
+  {
+    return;
+  }
+  psStats->bRttPend = FALSE;
+
+  u32Time = (psStats->u32RxStamp - psStats->u32TxStamp) / MG_STAMP_CNT_PER_US;
+  u32Time = MIN(u32Time, 0xFFFFu);
+  psStats->u16RttLast = (uint16)u32Time;
+  if ((uint16)u32Time > psStats->u16RttMax)
+  {
+    psStats->u16RttMax = (uint16)u32Time;
+  }
+  if (0U == psStats->u16RttAvg)
+  {
+    psStats->u16RttAvg = (uint16)u32Time;
+  }
+  else
+  {
+    psStats->u16RttAvg = (uint16)((sint32)psStats->u16RttAvg +
+                                  (((sint32)u32Time - (sint32)psStats->u16RttAvg) >> MG_LINK_RTT_AVG_SHIFT));
+  }
+}
+#endif
+
 /*
  * End of file
  */
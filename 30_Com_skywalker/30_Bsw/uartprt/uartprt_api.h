@@ -27,6 +27,24 @@
 
 #include "global.h"
 
+/*******************************************************************************
+ * Global constants and macros (public to other modules)
+ ******************************************************************************/
+
+/*
+ * Record of one link as written by UARTPRT_u8GetLinkStats(), words low byte
+ * first, counters saturate
+ */
+#define UARTPRT_LINK_STATS_SIZE       23u
+
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Global function prototypes (public to other modules)
+ ******************************************************************************/
+
 /** *****************************************************************************
  * \brief         Set boot mode 
  *
@@ -40,6 +58,35 @@
  ***************************************************************************** */
 void UARTPRT_vSetBootMode(uint8 u8Index);
 
+/** *****************************************************************************
+ * \brief         Copy the status frame statistics, one UARTPRT_LINK_STATS_SIZE
+ *                record per UART: MCU address, frames sent, frames received,
+ *                STX / address / length / CRC errors, frames sent without an
+ *                answer in the frame timeout, frames dropped while the last
+ *                one was not handled, last, maximum and average round trip
+ *                time TX complete to RX frame end (us)
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    pu8Data   records
+ *
+ * \return        Number of bytes written, 0 if not measured
+ *
+ ***************************************************************************** */
+uint8 UARTPRT_u8GetLinkStats(uint8 *pu8Data);
+
+/** *****************************************************************************
+ * \brief         Clear the status frame statistics
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void UARTPRT_vClearLinkStats(void);
+
 #ifdef __cplusplus
   }
 #endif
@@ -69,9 +69,7 @@ static const uint8 au8SlaveAddr[]={MG_SLAVE_LOCATION_1,MG_SLAVE_LOCATION_2};
 /***********************************************
  * Define timing
  **********************************************/
-#define MG_RX_BYTE_TIMEOUT_4800          5U             /* Value * 1ms = time */
-#define MG_RX_BYTE_TIMEOUT_38400         1U             /* Value * 1ms = time */
-
+/* The RX frame ends with the idle line of the UART (one byte time) */
 
 #define MG_UART_RX_FRAME_TIMEOUT_4800    8U             /* Value * 1ms = time */
 #define MG_UART_RX_FRAME_TIMEOUT_38400   4U             /* Value * 1ms = time */
@@ -79,6 +77,13 @@ static const uint8 au8SlaveAddr[]={MG_SLAVE_LOCATION_1,MG_SLAVE_LOCATION_2};
 #define MG_UART_TX_TIMEOUT_4800          7U             /* Value * 1ms = time */
 #define MG_UART_TX_TIMEOUT_38400         3U             /* Value * 1ms = time */
 
+/***********************************************
+ * Link statistics
+ **********************************************/
+#define MG_LINK_STATS               1                 /* 1 = Count the status frames and errors per link, measure the round trip */
+#define MG_LINK_RTT_AVG_SHIFT       3U                /* Moving average of the round trip time over 2^3 frames */
+#define MG_STAMP_CNT_PER_US         (RTE_U32_CPU_CLK_FREQ / 1000000U)
+
 /***********************************************
  * Define UART fail counter
  **********************************************/
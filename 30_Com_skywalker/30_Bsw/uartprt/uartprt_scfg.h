@@ -26,6 +26,7 @@
  ******************************************************************************/
 #define MG_UART_MODULE            1
 #define MG_CRC_MODULE             1
+#define MG_SCHM_MODULE            1
 
 /*******************************************************************************
  * Included header
@@ -38,6 +39,9 @@
 #if MG_CRC_MODULE
 #include "crc_api.h"
 #endif
+#if MG_SCHM_MODULE
+#include "schm_api.h"
+#endif
 
 /*******************************************************************************
  * Global constants and macros (public to other modules)
@@ -96,6 +100,39 @@ inline uint16 UARTPRT_scfg_u16UartReadBaudrate(uint8 u8UartIndex)
   #endif
 }
 
+inline void UARTPRT_scfg_vUartStartTxDma(uint8 u8UartIndex, const uint8 *pu8Data, uint16 u16Len)
+{
+  #if MG_UART_MODULE
+  UART_vStartTxDma(u8UartIndex, pu8Data, u16Len);
+  #endif
+}
+
+inline uint16 UARTPRT_scfg_u16UartReadTxDmaCnt(uint8 u8UartIndex)
+{
+  #if MG_UART_MODULE
+  return UART_u16ReadTxDmaCnt(u8UartIndex);
+  #else
+  return 0;
+  #endif
+}
+
+inline void UARTPRT_scfg_vUartStartRxDma(uint8 u8UartIndex, uint8 *pu8Buf, uint16 u16Size)
+{
+  #if MG_UART_MODULE
+  UART_vStartRxDma(u8UartIndex, pu8Buf, u16Size);
+  #endif
+}
+
+__attribute__((section ("ccram")))
+inline uint16 UARTPRT_scfg_u16UartStopRxDma(uint8 u8UartIndex)
+{
+  #if MG_UART_MODULE
+  return UART_u16StopRxDma(u8UartIndex);
+  #else
+  return 0;
+  #endif
+}
+
 /* CRC module section */
 inline uint16 UARTPRT_scfg_u16GetCrc16(uint16 u16InCrc, uint8 u8InData)
 {
@@ -106,6 +143,15 @@ inline uint16 UARTPRT_scfg_u16GetCrc16(uint16 u16InCrc, uint8 u8InData)
   #endif
 }
 
+inline uint16 UARTPRT_scfg_u16GetCrc16Blk(uint16 u16InCrc, const uint8 *pu8Data, uint32 u32Len)
+{
+  #if MG_CRC_MODULE
+  return CRC_u16GetCrc16Blk(u16InCrc, pu8Data, u32Len);
+  #else
+  return 0;
+  #endif
+}
+
 inline uint8 UARTPRT_scfg_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
 {
   #if MG_CRC_MODULE
@@ -115,6 +161,16 @@ inline uint8 UARTPRT_scfg_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
   #endif
 }
 
+/* Scheduler module section */
+inline uint32 UARTPRT_scfg_u32GetTimeStamp(void)
+{
+  #if MG_SCHM_MODULE
+  return SCHM_u32GetTimeStamp();
+  #else
+  return 0;
+  #endif
+}
+
 
 #ifdef __cplusplus
   }
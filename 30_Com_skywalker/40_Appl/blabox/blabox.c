@@ -94,6 +94,15 @@ static uint32 mg_u32RealTimeBaseIPMI = 0;
 static uint8 mg_u8Tmp;
 static WORD_VAL mg_wTmp;
 
+/*
+ * MFR_BLACKBOX response, streamed by the I2C ISR: [0] count of PAGE_PLUS_READ,
+ * [1] block count, header, events newest first. Rebuilt into the other bank
+ * after a write, the ISR keeps reading the bank it started with.
+ */
+static uint8 mg_au8MfrImage[2][BLABOX_MFR_IMAGE_SIZE];
+static volatile uint8 mg_u8MfrImageBank = 0;
+static volatile boolean mg_bMfrImageDirty = TRUE;
+
 /*******************************************************************************
  * Global data
  ******************************************************************************/
@@ -109,6 +118,9 @@ static void mg_vMfrGetACCntBlackBox(uint8* pu8Buffer);
 static void mg_vMfrGetTimePSONBlackBox(uint8* pu8Buffer);
 static void mg_vMfrSetPSONCntBlackBox(void);
 static void mg_vMfrSetACCntBlackBox(void);
+static boolean mg_bWriteSector(uint8 eLogSector,const uint8* pu8Buffer);
+static void mg_vMfrImageBuild(uint8* pu8Buffer);
+static void mg_vMfrImageUpdate(void);
 
 
 boolean BLABOX_vReadMFR_BLABOX_EVENT(uint8* pu8Buffer,uint8 Event);
@@ -146,6 +158,10 @@ void BLABOX_vInit(void)
 	BLABOX_SCFG_vEEPROM2Emem(BLABOX_SCFG_u16Getlenght(0),0);
 	
 	BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_CONFIG,&mg_bEnableBlackbox,1);
+
+	/* MFR_BLACKBOX image */
+	mg_bMfrImageDirty = TRUE;
+	mg_vMfrImageUpdate();
 }
 /** ****************************************************************************
  * \brief  BLABOX_vProcessBlackbox
@@ -159,6 +175,16 @@ void BLABOX_vProcessBlackbox(void)
 {
 	static uint16 u16CntStartEnable = 0;
 	static uint16 u16CntWriteEEPROMProcess = 0;
+	static uint8 u8CntMfrImageHold = 0;
+	
+	/* Rebuild MFR_BLACKBOX image in the other bank, not while a read streams it */
+	if(u8CntMfrImageHold < BLABOX_CFG_TimeMfrImageHold) {
+		u8CntMfrImageHold++;
+	}else if((FALSE != mg_bMfrImageDirty) &&
+	         (FALSE == BLABOX_SCFG_u8IsI2cReading(mg_au8MfrImage[mg_u8MfrImageBank ^ 1u], BLABOX_MFR_IMAGE_SIZE))) {
+		mg_vMfrImageUpdate();
+		u8CntMfrImageHold = 0;
+	}
 	
 	/* Delay Init function 5 second */
 	if(++u16CntStartEnable < (BLABOX_TIMESTART * 100u)) {				
@@ -187,7 +213,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_OverVolt_shutodwn,BLABOX_HIGH);
 							
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 									
 		}
@@ -208,7 +234,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_GenerFail_shutdown,BLABOX_HIGH);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 									
 		}
@@ -228,7 +254,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_OverCurr_shutdown,BLABOX_LOW);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}						
 		}
 		/* Over Current Warning */
@@ -247,7 +273,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_OverCurr_warning,BLABOX_LOW);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 		}
 		/* Under Input Fault */
@@ -267,7 +293,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_VinUnder_shutdown,BLABOX_LOW);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);		
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);		
 			}
 		}
 		/* Over Input Fault  */
@@ -286,7 +312,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_VinOver_shutdown,BLABOX_LOW);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);		
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);		
 			}
 		}
 		/* Fan Fail */
@@ -305,7 +331,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_FanFail_shutdown,BLABOX_LOW);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 		}
 		/* Temp Fault */
@@ -325,7 +351,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_Thermal_shutdown,BLABOX_HIGH);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 		}
 		/* Temp Warning */
@@ -344,7 +370,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_Thermal_warning,BLABOX_HIGH);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 		}
 		/* General Fault */
@@ -363,7 +389,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_GenerFail_shutdown,BLABOX_HIGH);
 						
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}
 		}
 		/* Over Vsb Volt fault */
@@ -383,7 +409,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_OverVsb_shutdown,BLABOX_LOW);
 							
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}	
     }
 		/* Over Vsb current fault */
@@ -403,7 +429,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_OverIsb_shutdown,BLABOX_HIGH);
 							
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}	      
 		}
 		/* under Vsb volt fault */
@@ -423,7 +449,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_UnderVsb_shutdown,BLABOX_LOW);
 							
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}	      
 		}
 		/* Over Bulk volt fault */
@@ -443,7 +469,7 @@ void BLABOX_vProcessBlackbox(void)
 				mg_vSetCountEventFaultAndWarning(BLABOX_UnderVsb_shutdown,BLABOX_HIGH);
 							
 				/* Write Event to s_dam */		
-				BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+				mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 			}	      
 		}
 	}/* End Enable BlackBox */
@@ -461,8 +487,11 @@ void BLABOX_vProcessBlackbox(void)
 		/* update another process for get alert for ready write EEPROm */
 		if(u16CntWriteEEPROMProcess >= 10)
 		{
-			mg_InputLossWriteEnable = FALSE;	
-			BLABOX_SCFG_vEmem2EEPROM(BLABOX_SCFG_u16Getlenght(0),0);
+			/* Retried next time while the EEPROM queue is full */
+			if (TRUE == BLABOX_SCFG_u8Emem2EEPROM(BLABOX_SCFG_u16Getlenght(0),0))
+			{
+				mg_InputLossWriteEnable = FALSE;	
+			}
 		} 
 	}
 	
@@ -543,69 +572,108 @@ static uint8 mg_u8IsMaxCountEventFaultAndWarning(MG_BLABOX_E_EventCount eTmp,MG_
 }
 
 /** ****************************************************************************
- * \brief  BLABOX_vReadMFR_BLABOX
+ * \brief  BLABOX_pu8MFR_BLABOX
  * \param[in]  -  -
  * \param[out] -  -
- * \comment -  Command 0xDC (hex) in PMBus for Read BlackBox 
+ * \comment -  Command 0xDC (hex) in PMBus for Read BlackBox, the response is
+ *             read by the I2C ISR from the image
+ * \return  -  image: [0] free for the count of PAGE_PLUS_READ, [1] block count,
+ *             then BLABOX_MFR_BLACKBOX_BLOCK_LEN bytes
+ *
+ **************************************************************************** */
+uint8* BLABOX_pu8MFR_BLABOX(void)
+{
+	return mg_au8MfrImage[mg_u8MfrImageBank];
+}
+/** ****************************************************************************
+ * \brief  mg_bWriteSector
+ * \param[in]  -  eLogSector, pu8Buffer
+ * \param[out] -  -
+ * \comment -  Write to s_dam, the MFR_BLACKBOX image is rebuilt afterwards
  * \return  -
  *
  **************************************************************************** */
-boolean BLABOX_vMFR_BLABOX(uint8* pu8Buffer)
+static boolean mg_bWriteSector(uint8 eLogSector,const uint8* pu8Buffer)
 {
+	boolean bRet;
+	
+	bRet = BLABOX_SCFG_Write(eLogSector,pu8Buffer);
+	if(BLABOX_CFG_CONFIG_SECTOR_CONFIG != eLogSector) {
+		mg_bMfrImageDirty = TRUE;
+	}
+	return bRet;
+}
+/** ****************************************************************************
+ * \brief  mg_vMfrImageUpdate
+ * \param[in]  -  -
+ * \param[out] -  -
+ * \comment -  Build the MFR_BLACKBOX image in the free bank and switch to it
+ * \return  -
+ *
+ **************************************************************************** */
+static void mg_vMfrImageUpdate(void)
+{
+	uint8 u8Bank;
+	
+	/* Clear first: a write during the build marks it again */
+	mg_bMfrImageDirty = FALSE;
+	u8Bank = mg_u8MfrImageBank ^ 1u;
+	
+	mg_au8MfrImage[u8Bank][0] = 0;
+	mg_au8MfrImage[u8Bank][1] = BLABOX_MFR_BLACKBOX_BLOCK_LEN;
+	mg_vMfrImageBuild(&mg_au8MfrImage[u8Bank][2]);
+	
+	mg_u8MfrImageBank = u8Bank;
+}
+/** ****************************************************************************
+ * \brief  mg_vMfrImageBuild
+ * \param[in]  -  -
+ * \param[out] -  pu8Buffer: BLABOX_MFR_BLACKBOX_BLOCK_LEN bytes
+ * \comment -  Header and all events from s_dam, newest event first. Records
+ *             not written (or with bad CRC) read as 0.
+ * \return  -
+ *
+ **************************************************************************** */
+static void mg_vMfrImageBuild(uint8* pu8Buffer)
+{
+	uint8 au8Record[BLABOX_MFR_MAX_EVENT_HEADER];
 	uint8 u8Cnt = 0;
+	uint8 u8Event = 0;
 	uint8 u8CntEvent = 0;
-	uint8 u8CntAllEvent = 0;
 	uint8 u8IndexAllEvent = 0;
 	uint8 u8LastRecode = 0;
 	uint8 u8NumOfRecodes = 0;
-	/* Get Header (Read All Header from S_dam)*/	
-	u8IndexAllEvent = 0;  
-	BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem,1);
-	/* send to PMbus */
-	for( u8CntEvent = 0; u8CntEvent < BLABOX_MFR_BLACKBOX_HEADER ; u8CntEvent++) 
-	{		
-		pu8Buffer[u8IndexAllEvent++] = mg_au8BuffWriteToEmem[u8CntEvent];
+	
+	for(u8Cnt = 0; u8Cnt < BLABOX_MFR_BLACKBOX_BLOCK_LEN; u8Cnt++) {
+		pu8Buffer[u8Cnt] = 0;
 	}
 	
-	/* Clear Header mg_au8BuffWriteToEmem */
-	for(u8Cnt = 0;u8Cnt < BLABOX_MFR_BLACKBOX_HEADER; u8Cnt++) {
-		mg_au8BuffWriteToEmem[u8Cnt] = 0;
+	/* Get Header */
+	for(u8Cnt = 0; u8Cnt < BLABOX_MFR_BLACKBOX_HEADER; u8Cnt++) {
+		au8Record[u8Cnt] = 0;
+	}
+	BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_HEADER,au8Record,1);
+	for(u8Cnt = 0; u8Cnt < BLABOX_MFR_BLACKBOX_HEADER; u8Cnt++) {
+		pu8Buffer[u8IndexAllEvent++] = au8Record[u8Cnt];
 	}
 	
-	u8NumOfRecodes = BLABOX_SCFG_u32GetNumberOfRecords();	
-	u8LastRecode = BLABOX_SCFG_u32GetLastRecordId();					
-	/* Read All Event from s_dam */	
-		for( u8CntEvent = u8LastRecode; u8CntEvent > 0 ; u8CntEvent--) 
-		{
-			/* Get each Event */
-			BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem,u8CntEvent);
-			
-			/* send to PMbus */
-			for(u8CntAllEvent = 0;u8CntAllEvent < BLABOX_MFR_BLACKBOX_EVENT_LENGHT; u8CntAllEvent++) {
-				pu8Buffer[u8IndexAllEvent++] = mg_au8BuffWriteToEmem[u8CntAllEvent];
-			}
-			
-			/* Clear mg_au8BuffWriteToEmem */
-			for(u8Cnt = 0;u8Cnt < BLABOX_MFR_BLACKBOX_EVENT_LENGHT; u8Cnt++) {
-				mg_au8BuffWriteToEmem[u8Cnt] = 0;
-			}
+	u8NumOfRecodes = BLABOX_SCFG_u32GetNumberOfRecords();
+	u8LastRecode = BLABOX_SCFG_u32GetLastRecordId();
+	
+	/* Events newest first: from the last one down to 1, then from the oldest down to last + 1 */
+	for(u8Event = 0; u8Event < u8NumOfRecodes; u8Event++) {
+		u8CntEvent = (u8Event < u8LastRecode) ? (u8LastRecode - u8Event) : (u8NumOfRecodes + u8LastRecode - u8Event);
+		
+		for(u8Cnt = 0; u8Cnt < BLABOX_MFR_BLACKBOX_EVENT_LENGHT; u8Cnt++) {
+			au8Record[u8Cnt] = 0;
 		}
-		for( u8CntEvent = u8NumOfRecodes; u8CntEvent > u8LastRecode ; u8CntEvent--) 
-		{
-			/* Get each Event */
-			BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem,u8CntEvent);
-			
-			/* send to PMbus */
-			for(u8CntAllEvent = 0;u8CntAllEvent < BLABOX_MFR_BLACKBOX_EVENT_LENGHT; u8CntAllEvent++) {
-				pu8Buffer[u8IndexAllEvent++] = mg_au8BuffWriteToEmem[u8CntAllEvent];
-			}
-			
-			/* Clear mg_au8BuffWriteToEmem */
-			for(u8Cnt = 0;u8Cnt < BLABOX_MFR_BLACKBOX_EVENT_LENGHT; u8Cnt++) {
-				mg_au8BuffWriteToEmem[u8Cnt] = 0;
-			}
+		BLABOX_SCFG_Read(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,au8Record,u8CntEvent);
+		
+		/* The block ends inside the last event */
+		for(u8Cnt = 0; (u8Cnt < BLABOX_MFR_BLACKBOX_EVENT_LENGHT) && (u8IndexAllEvent < BLABOX_MFR_BLACKBOX_BLOCK_LEN); u8Cnt++) {
+			pu8Buffer[u8IndexAllEvent++] = au8Record[u8Cnt];
 		}
-	return TRUE;
+	}
 }
 /** ****************************************************************************
  * \brief  BLABOX_vWR_SystemBlackBox
@@ -617,14 +685,15 @@ boolean BLABOX_vMFR_BLABOX(uint8* pu8Buffer)
  **************************************************************************** */
 void BLABOX_vMFR_SystemBlackBox(uint8* pu8Buffer,uint8 IsWrite)
 {
+	uint8 au8Header[BLABOX_MFR_MAX_EVENT_HEADER];
 	uint8 u8Cnt = 0;
-	/* Read packet */
+	/* Read packet: from the I2C interrupt, not through the buffer of the tasks */
 	if(FALSE == IsWrite) {
 		/* Optimize Header Buff */
-		mg_vReadMfrBlaboxHeader(mg_au8BuffWriteToEmem);		
+		mg_vReadMfrBlaboxHeader(au8Header);		
 			
 		for(u8Cnt = 0; u8Cnt < BLABOX_LENGTH_SERIAL_SYSTEM; u8Cnt++) {
-			pu8Buffer[u8Cnt] = mg_au8BuffWriteToEmem[u8Cnt];
+			pu8Buffer[u8Cnt] = au8Header[u8Cnt];
 		}		
 	}else { /* Write packet */
 		
@@ -634,7 +703,7 @@ void BLABOX_vMFR_SystemBlackBox(uint8* pu8Buffer,uint8 IsWrite)
 			mg_au8BuffWriteToEmem[u8Cnt] = pu8Buffer[u8Cnt];
 		}				
 		/* Write Header to s_dam */
-		BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);
+		mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);
 		
 		
 	}
@@ -658,7 +727,7 @@ void BLABOX_vMFR_ClearBlackBox(void)
 		mg_au8BuffWriteToEmem[u8Cnt] = 0;
 	}			
 	/* Write Header to s_dam */
-	BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);
+	mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);
 	
   for(u8CntEvent = 1; u8CntEvent <= BLABOX_MFR_BLACKBOX_EVENT_MAX; u8CntEvent++ ) {							
 		/* Optimize Event Buff write */			
@@ -668,7 +737,7 @@ void BLABOX_vMFR_ClearBlackBox(void)
 			mg_au8BuffWriteToEmem[u8Cnt] = 0;
 		}	
 		/* Write Event to s_dam */		
-		BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
+		mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_EVENT_DATA,mg_au8BuffWriteToEmem);
 		
 	}
 }
@@ -789,7 +858,7 @@ static void mg_vMfrSetPSONCntBlackBox()
 		mg_au8BuffWriteToEmem[46 + 1] = ( (u8TmpPSON >> 8) & 0xff);
 		
 		/* Write Header to s_dam */
-		BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
+		mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
 	}
 }
 /** ****************************************************************************
@@ -868,7 +937,7 @@ static void mg_vMfrSetACCntBlackBox()
 		mg_au8BuffWriteToEmem[44 + 1] = ( (u8TmpAC >> 8) & 0xff);
 		
 		/* Write Header to s_dam */
-		BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
+		mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
 		
 	}
 }
@@ -922,7 +991,7 @@ void BLABOX_vMFR_TimePSONBlackBox(void)
 			mg_au8BuffWriteToEmem[42 + 1] = ((u32TmpCntMinute << 16 ) & 0xff);
 			
 			/* Write Header to s_dam */
-			BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
+			mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_HEADER,mg_au8BuffWriteToEmem);	
 		}
 	}
 }
@@ -985,7 +1054,7 @@ void BLABOX_vSetEnableBlackbox(uint8 u8Tmp)
 {
 	if(u8Tmp == 0x00 || u8Tmp == 0x01)
 		mg_bEnableBlackbox = u8Tmp;	
-	BLABOX_SCFG_Write(BLABOX_CFG_CONFIG_SECTOR_CONFIG,&mg_bEnableBlackbox);
+	mg_bWriteSector(BLABOX_CFG_CONFIG_SECTOR_CONFIG,&mg_bEnableBlackbox);
 }
 /** ****************************************************************************
  * \brief  BLABOX_vGetEnableBlackbox
@@ -48,7 +48,7 @@ extern boolean BLABOX_bWriteEEPROMProcessing;
  * Description:     PMBus function cmd (0xDC) get All BlackBox
  *
  ******************************************************************************/
-extern boolean BLABOX_vMFR_BLABOX(uint8* pu8Buffer);
+extern uint8* BLABOX_pu8MFR_BLABOX(void);
 /*******************************************************************************
  * Function:        BLABOX_vSetRealTimeClockDataSystemBlackbox
  * Parameters:      -
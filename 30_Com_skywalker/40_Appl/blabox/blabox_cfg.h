@@ -31,6 +31,8 @@
 #define BLABOX_MFR_BLACKBOX_EVENT_MAX 			5
 #define BLABOX_MFR_BLACKBOX_EVENT_LENGHT 		41
 #define BLABOX_MFR_MAX_EVENT_HEADER         (BLABOX_MFR_BLACKBOX_EVENT_LENGHT>BLABOX_MFR_BLACKBOX_HEADER)?BLABOX_MFR_BLACKBOX_EVENT_LENGHT:BLABOX_MFR_BLACKBOX_HEADER /* 48 */
+#define BLABOX_MFR_BLACKBOX_BLOCK_LEN       252u /* Block count of MFR_BLACKBOX, ends inside the 5th event */
+#define BLABOX_MFR_IMAGE_SIZE               (BLABOX_MFR_BLACKBOX_BLOCK_LEN + 2u) /* + PAGE_PLUS_READ count + block count */
 
  
 /* Event Fault BlackBox */
@@ -55,6 +57,9 @@
 //#define BLABOX_CFG_EventTempClearFlagWarning     	(MG_B_TEMP_WARN())        /* Temp Warning */
 #define BLABOX_CFG_TimeTempClearFlagWarning     	(10u) /* x * 100ms*/ 
 
+/* MFR_BLACKBOX image */
+#define BLABOX_CFG_TimeMfrImageHold             	(5u)  /* x * 10ms, least time between two image rebuilds */
+
 /* Signal BlackBox */
 //#define BLABOX_CFG_PSONFault            (false == tInputPsOn.Status)
 //#define BLABOX_CFG_ACPowerFault         (true == tAnaVinUvp.Status)
@@ -24,6 +24,7 @@
 #include "mem_api.h"
 #include "s_dam_api.h"
 #include "fanctrl_api.h"
+#include "i2cprt_api.h"
 
 /*******************************************************************************
  * Global constants and macros
@@ -126,9 +127,9 @@ SINLINE void BLABOX_SCFG_vEEPROM2Emem(uint16 u16Lenght , uint16 u16Offset)
 {
   MEM_vRead2EEPORM(u16Lenght,u16Offset);
 }
-SINLINE void BLABOX_SCFG_vEmem2EEPROM(uint16 u16Lenght  , uint16 u16Offset)
+SINLINE uint8 BLABOX_SCFG_u8Emem2EEPROM(uint16 u16Lenght  , uint16 u16Offset)
 {
-  MEM_vWrite2EEPORM(u16Lenght,u16Offset);
+  return MEM_u8Write2EEPORM(u16Lenght,u16Offset);
 }
 SINLINE uint16 BLABOX_SCFG_u16Getlenght(uint8 index)
 {
@@ -144,6 +145,11 @@ SINLINE uint8 BLABOX_SCFG_u8ReadFanBitWarn(uint8 u8Index)
  return FANCTRL_u8ReadFanBitWarn(u8Index);
 }
 
+SINLINE uint8 BLABOX_SCFG_u8IsI2cReading(const uint8* pu8Area, uint16 u16Size)
+{
+ return I2CPRT_u8IsReadingArea(pu8Area, u16Size);
+}
+
 
 
  
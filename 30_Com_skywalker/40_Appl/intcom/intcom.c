@@ -29,6 +29,7 @@
   #include "intcom_scfg.h"
   #include "intcom_rte.h"
   #include "intcom_conf.h"
+  #include "intcom_frm.h"
 
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
@@ -39,6 +40,12 @@
  ******************************************************************************/
 static uint32 mg_u32Com1MonCnt;
 static uint32 mg_u32Com2MonCnt;
+static INTCOM_FRM_S_COM2PRI_TX mg_sCom2PriTx;   /* Delta mode state per link */
+static INTCOM_FRM_S_COM2SEC_TX mg_sCom2SecTx;
+static INTCOM_FRM_S_PRI2COM_RX mg_sPri2ComRx;
+static INTCOM_FRM_S_SEC2COM_RX mg_sSec2ComRx;
+static uint8 mg_u8Com1RxPend;                   /* Frame sent, answer not received yet */
+static uint8 mg_u8Com2RxPend;
 /*******************************************************************************
  * Local function prototypes (private to module)
  ******************************************************************************/
@@ -61,6 +68,12 @@ void INTCOM_vInit(void)
 {
   mg_u32Com1MonCnt = 1000u;
 	mg_u32Com2MonCnt = 1000u;
+  mg_sCom2PriTx.u8Cnt = 0u;      /* Keyframe first */
+  mg_sCom2SecTx.u8Cnt = 0u;
+  mg_sPri2ComRx.u16KeyLen = 0u;  /* Delta frames dropped until a keyframe */
+  mg_sSec2ComRx.u16KeyLen = 0u;
+  mg_u8Com1RxPend = FALSE;
+  mg_u8Com2RxPend = FALSE;
 }
 
 /** *****************************************************************************
@@ -90,11 +103,12 @@ void INTCOM_vDeInit(void)
  ***************************************************************************** */
 void INTCOM_vCom1TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
 {
-	 GLOBAL_U_U16BIT uCom2Pri00;
-   WORD_VAL uDebugData0Addr;
-   WORD_VAL uAcoffset;
-   WORD_VAL uVinCaliAmp;
-   WORD_VAL uVinCaliOfs;
+  INTCOM_FRM_S_COM2PRI sFrm;
+  GLOBAL_U_U16BIT uCom2Pri00;
+  WORD_VAL uDebugData0Addr;
+  WORD_VAL uAcoffset;
+  WORD_VAL uVinCaliAmp;
+  WORD_VAL uVinCaliOfs;
 
   /* Read data from RTE */
   INTCOM_Rte_Read_R_uComToPriStatus(&uCom2Pri00);
@@ -104,16 +118,25 @@ void INTCOM_vCom1TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
   INTCOM_Rte_Read_R_uVinCaliOfs(&uVinCaliOfs.s16Val);  
 
   /* Fill buffer */
-  pau8TxBuf[(*u16TxDataNbr)++] = uCom2Pri00.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCom2Pri00.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uDebugData0Addr.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uDebugData0Addr.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uAcoffset.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uAcoffset.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uVinCaliAmp.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uVinCaliAmp.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uVinCaliOfs.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uVinCaliOfs.Bytes.HB;
+  sFrm.u8Rsvd0       = 0u;
+  sFrm.uComStatus00  = uCom2Pri00.ALL;
+  sFrm.u16DebugAddr  = uDebugData0Addr.u16Val;
+  sFrm.s16AcOffset   = uAcoffset.s16Val;
+  sFrm.s16VinCaliAmp = uVinCaliAmp.s16Val;
+  sFrm.s16VinCaliOfs = uVinCaliOfs.s16Val;
+#if MG_INTCOM_DELTA
+  if (FALSE != mg_u8Com1RxPend)
+  {
+    /* The last frame or its answer is lost: the 3 bit keyframe sequence can
+     * not tell the keyframes missed, start over with a keyframe each way */
+    mg_sCom2PriTx.u8Cnt = 0u;
+    mg_sPri2ComRx.u16KeyLen = 0u;
+  }
+  mg_u8Com1RxPend = TRUE;
+  INTCOM_FRM_vPackCom2PriDelta(&sFrm, &mg_sCom2PriTx, pau8TxBuf, u16TxDataNbr);
+#else
+  INTCOM_FRM_vPackCom2Pri(&sFrm, pau8TxBuf, u16TxDataNbr);
+#endif
 }
 
 /** *****************************************************************************
@@ -129,71 +152,34 @@ void INTCOM_vCom1TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
 void INTCOM_vCom1RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
 {
   /* Init data */
-  GLOBAL_U_U16BIT uPfcStatus00;
-  GLOBAL_U_U16BIT uPfcStatus01;
-  GLOBAL_U_U8BIT  uTempStatus00;
-  WORD_VAL u16DebugData0;
-  WORD_VAL u16DebugData1;
-  WORD_VAL u16DebugData2;
-  WORD_VAL u1610mVVoltInRmsAvg;
-  WORD_VAL u161mACurrInRmsAvg;
-  WORD_VAL u16100mWPwrInRmsAvg;
-  WORD_VAL u16100mHzVoltInFreq;
-  WORD_VAL u16q16PwrFact;
-  WORD_VAL u16PfcNtcAdcAvg;
-  WORD_VAL u16VBusAdcAvg;
-  WORD_VAL uAcOffset;
-  DWORD_VAL u32AppFwRev;
-  DWORD_VAL u32BootFwRev;
+  INTCOM_FRM_S_PRI2COM sFrm;
+  uint32 u32AppFwRev;
+  uint32 u32BootFwRev;
   uint32 u32PreAppFwRev;
   uint32 u32PreBootFwRev;
+  uint16 u16VcapMul128;
   uint8 u8ComStatus;
 
-  u8ComStatus                   = pau8RxBuf[u16RxBufCnt++]; /* COM status */
-  u32AppFwRev.Bytes.LB          = pau8RxBuf[u16RxBufCnt++]; /* MAJOR_REV */
-  u32AppFwRev.Bytes.HB          = pau8RxBuf[u16RxBufCnt++]; /* MINOR_REV */
-  u32AppFwRev.Bytes.UB          = pau8RxBuf[u16RxBufCnt++]; /* DEBUG_REV */
-  u32BootFwRev.Bytes.LB         = pau8RxBuf[u16RxBufCnt++]; /* MAJOR_REV */
-  u32BootFwRev.Bytes.HB         = pau8RxBuf[u16RxBufCnt++]; /* MINOR_REV */
-  u32BootFwRev.Bytes.UB         = pau8RxBuf[u16RxBufCnt++]; /* DEBUG_REV */
-  uPfcStatus00.Bytes.LB         = pau8RxBuf[u16RxBufCnt++]; /* PFC status00 low byte*/
-  uPfcStatus00.Bytes.HB         = pau8RxBuf[u16RxBufCnt++]; /* PFC status00 high byte*/
-  uPfcStatus01.Bytes.LB         = pau8RxBuf[u16RxBufCnt++]; /* PFC status01 low byte*/
-  uPfcStatus01.Bytes.HB         = pau8RxBuf[u16RxBufCnt++]; /* PFC status01 high byte*/
-  uTempStatus00.ALL             = pau8RxBuf[u16RxBufCnt++]; /* PFC temperature status */
-  u16DebugData0.Bytes.LB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register0 low byte */
-  u16DebugData0.Bytes.HB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register0 low byte */
-  u16DebugData1.Bytes.LB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register1 low byte */
-  u16DebugData1.Bytes.HB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register1 low byte */
-  u16DebugData2.Bytes.LB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register2 low byte */
-  u16DebugData2.Bytes.HB        = pau8RxBuf[u16RxBufCnt++]; /* Dubug register2 low byte */
-  u1610mVVoltInRmsAvg.Bytes.LB	= pau8RxBuf[u16RxBufCnt++]; /* AC voltage RMS adc average value low byte */
-  u1610mVVoltInRmsAvg.Bytes.HB	= pau8RxBuf[u16RxBufCnt++]; /* AC voltage RMS adc average value high byte */
-  u161mACurrInRmsAvg.Bytes.LB	  = pau8RxBuf[u16RxBufCnt++]; /* AC current RMS adc average value low byte */
-  u161mACurrInRmsAvg.Bytes.HB	  = pau8RxBuf[u16RxBufCnt++]; /* AC current RMS adc average value high byte */
-  u16100mWPwrInRmsAvg.Bytes.LB	= pau8RxBuf[u16RxBufCnt++]; /* AC power RMS adc average value low byte */
-  u16100mWPwrInRmsAvg.Bytes.HB	= pau8RxBuf[u16RxBufCnt++]; /* AC power RMS adc average value high byte */
-  u16100mHzVoltInFreq.Bytes.LB	= pau8RxBuf[u16RxBufCnt++]; /* The frequency of AC low byte , 0.1 Hz */
-  u16100mHzVoltInFreq.Bytes.HB	= pau8RxBuf[u16RxBufCnt++]; /* The frequency of AC high byte , 0.1 Hz */
-  u16q16PwrFact.Bytes.LB	      = pau8RxBuf[u16RxBufCnt++]; /* Power fact low byte */
-  u16q16PwrFact.Bytes.HB	      = pau8RxBuf[u16RxBufCnt++]; /* Power fact high byte */
-  u16PfcNtcAdcAvg.Bytes.LB	    = pau8RxBuf[u16RxBufCnt++]; /* NTC adc average value low byte */
-  u16PfcNtcAdcAvg.Bytes.HB	    = pau8RxBuf[u16RxBufCnt++]; /* NTC adc average value high byte */
-  u16VBusAdcAvg.Bytes.LB	      = pau8RxBuf[u16RxBufCnt++]; /* Bus voltage adc average value low byte */
-  u16VBusAdcAvg.Bytes.HB	      = pau8RxBuf[u16RxBufCnt++]; /* Bus voltage adc average value high byte */
-  uAcOffset.Bytes.LB            = pau8RxBuf[u16RxBufCnt++]; 
-  uAcOffset.Bytes.HB            = pau8RxBuf[u16RxBufCnt++];
+  mg_u8Com1RxPend = FALSE;
+  u8ComStatus = pau8RxBuf[u16RxBufCnt++]; /* COM status */
+  if (0u == INTCOM_FRM_u16UnpackPri2ComDelta(&pau8RxBuf[u16RxBufCnt], MG_RX_PAYLOAD_LEN(pau8RxBuf),
+                                                  &mg_sPri2ComRx, &sFrm))
+  {
+    return;   /* Other layout version, PRI_UART_FAIL follows with the monitor */
+  }
+  u32AppFwRev  = MG_U32_REV(sFrm.au8AppRev);   /* MAJOR, MINOR, DEBUG_REV */
+  u32BootFwRev = MG_U32_REV(sFrm.au8BootRev);
 
   /* Write data from RTE */
   INTCOM_Rte_Write_P_uPriComStatus(u8ComStatus);
   INTCOM_Rte_Read_R_uAppFwRevPri(&u32PreAppFwRev);
   INTCOM_Rte_Read_R_uBootFwRevPri(&u32PreBootFwRev);
 
-  if( (u32PreAppFwRev != u32AppFwRev.u32Val) ||
-      (u32PreBootFwRev != u32BootFwRev.u32Val))
+  if( (u32PreAppFwRev != u32AppFwRev) ||
+      (u32PreBootFwRev != u32BootFwRev))
   {
-    INTCOM_Rte_Write_P_u32AppFwRevPri(u32AppFwRev.u32Val);
-    INTCOM_Rte_Write_P_u32BootFwRevPri(u32BootFwRev.u32Val);
+    INTCOM_Rte_Write_P_u32AppFwRevPri(u32AppFwRev);
+    INTCOM_Rte_Write_P_u32BootFwRevPri(u32BootFwRev);
     INTCOM_RTE_Write_B_P_PRI_REV_UPDATE(TRUE);
   }
 
@@ -202,7 +188,7 @@ void INTCOM_vCom1RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufC
     if(FALSE != INTCOM_RTE_B_IIN_OFFSET_CALIB())
     {
       INTCOM_RTE_Write_B_P_AC_OFFSET_NEED_SAVE(TRUE);
-      INTCOM_Rte_Write_P_s16AcOffset(uAcOffset.s16Val);
+      INTCOM_Rte_Write_P_s16AcOffset(sFrm.s16AcOffset);
     }
   }
   else
@@ -210,21 +196,21 @@ void INTCOM_vCom1RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufC
     /* do nothing */
   }
 
-  INTCOM_Rte_Write_P_uPfcStatus00(uPfcStatus00.ALL);
-  INTCOM_Rte_Write_P_uPfcStatus01(uPfcStatus01.ALL);
-  INTCOM_Rte_Write_P_uTempStatus00Pri(uTempStatus00.ALL);
-  INTCOM_Rte_Write_P_u16DebugData0Pri(u16DebugData0.u16Val);
-  INTCOM_Rte_Write_P_u16DebugData1Pri(u16DebugData1.u16Val);
-  INTCOM_Rte_Write_P_u16DebugData2Pri(u16DebugData2.u16Val);
-  INTCOM_Rte_Write_P_u1610mVVinRmsAvg(u1610mVVoltInRmsAvg.u16Val);
-  INTCOM_Rte_Write_P_u161mAIinRmsAvg(u161mACurrInRmsAvg.u16Val);
-  INTCOM_Rte_Write_P_u16100mWPwrInRmsAvg(u16100mWPwrInRmsAvg.u16Val);
-  INTCOM_Rte_Write_P_u16100mHzVoltInFreq(u16100mHzVoltInFreq.u16Val);
-  INTCOM_Rte_Write_P_u16q16PwrFact(u16q16PwrFact.u16Val);
-  INTCOM_Rte_Write_P_u16PfcNtcAdcAvg(u16PfcNtcAdcAvg.u16Val);
-  INTCOM_Rte_Write_P_u16VbulkAdc(u16VBusAdcAvg.u16Val);
-  u16VBusAdcAvg.u16Val = (uint16)(((uint32)u16VBusAdcAvg.u16Val * 128u)/100u);
-  INTCOM_Rte_Write_P_u16Vcap_Mul_128(u16VBusAdcAvg.u16Val);
+  INTCOM_Rte_Write_P_uPfcStatus00(sFrm.uPfcStatus00);
+  INTCOM_Rte_Write_P_uPfcStatus01(sFrm.uPfcStatus01);
+  INTCOM_Rte_Write_P_uTempStatus00Pri(sFrm.u8TempStatus00);
+  INTCOM_Rte_Write_P_u16DebugData0Pri(sFrm.au16DebugData[0]);
+  INTCOM_Rte_Write_P_u16DebugData1Pri(sFrm.au16DebugData[1]);
+  INTCOM_Rte_Write_P_u16DebugData2Pri(sFrm.au16DebugData[2]);
+  INTCOM_Rte_Write_P_u1610mVVinRmsAvg(sFrm.u16VinRmsAvg);
+  INTCOM_Rte_Write_P_u161mAIinRmsAvg(sFrm.u16IinRmsAvg);
+  INTCOM_Rte_Write_P_u16100mWPwrInRmsAvg(sFrm.u16PinRmsAvg);
+  INTCOM_Rte_Write_P_u16100mHzVoltInFreq(sFrm.u16VinFreq);
+  INTCOM_Rte_Write_P_u16q16PwrFact(sFrm.u16PwrFact);
+  INTCOM_Rte_Write_P_u16PfcNtcAdcAvg(sFrm.u16PfcNtcAdcAvg);
+  INTCOM_Rte_Write_P_u16VbulkAdc(sFrm.u16VBusAdcAvg);
+  u16VcapMul128 = (uint16)(((uint32)sFrm.u16VBusAdcAvg * 128u)/100u);
+  INTCOM_Rte_Write_P_u16Vcap_Mul_128(u16VcapMul128);
 
   INTCOM_RTE_Write_B_P_AC_LOST(INTCOM_RTE_Read_B_R_PRI_VIN_DROPOUT());
   INTCOM_RTE_Write_B_P_VIN_LINE_LOW(INTCOM_RTE_Read_B_R_PRI_VIN_LINE());
@@ -247,6 +233,7 @@ void INTCOM_vCom1RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufC
  ***************************************************************************** */
 void INTCOM_vCom2TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
 {
+  INTCOM_FRM_S_COM2SEC sFrm;
   GLOBAL_U_U16BIT uCom2Sec00;
   WORD_VAL uDebugData0Addr;
   WORD_VAL uV1Gain;
@@ -273,28 +260,30 @@ void INTCOM_vCom2TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
   INTCOM_Rte_Read_R_uCaliI1Ofs(&uCaliI1Ofs);
 
   /* Fill buffer */
-  pau8TxBuf[(*u16TxDataNbr)++] = uCom2Sec00.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCom2Sec00.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uDebugData0Addr.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uDebugData0Addr.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uV1Gain.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uV1Gain.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIGain.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIGain.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIshareGain.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIshareGain.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = u100mHzVoltInFreq.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = u100mHzVoltInFreq.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIshareOfs.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uIshareOfs.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliV1Amp.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliV1Amp.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliV1Ofs.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliV1Ofs.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliI1Amp.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliI1Amp.Bytes.HB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliI1Ofs.Bytes.LB;
-  pau8TxBuf[(*u16TxDataNbr)++] = uCaliI1Ofs.Bytes.HB;
+  sFrm.u8Rsvd0       = 0u;
+  sFrm.uComStatus00  = uCom2Sec00.ALL;
+  sFrm.u16DebugAddr  = uDebugData0Addr.u16Val;
+  sFrm.u16V1Gain     = uV1Gain.u16Val;
+  sFrm.u16IGain      = uIGain.u16Val;
+  sFrm.u16IShareGain = uIshareGain.u16Val;
+  sFrm.u16VinFreq    = u100mHzVoltInFreq.u16Val;
+  sFrm.s16IShareOfs  = uIshareOfs.s16Val;
+  sFrm.s16CaliV1Amp  = uCaliV1Amp.s16Val;
+  sFrm.s16CaliV1Ofs  = uCaliV1Ofs.s16Val;
+  sFrm.s16CaliI1Amp  = uCaliI1Amp.s16Val;
+  sFrm.s16CaliI1Ofs  = uCaliI1Ofs.s16Val;
+#if MG_INTCOM_DELTA
+  if (FALSE != mg_u8Com2RxPend)
+  {
+    /* The last frame or its answer is lost, see INTCOM_vCom1TxData() */
+    mg_sCom2SecTx.u8Cnt = 0u;
+    mg_sSec2ComRx.u16KeyLen = 0u;
+  }
+  mg_u8Com2RxPend = TRUE;
+  INTCOM_FRM_vPackCom2SecDelta(&sFrm, &mg_sCom2SecTx, pau8TxBuf, u16TxDataNbr);
+#else
+  INTCOM_FRM_vPackCom2Sec(&sFrm, pau8TxBuf, u16TxDataNbr);
+#endif
 }
 
 /** *****************************************************************************
@@ -310,79 +299,54 @@ void INTCOM_vCom2TxData(uint8 *pau8TxBuf, uint16 *u16TxDataNbr)
 void INTCOM_vCom2RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufCnt)
 {
   /* Init data */
-  DWORD_VAL uAppFwRev;
-  DWORD_VAL uBootFwRev;
-  GLOBAL_U_U16BIT uLlcStatus00;
-  GLOBAL_U_U16BIT uLlcStatus01;
-  GLOBAL_U_U16BIT uLlcStatus02;
-  GLOBAL_U_U8BIT  uTempStatus00;
-  WORD_VAL uDebugData0;
-  WORD_VAL uDebugData1;
-  WORD_VAL uDebugData2;
-  WORD_VAL u10mVVoltOutExtAvg;
-  WORD_VAL u10mVVoltOutIntAvg;
-  WORD_VAL u10mACurrOutAvg;
-  WORD_VAL u100mWPwrOutAvg;
-  WORD_VAL u1mVVoltNtc1Avg;
-  WORD_VAL u1mVVoltNtc2Avg;
-  WORD_VAL u1mVIShareAvg;
-  WORD_VAL u1mVILocalAvg;
+  INTCOM_FRM_S_SEC2COM sFrm;
+  uint32 u32AppFwRev;
+  uint32 u32BootFwRev;
   uint32 u32PreAppFwRev;
   uint32 u32PreBootFwRev;
+  uint16 u16PayloadLen;
+  uint8 u8Idx;
   uint8 u8ComStatus;
   boolean bIsV1OcpTest;
 
-  u8ComStatus                   = pau8RxBuf[u16RxBufCnt++]; /* COM status */
-  uAppFwRev.Bytes.LB            = pau8RxBuf[u16RxBufCnt++]; /* MAJOR_REV */
-  uAppFwRev.Bytes.HB            = pau8RxBuf[u16RxBufCnt++]; /* MINOR_REV */
-  uAppFwRev.Bytes.UB            = pau8RxBuf[u16RxBufCnt++]; /* DEBUG_REV */
-  uBootFwRev.Bytes.LB           = pau8RxBuf[u16RxBufCnt++]; /* MAJOR_REV */
-  uBootFwRev.Bytes.HB           = pau8RxBuf[u16RxBufCnt++]; /* MINOR_REV */
-  uBootFwRev.Bytes.UB           = pau8RxBuf[u16RxBufCnt++]; /* DEBUG_REV */
-  uLlcStatus00.Bytes.LB         = pau8RxBuf[u16RxBufCnt++];
-  uLlcStatus00.Bytes.HB         = pau8RxBuf[u16RxBufCnt++];
-  uLlcStatus01.Bytes.LB         = pau8RxBuf[u16RxBufCnt++];
-  uLlcStatus01.Bytes.HB         = pau8RxBuf[u16RxBufCnt++];
-  uLlcStatus02.Bytes.LB         = pau8RxBuf[u16RxBufCnt++];
-  uLlcStatus02.Bytes.HB         = pau8RxBuf[u16RxBufCnt++];
-  uTempStatus00.ALL             = pau8RxBuf[u16RxBufCnt++];
-  uDebugData0.Bytes.LB          = pau8RxBuf[u16RxBufCnt++];
-  uDebugData0.Bytes.HB          = pau8RxBuf[u16RxBufCnt++];
-  uDebugData1.Bytes.LB          = pau8RxBuf[u16RxBufCnt++];
-  uDebugData1.Bytes.HB          = pau8RxBuf[u16RxBufCnt++];
-  uDebugData2.Bytes.LB          = pau8RxBuf[u16RxBufCnt++];
-  uDebugData2.Bytes.HB          = pau8RxBuf[u16RxBufCnt++];
-  u10mVVoltOutExtAvg.Bytes.LB	  = pau8RxBuf[u16RxBufCnt++];
-  u10mVVoltOutExtAvg.Bytes.HB	  = pau8RxBuf[u16RxBufCnt++];
-  u10mACurrOutAvg.Bytes.LB	    = pau8RxBuf[u16RxBufCnt++];
-  u10mACurrOutAvg.Bytes.HB	    = pau8RxBuf[u16RxBufCnt++];
-  u100mWPwrOutAvg.Bytes.LB	    = pau8RxBuf[u16RxBufCnt++];
-  u100mWPwrOutAvg.Bytes.HB	    = pau8RxBuf[u16RxBufCnt++];
-  u1mVVoltNtc1Avg.Bytes.LB	    = pau8RxBuf[u16RxBufCnt++];
-  u1mVVoltNtc1Avg.Bytes.HB	    = pau8RxBuf[u16RxBufCnt++];
-  u1mVVoltNtc2Avg.Bytes.LB	    = pau8RxBuf[u16RxBufCnt++];
-  u1mVVoltNtc2Avg.Bytes.HB	    = pau8RxBuf[u16RxBufCnt++];
-  u10mVVoltOutIntAvg.Bytes.LB	  = pau8RxBuf[u16RxBufCnt++];
-  u10mVVoltOutIntAvg.Bytes.HB	  = pau8RxBuf[u16RxBufCnt++];
-  u1mVIShareAvg.Bytes.LB	      = pau8RxBuf[u16RxBufCnt++];
-  u1mVIShareAvg.Bytes.HB	      = pau8RxBuf[u16RxBufCnt++];
-  u1mVILocalAvg.Bytes.LB	      = pau8RxBuf[u16RxBufCnt++];
-  u1mVILocalAvg.Bytes.HB	      = pau8RxBuf[u16RxBufCnt++];
+  mg_u8Com2RxPend = FALSE;
+  u8ComStatus   = pau8RxBuf[u16RxBufCnt++]; /* COM status */
+  u16PayloadLen = INTCOM_FRM_u16UnpackSec2ComDelta(&pau8RxBuf[u16RxBufCnt], MG_RX_PAYLOAD_LEN(pau8RxBuf),
+                                                   &mg_sSec2ComRx, &sFrm);
+  if (0u == u16PayloadLen)
+  {
+    return;   /* Other layout version or delta without keyframe, SEC_UART_FAIL follows with the monitor */
+  }
+  u32AppFwRev  = MG_U32_REV(sFrm.au8AppRev);   /* MAJOR, MINOR, DEBUG_REV */
+  u32BootFwRev = MG_U32_REV(sFrm.au8BootRev);
+
+  /* Appended fields, not sent by older secondary firmware */
+  if (u16PayloadLen >= INTCOM_FRM_U16_SEC2COM_END_CPU_LOAD)
+  {
+    INTCOM_Rte_Write_P_u16CpuLoadSec(sFrm.u16CpuLoad);  /* CPU load (0.1%) */
+  }
+  if (u16PayloadLen >= INTCOM_FRM_U16_SEC2COM_END_ISR_MON)
+  {
+    for (u8Idx = 0U; u8Idx < RTE_SEC_ISR_MON_NUM; u8Idx++)
+    {
+      INTCOM_Rte_Write_P_u16IsrMonSec(u8Idx, sFrm.au16IsrMon[u8Idx]);
+    }
+  }
 
   /* Write data to RTE */
   INTCOM_Rte_Write_P_uSecComStatus(u8ComStatus);
   INTCOM_Rte_Read_R_uAppFwRevSec(&u32PreAppFwRev);
   INTCOM_Rte_Read_R_uBootFwRevSec(&u32PreBootFwRev);
 
-  if((u32PreAppFwRev != uAppFwRev.u32Val) ||
-     (u32PreBootFwRev != uBootFwRev.u32Val))
+  if((u32PreAppFwRev != u32AppFwRev) ||
+     (u32PreBootFwRev != u32BootFwRev))
   {
-    INTCOM_Rte_Write_P_u32AppFwRevSec(uAppFwRev.u32Val);
-    INTCOM_Rte_Write_P_u32BootFwRevSec(uBootFwRev.u32Val);
+    INTCOM_Rte_Write_P_u32AppFwRevSec(u32AppFwRev);
+    INTCOM_Rte_Write_P_u32BootFwRevSec(u32BootFwRev);
     INTCOM_RTE_Write_B_P_SEC_REV_UPDATE(TRUE);
   }
-  INTCOM_Rte_Write_P_u16LlcStatus00(uLlcStatus00.ALL);
-  INTCOM_Rte_Write_P_u16LlcStatus01(uLlcStatus01.ALL);
+  INTCOM_Rte_Write_P_u16LlcStatus00(sFrm.uLlcStatus00);
+  INTCOM_Rte_Write_P_u16LlcStatus01(sFrm.uLlcStatus01);
   if(FALSE != INTCOM_RTE_Read_B_R_COM_V1_MONI_EN())
   {
     INTCOM_Rte_Write_B_P_V1_OVP(INTCOM_Rte_Read_B_R_SEC_OVP());
@@ -400,19 +364,19 @@ void INTCOM_vCom2RxData(uint8 *pau8RxBuf, uint8 u8BroadcastFlg, uint16 u16RxBufC
     }
     INTCOM_Rte_Write_B_P_V1_OCW(INTCOM_Rte_Read_B_R_SEC_OCW());
   }
-  INTCOM_Rte_Write_P_u16LlcStatus02(uLlcStatus02.ALL);
-  INTCOM_Rte_Write_P_u8TempStatus00Sec(uTempStatus00.ALL);
-  INTCOM_Rte_Write_P_u16DebugData0Sec(uDebugData0.u16Val);
-  INTCOM_Rte_Write_P_u16DebugData1Sec(uDebugData1.u16Val);
-  INTCOM_Rte_Write_P_u16DebugData2Sec(uDebugData2.u16Val);
-  INTCOM_Rte_Write_P_u1610mVV1ExtAvg(u10mVVoltOutExtAvg.u16Val);
-  INTCOM_Rte_Write_P_u1610mVVoltOutIntAvg(u10mVVoltOutIntAvg.u16Val);
-  INTCOM_Rte_Write_P_u161mAIV1Avg(u10mACurrOutAvg.u16Val);
-  INTCOM_Rte_Write_P_u16100mWPwrOutAvg(u100mWPwrOutAvg.u16Val);
-  INTCOM_Rte_Write_P_u16SrNtcAdcAvg(u1mVVoltNtc2Avg.u16Val);
-  INTCOM_Rte_Write_P_u16OringNtcAdcAvg(u1mVVoltNtc1Avg.u16Val);
-  INTCOM_Rte_Write_P_u16VIShareAdcAvg(u1mVIShareAvg.u16Val);
-  INTCOM_Rte_Write_P_u16VILocalAdcAvg(u1mVILocalAvg.u16Val);
+  INTCOM_Rte_Write_P_u16LlcStatus02(sFrm.uLlcStatus02);
+  INTCOM_Rte_Write_P_u8TempStatus00Sec(sFrm.u8TempStatus00);
+  INTCOM_Rte_Write_P_u16DebugData0Sec(sFrm.au16DebugData[0]);
+  INTCOM_Rte_Write_P_u16DebugData1Sec(sFrm.au16DebugData[1]);
+  INTCOM_Rte_Write_P_u16DebugData2Sec(sFrm.au16DebugData[2]);
+  INTCOM_Rte_Write_P_u1610mVV1ExtAvg(sFrm.u16VoutExtAvg);
+  INTCOM_Rte_Write_P_u1610mVVoltOutIntAvg(sFrm.u16VoutIntAvg);
+  INTCOM_Rte_Write_P_u161mAIV1Avg(sFrm.u16IoutAvg);
+  INTCOM_Rte_Write_P_u16100mWPwrOutAvg(sFrm.u16PoutAvg);
+  INTCOM_Rte_Write_P_u16SrNtcAdcAvg(sFrm.u16VNtc2Avg);
+  INTCOM_Rte_Write_P_u16OringNtcAdcAvg(sFrm.u16VNtc1Avg);
+  INTCOM_Rte_Write_P_u16VIShareAdcAvg(sFrm.u16VIShareAvg);
+  INTCOM_Rte_Write_P_u16VILocalAdcAvg(sFrm.u16VILocalAvg);
 
   mg_u32Com2MonCnt = 1000u;
   INTCOM_RTE_Write_B_P_SEC_UART_FAIL(FALSE);
@@ -439,6 +403,7 @@ void INTCOM_vTmOutMon(void)
   {
     INTCOM_RTE_Write_B_P_PRI_UART_FAIL(TRUE);
     INTCOM_RTE_Write_B_P_PRI_NO_RX_PKG(TRUE);
+    mg_sPri2ComRx.u16KeyLen = 0u;  /* Delta frames dropped until a fresh keyframe */
     INTCOM_RTE_Write_B_P_PRI_RX_PKG(FALSE);
 
     if(FALSE != INTCOM_RTE_Read_B_R_VIN_OK_ACTIVE())
@@ -455,6 +420,7 @@ void INTCOM_vTmOutMon(void)
   {
     INTCOM_RTE_Write_B_P_SEC_UART_FAIL(TRUE);
     INTCOM_RTE_Write_B_P_SEC_NO_RX_PKG(TRUE);
+    mg_sSec2ComRx.u16KeyLen = 0u;
 
     if(FALSE != INTCOM_RTE_Read_B_R_VIN_OK_ACTIVE())
     {
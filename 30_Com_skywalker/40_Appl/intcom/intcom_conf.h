@@ -31,6 +31,17 @@
  ******************************************************************************/
 
 #define MG_BOOT_MASK          0x01
+#define MG_RX_LEN_POS         2U      /* STX, ADDR, LEN, data: LEN data bytes follow */
+
+/* Payload bytes after the status byte (data: status, payload) */
+#define MG_RX_PAYLOAD_LEN(buf)  (((buf)[MG_RX_LEN_POS] > 0U) ? ((uint16)(buf)[MG_RX_LEN_POS] - 1U) : 0U)
+
+/* Revision bytes MAJOR, MINOR, DEBUG as in the RTE: 0x00DDmmMM */
+#define MG_U32_REV(au8)         ((uint32)(au8)[0] | ((uint32)(au8)[1] << 8u) | ((uint32)(au8)[2] << 16u))
+
+/* 1 = Send COM2PRI / COM2SEC as keyframes and delta frames, 0 = full frames
+ * only. The receivers decode both. */
+#define MG_INTCOM_DELTA         1
 		
 
 
@@ -0,0 +1,585 @@
+/** *****************************************************************************
+ * \file    intcom_frm.h
+ * \brief   Inter-MCU frame payloads of the Com MCU
+ *
+ *          Generated by C/intcom_frm_gen.c from C/intcom_frm.txt, do not edit.
+ *          The payload follows the status byte of the uartprt frame and
+ *          starts with the header byte.
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+#ifndef INTCOM_FRM_H
+#define INTCOM_FRM_H
+#ifdef __cplusplus
+  extern "C"  {
+#endif
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include "global.h"
+
+/*******************************************************************************
+ * Global constants and macros
+ ******************************************************************************/
+
+/* Header, payload byte 0 */
+#define INTCOM_FRM_U8_VER                          2U   /* Layout version */
+#define INTCOM_FRM_U8_VER_MASK                  0x0FU
+#define INTCOM_FRM_U8_SEQ_MASK                  0x70U   /* Keyframe sequence */
+#define INTCOM_FRM_U8_SEQ_INC                   0x10U
+#define INTCOM_FRM_U8_DELTA                     0x80U   /* Delta frame: bitmap of the changed fields, the fields */
+
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+/* COM2PRI: Status and calibration to the primary MCU, Com -> primary */
+typedef struct INTCOM_FRM_S_COM2PRI_
+{
+  uint8  u8Hdr;              /*   0: Header: layout version, keyframe sequence, delta flag */
+  uint8  u8Rsvd0;            /*   1: Reserved, aligns the next fields */
+  uint16 uComStatus00;       /*   2: (bits) Com to primary status */
+  uint16 u16DebugAddr;       /*   4: Flash offset of the debug word */
+  sint16 s16AcOffset;        /*   6: AC current offset */
+  sint16 s16VinCaliAmp;      /*   8: AC voltage calibration gain */
+  sint16 s16VinCaliOfs;      /*  10: AC voltage calibration offset */
+} INTCOM_FRM_S_COM2PRI;
+
+#define INTCOM_FRM_U16_COM2PRI_LEN                12U   /* Payload bytes */
+#define INTCOM_FRM_U16_COM2PRI_MIN_LEN            12U   /* Payload bytes without the appended fields */
+
+/* The struct has the payload layout */
+typedef uint8 INTCOM_FRM_au8Com2PriLenChk[(sizeof(INTCOM_FRM_S_COM2PRI) == INTCOM_FRM_U16_COM2PRI_LEN) ? 1 : -1];
+
+#define INTCOM_FRM_U8_COM2PRI_KEY_PERIOD           8U   /* Every n-th frame is a keyframe */
+#define INTCOM_FRM_U8_COM2PRI_FIELD_NUM            6U   /* Fields after the header, bits of the bitmap */
+
+/* Payload offset of each field and the payload end */
+static const uint8 INTCOM_FRM_au8Com2PriOfs[INTCOM_FRM_U8_COM2PRI_FIELD_NUM + 1U] =
+{
+  1U, 2U, 4U, 6U, 8U, 10U, 12U
+};
+
+typedef struct INTCOM_FRM_S_COM2PRI_TX_
+{
+  INTCOM_FRM_S_COM2PRI sKey;  /* Last keyframe, with its header */
+  uint8  u8Cnt;               /* Delta frames until the next keyframe */
+} INTCOM_FRM_S_COM2PRI_TX;
+
+/* PRI2COM: Status and measurements of the primary MCU, primary -> Com */
+typedef struct INTCOM_FRM_S_PRI2COM_
+{
+  uint8  u8Hdr;              /*   0: Header: layout version, keyframe sequence, delta flag */
+  uint8  au8AppRev[3];       /*   1: Application revision MAJOR, MINOR, DEBUG */
+  uint8  au8BootRev[3];      /*   4: Boot loader revision MAJOR, MINOR, DEBUG */
+  uint8  u8TempStatus00;     /*   7: (bits) PFC temperature status */
+  uint16 uPfcStatus00;       /*   8: (bits) PFC status 0 */
+  uint16 uPfcStatus01;       /*  10: (bits) PFC status 1 */
+  uint16 au16DebugData[3];   /*  12: Debug words */
+  uint16 u16VinRmsAvg;       /*  18: (10mV) AC voltage RMS average */
+  uint16 u16IinRmsAvg;       /*  20: (1mA) AC current RMS average */
+  uint16 u16PinRmsAvg;       /*  22: (100mW) AC input power average */
+  uint16 u16VinFreq;         /*  24: (100mHz) AC frequency */
+  uint16 u16PwrFact;         /*  26: (q16) Power factor */
+  uint16 u16PfcNtcAdcAvg;    /*  28: (adc) PFC NTC ADC average */
+  uint16 u16VBusAdcAvg;      /*  30: (10mV) Bulk voltage average */
+  sint16 s16AcOffset;        /*  32: AC current offset */
+} INTCOM_FRM_S_PRI2COM;
+
+#define INTCOM_FRM_U16_PRI2COM_LEN                34U   /* Payload bytes */
+#define INTCOM_FRM_U16_PRI2COM_MIN_LEN            34U   /* Payload bytes without the appended fields */
+
+/* The struct has the payload layout */
+typedef uint8 INTCOM_FRM_au8Pri2ComLenChk[(sizeof(INTCOM_FRM_S_PRI2COM) == INTCOM_FRM_U16_PRI2COM_LEN) ? 1 : -1];
+
+#define INTCOM_FRM_U8_PRI2COM_KEY_PERIOD           8U   /* Every n-th frame is a keyframe */
+#define INTCOM_FRM_U8_PRI2COM_FIELD_NUM           14U   /* Fields after the header, bits of the bitmap */
+
+/* Payload offset of each field and the payload end */
+static const uint8 INTCOM_FRM_au8Pri2ComOfs[INTCOM_FRM_U8_PRI2COM_FIELD_NUM + 1U] =
+{
+  1U, 4U, 7U, 8U, 10U, 12U, 18U, 20U, 22U, 24U, 26U, 28U, 30U, 32U, 34U
+};
+
+typedef struct INTCOM_FRM_S_PRI2COM_RX_
+{
+  INTCOM_FRM_S_PRI2COM sKey;  /* Last keyframe, with its header */
+  uint16 u16KeyLen;           /* Payload bytes of the keyframe, 0: none */
+} INTCOM_FRM_S_PRI2COM_RX;
+
+/* COM2SEC: Status and calibration to the secondary MCU, Com -> secondary */
+typedef struct INTCOM_FRM_S_COM2SEC_
+{
+  uint8  u8Hdr;              /*   0: Header: layout version, keyframe sequence, delta flag */
+  uint8  u8Rsvd0;            /*   1: Reserved, aligns the next fields */
+  uint16 uComStatus00;       /*   2: (bits) Com to secondary status */
+  uint16 u16DebugAddr;       /*   4: Flash offset of the debug word */
+  uint16 u16V1Gain;          /*   6: (q12) V1 voltage calibration gain */
+  uint16 u16IGain;           /*   8: (q12) V1 current calibration gain */
+  uint16 u16IShareGain;      /*  10: (q12) Current share calibration gain */
+  uint16 u16VinFreq;         /*  12: (100mHz) AC frequency */
+  sint16 s16IShareOfs;       /*  14: (10mA) Current share calibration offset */
+  sint16 s16CaliV1Amp;       /*  16: V1 voltage calibration amplitude */
+  sint16 s16CaliV1Ofs;       /*  18: V1 voltage calibration offset */
+  sint16 s16CaliI1Amp;       /*  20: V1 current calibration amplitude */
+  sint16 s16CaliI1Ofs;       /*  22: V1 current calibration offset */
+} INTCOM_FRM_S_COM2SEC;
+
+#define INTCOM_FRM_U16_COM2SEC_LEN                24U   /* Payload bytes */
+#define INTCOM_FRM_U16_COM2SEC_MIN_LEN            24U   /* Payload bytes without the appended fields */
+
+/* The struct has the payload layout */
+typedef uint8 INTCOM_FRM_au8Com2SecLenChk[(sizeof(INTCOM_FRM_S_COM2SEC) == INTCOM_FRM_U16_COM2SEC_LEN) ? 1 : -1];
+
+#define INTCOM_FRM_U8_COM2SEC_KEY_PERIOD           8U   /* Every n-th frame is a keyframe */
+#define INTCOM_FRM_U8_COM2SEC_FIELD_NUM           12U   /* Fields after the header, bits of the bitmap */
+
+/* Payload offset of each field and the payload end */
+static const uint8 INTCOM_FRM_au8Com2SecOfs[INTCOM_FRM_U8_COM2SEC_FIELD_NUM + 1U] =
+{
+  1U, 2U, 4U, 6U, 8U, 10U, 12U, 14U, 16U, 18U, 20U, 22U, 24U
+};
+
+typedef struct INTCOM_FRM_S_COM2SEC_TX_
+{
+  INTCOM_FRM_S_COM2SEC sKey;  /* Last keyframe, with its header */
+  uint8  u8Cnt;               /* Delta frames until the next keyframe */
+} INTCOM_FRM_S_COM2SEC_TX;
+
+/* SEC2COM: Status and measurements of the secondary MCU, secondary -> Com */
+typedef struct INTCOM_FRM_S_SEC2COM_
+{
+  uint8  u8Hdr;              /*   0: Header: layout version, keyframe sequence, delta flag */
+  uint8  au8AppRev[3];       /*   1: Application revision MAJOR, MINOR, DEBUG */
+  uint8  au8BootRev[3];      /*   4: Boot loader revision MAJOR, MINOR, DEBUG */
+  uint8  u8TempStatus00;     /*   7: (bits) Secondary temperature status */
+  uint16 uLlcStatus00;       /*   8: (bits) LLC status 0 */
+  uint16 uLlcStatus01;       /*  10: (bits) LLC status 1 */
+  uint16 uLlcStatus02;       /*  12: (bits) LLC status 2 */
+  uint16 au16DebugData[3];   /*  14: Debug words */
+  uint16 u16VoutExtAvg;      /*  20: (10mV) V1 voltage average, external sense */
+  uint16 u16IoutAvg;         /*  22: (10mA) V1 current average */
+  uint16 u16PoutAvg;         /*  24: (100mW) V1 power average */
+  uint16 u16VNtc1Avg;        /*  26: (1mV) ORing NTC voltage average */
+  uint16 u16VNtc2Avg;        /*  28: (1mV) SR NTC voltage average */
+  uint16 u16VoutIntAvg;      /*  30: (10mV) V1 voltage average, internal sense */
+  uint16 u16VIShareAvg;      /*  32: (1mV) Current share voltage average */
+  uint16 u16VILocalAvg;      /*  34: (1mV) Local current voltage average */
+  uint16 u16CpuLoad;         /*  36: (0.1%) CPU load, appended */
+  uint16 au16IsrMon[8];      /*  38: ISR timing monitor, SCHM_E_ISR_MON_COUNT words per ISR, appended */
+} INTCOM_FRM_S_SEC2COM;
+
+#define INTCOM_FRM_U16_SEC2COM_LEN                54U   /* Payload bytes */
+#define INTCOM_FRM_U16_SEC2COM_MIN_LEN            36U   /* Payload bytes without the appended fields */
+#define INTCOM_FRM_U16_SEC2COM_END_CPU_LOAD       38U   /* u16CpuLoad received */
+#define INTCOM_FRM_U16_SEC2COM_END_ISR_MON        54U   /* au16IsrMon received */
+
+/* The struct has the payload layout */
+typedef uint8 INTCOM_FRM_au8Sec2ComLenChk[(sizeof(INTCOM_FRM_S_SEC2COM) == INTCOM_FRM_U16_SEC2COM_LEN) ? 1 : -1];
+
+#define INTCOM_FRM_U8_SEC2COM_KEY_PERIOD           8U   /* Every n-th frame is a keyframe */
+#define INTCOM_FRM_U8_SEC2COM_FIELD_NUM           17U   /* Fields after the header, bits of the bitmap */
+
+/* Payload offset of each field and the payload end */
+static const uint8 INTCOM_FRM_au8Sec2ComOfs[INTCOM_FRM_U8_SEC2COM_FIELD_NUM + 1U] =
+{
+  1U, 4U, 7U, 8U, 10U, 12U, 14U, 20U, 22U, 24U, 26U, 28U, 30U, 32U, 34U, 36U, 38U, 54U
+};
+
+typedef struct INTCOM_FRM_S_SEC2COM_RX_
+{
+  INTCOM_FRM_S_SEC2COM sKey;  /* Last keyframe, with its header */
+  uint16 u16KeyLen;           /* Payload bytes of the keyframe, 0: none */
+} INTCOM_FRM_S_SEC2COM_RX;
+
+/*******************************************************************************
+ * Global functions (public to other modules)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Append the bitmap of the fields that differ from the keyframe and
+ *                these fields to the TX buffer
+ *
+ * \param[in]     pu8Frm   - payload
+ *                pu8Key   - keyframe payload
+ *                pau8Ofs  - field offsets, the payload end last
+ *                u8FieldNum - fields after the header
+ * \param[in,out] pu16TxDataNbr - bytes in the TX buffer
+ * \param[out]    pau8TxBuf - TX buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static inline void INTCOM_FRM_vPackDelta(const uint8 *pu8Frm, const uint8 *pu8Key, const uint8 *pau8Ofs,
+                                         uint8 u8FieldNum, uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)
+{
+  uint16 u16MapPos = *pu16TxDataNbr;
+  uint16 u16Pos = u16MapPos + (((uint16)u8FieldNum + 7U) >> 3U);
+  uint8 u8Field;
+  uint8 u8Idx;
+
+  for (u8Idx = 0U; u8Idx < ((u8FieldNum + 7U) >> 3U); u8Idx++)
+  {
+    pau8TxBuf[u16MapPos + u8Idx] = 0U;
+  }
+  for (u8Field = 0U; u8Field < u8FieldNum; u8Field++)
+  {
+    u8Idx = pau8Ofs[u8Field];
+    while ((u8Idx < pau8Ofs[u8Field + 1U]) && (pu8Frm[u8Idx] == pu8Key[u8Idx]))
+    {
+      u8Idx++;
+    }
+    if (u8Idx < pau8Ofs[u8Field + 1U]) /* Changed */
+    {
+      pau8TxBuf[u16MapPos + (u8Field >> 3U)] |= (uint8)(1U << (u8Field & 7U));
+      for (u8Idx = pau8Ofs[u8Field]; u8Idx < pau8Ofs[u8Field + 1U]; u8Idx++)
+      {
+        pau8TxBuf[u16Pos++] = pu8Frm[u8Idx];
+      }
+    }
+  }
+  *pu16TxDataNbr = u16Pos;
+}
+
+/** *****************************************************************************
+ * \brief         Apply the fields of a delta frame on the keyframe payload
+ *
+ * \param[in]     pau8Data - payload, header, bitmap, fields
+ *                u16Len   - payload bytes
+ *                pau8Ofs  - field offsets, the payload end last
+ *                u8FieldNum - fields after the header
+ * \param[in,out] pu8Frm   - keyframe payload, the changed fields written
+ * \param[out]    -
+ *
+ * \return        TRUE if the frame length matches the bitmap
+ *
+ ***************************************************************************** */
+static inline uint8 INTCOM_FRM_u8UnpackDelta(const uint8 *pau8Data, uint16 u16Len, const uint8 *pau8Ofs,
+                                             uint8 u8FieldNum, uint8 *pu8Frm)
+{
+  uint16 u16Pos = 1U + (((uint16)u8FieldNum + 7U) >> 3U);
+  uint8 u8Field;
+  uint8 u8Idx;
+
+  for (u8Field = 0U; (u8Field < u8FieldNum) && (u16Pos <= u16Len); u8Field++)
+  {
+    if (0U != (pau8Data[1U + (u8Field >> 3U)] & (uint8)(1U << (u8Field & 7U))))
+    {
+      for (u8Idx = pau8Ofs[u8Field]; (u8Idx < pau8Ofs[u8Field + 1U]) && (u16Pos < u16Len); u8Idx++)
+      {
+        pu8Frm[u8Idx] = pau8Data[u16Pos++];
+      }
+      if (u8Idx < pau8Ofs[u8Field + 1U])
+      {
+        return FALSE;   /* Frame shorter than the bitmap */
+      }
+    }
+  }
+  return (u16Pos == u16Len) ? TRUE : FALSE;
+}
+
+/** *****************************************************************************
+ * \brief         Append the payload to the TX buffer
+ *
+ * \param[in]     -
+ * \param[in,out] psFrm         - payload, the fields filled, the version is set here
+ *                pu16TxDataNbr - bytes in the TX buffer
+ * \param[out]    pau8TxBuf     - TX buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static inline void INTCOM_FRM_vPackCom2Pri(INTCOM_FRM_S_COM2PRI *psFrm, uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)
+{
+  const uint8 *pu8Src = (const uint8 *)psFrm;
+  uint16 u16Idx;
+
+  psFrm->u8Hdr = INTCOM_FRM_U8_VER;
+  for (u16Idx = 0U; u16Idx < INTCOM_FRM_U16_COM2PRI_LEN; u16Idx++)
+  {
+    pau8TxBuf[(*pu16TxDataNbr)++] = pu8Src[u16Idx];
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Append the payload to the TX buffer in delta mode: a keyframe every
+ *                INTCOM_FRM_U8_<frame>_KEY_PERIOD frames or when the delta frame is
+ *                not shorter, else the fields changed since the keyframe
+ *
+ * \param[in]     -
+ * \param[in,out] psFrm         - payload, the fields filled
+ *                psTx          - delta mode state, 0 at init and after a lost
+ *                                frame (u8Cnt = 0: keyframe next)
+ *                pu16TxDataNbr - bytes in the TX buffer
+ * \param[out]    pau8TxBuf     - TX buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static inline void INTCOM_FRM_vPackCom2PriDelta(INTCOM_FRM_S_COM2PRI *psFrm, INTCOM_FRM_S_COM2PRI_TX *psTx,
+                                                uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)
+{
+  uint16 u16Start = *pu16TxDataNbr;
+
+  if (0U != psTx->u8Cnt)
+  {
+    psFrm->u8Hdr = psTx->sKey.u8Hdr;
+    pau8TxBuf[(*pu16TxDataNbr)++] = (uint8)(psTx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA);
+    INTCOM_FRM_vPackDelta((const uint8 *)psFrm, (const uint8 *)&psTx->sKey, INTCOM_FRM_au8Com2PriOfs,
+                          INTCOM_FRM_U8_COM2PRI_FIELD_NUM, pau8TxBuf, pu16TxDataNbr);
+    if ((uint16)(*pu16TxDataNbr - u16Start) < INTCOM_FRM_U16_COM2PRI_LEN)
+    {
+      psTx->u8Cnt--;
+      return;
+    }
+    *pu16TxDataNbr = u16Start;   /* Not shorter than the keyframe */
+  }
+
+  /* Keyframe of the next sequence */
+  INTCOM_FRM_vPackCom2Pri(psFrm, pau8TxBuf, pu16TxDataNbr);
+  psFrm->u8Hdr = (uint8)(INTCOM_FRM_U8_VER |
+                         ((psTx->sKey.u8Hdr + INTCOM_FRM_U8_SEQ_INC) & INTCOM_FRM_U8_SEQ_MASK));
+  pau8TxBuf[u16Start] = psFrm->u8Hdr;
+  psTx->sKey = *psFrm;
+  psTx->u8Cnt = INTCOM_FRM_U8_COM2PRI_KEY_PERIOD - 1U;
+}
+
+/** *****************************************************************************
+ * \brief         Decode the payload of a received frame
+ *
+ * \param[in]     pau8Data - payload, the byte after the status byte
+ *                u16Len   - payload bytes (LEN - 1)
+ * \param[in,out] -
+ * \param[out]    psFrm    - payload fields
+ *
+ * \return        Payload bytes decoded, 0 if the frame is too short or of
+ *                another layout version (psFrm not written)
+ *
+ ***************************************************************************** */
+static inline uint16 INTCOM_FRM_u16UnpackPri2Com(const uint8 *pau8Data, uint16 u16Len, INTCOM_FRM_S_PRI2COM *psFrm)
+{
+  uint8 *pu8Dst = (uint8 *)psFrm;
+  uint16 u16Idx;
+
+  if ((u16Len < INTCOM_FRM_U16_PRI2COM_MIN_LEN) ||
+      (INTCOM_FRM_U8_VER != (pau8Data[0] & (INTCOM_FRM_U8_VER_MASK | INTCOM_FRM_U8_DELTA))))
+  {
+    return 0U;
+  }
+  if (u16Len > INTCOM_FRM_U16_PRI2COM_LEN)
+  {
+    u16Len = INTCOM_FRM_U16_PRI2COM_LEN;
+  }
+
+  for (u16Idx = 0U; u16Idx < u16Len; u16Idx++)
+  {
+    pu8Dst[u16Idx] = pau8Data[u16Idx];
+  }
+  return u16Len;
+}
+
+/** *****************************************************************************
+ * \brief         Decode a keyframe or a delta frame, the receiver of a frame in
+ *                delta mode (frames without delta mode are keyframes)
+ *
+ * \param[in]     pau8Data - payload, the byte after the status byte
+ *                u16Len   - payload bytes (LEN - 1)
+ * \param[in,out] psRx     - delta mode state, 0 at init and after a lost frame
+ *                           (u16KeyLen = 0: deltas dropped until a keyframe)
+ * \param[out]    psFrm    - payload fields
+ *
+ * \return        Payload bytes of the keyframe, 0 if the frame is dropped: too
+ *                short, another layout version or a delta frame on another
+ *                keyframe (psFrm not valid)
+ *
+ ***************************************************************************** */
+static inline uint16 INTCOM_FRM_u16UnpackPri2ComDelta(const uint8 *pau8Data, uint16 u16Len,
+                                                      INTCOM_FRM_S_PRI2COM_RX *psRx, INTCOM_FRM_S_PRI2COM *psFrm)
+{
+  if (0U == (pau8Data[0] & INTCOM_FRM_U8_DELTA))
+  {
+    psRx->u16KeyLen = INTCOM_FRM_u16UnpackPri2Com(pau8Data, u16Len, &psRx->sKey);
+    *psFrm = psRx->sKey;
+    return psRx->u16KeyLen;
+  }
+
+  /* Delta frame on the keyframe held: same version and sequence */
+  if ((0U == psRx->u16KeyLen) || (pau8Data[0] != (uint8)(psRx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA)))
+  {
+    return 0U;
+  }
+  *psFrm = psRx->sKey;
+  if (FALSE == INTCOM_FRM_u8UnpackDelta(pau8Data, u16Len, INTCOM_FRM_au8Pri2ComOfs,
+                                        INTCOM_FRM_U8_PRI2COM_FIELD_NUM, (uint8 *)psFrm))
+  {
+    return 0U;
+  }
+  return psRx->u16KeyLen;
+}
+
+/** *****************************************************************************
+ * \brief         Append the payload to the TX buffer
+ *
+ * \param[in]     -
+ * \param[in,out] psFrm         - payload, the fields filled, the version is set here
+ *                pu16TxDataNbr - bytes in the TX buffer
+ * \param[out]    pau8TxBuf     - TX buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static inline void INTCOM_FRM_vPackCom2Sec(INTCOM_FRM_S_COM2SEC *psFrm, uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)
+{
+  const uint8 *pu8Src = (const uint8 *)psFrm;
+  uint16 u16Idx;
+
+  psFrm->u8Hdr = INTCOM_FRM_U8_VER;
+  for (u16Idx = 0U; u16Idx < INTCOM_FRM_U16_COM2SEC_LEN; u16Idx++)
+  {
+    pau8TxBuf[(*pu16TxDataNbr)++] = pu8Src[u16Idx];
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Append the payload to the TX buffer in delta mode: a keyframe every
+ *                INTCOM_FRM_U8_<frame>_KEY_PERIOD frames or when the delta frame is
+ *                not shorter, else the fields changed since the keyframe
+ *
+ * \param[in]     -
+ * \param[in,out] psFrm         - payload, the fields filled
+ *                psTx          - delta mode state, 0 at init and after a lost
+ *                                frame (u8Cnt = 0: keyframe next)
+ *                pu16TxDataNbr - bytes in the TX buffer
+ * \param[out]    pau8TxBuf     - TX buffer
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static inline void INTCOM_FRM_vPackCom2SecDelta(INTCOM_FRM_S_COM2SEC *psFrm, INTCOM_FRM_S_COM2SEC_TX *psTx,
+                                                uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)
+{
+  uint16 u16Start = *pu16TxDataNbr;
+
+  if (0U != psTx->u8Cnt)
+  {
+    psFrm->u8Hdr = psTx->sKey.u8Hdr;
+    pau8TxBuf[(*pu16TxDataNbr)++] = (uint8)(psTx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA);
+    INTCOM_FRM_vPackDelta((const uint8 *)psFrm, (const uint8 *)&psTx->sKey, INTCOM_FRM_au8Com2SecOfs,
+                          INTCOM_FRM_U8_COM2SEC_FIELD_NUM, pau8TxBuf, pu16TxDataNbr);
+    if ((uint16)(*pu16TxDataNbr - u16Start) < INTCOM_FRM_U16_COM2SEC_LEN)
+    {
+      psTx->u8Cnt--;
+      return;
+    }
+    *pu16TxDataNbr = u16Start;   /* Not shorter than the keyframe */
+  }
+
+  /* Keyframe of the next sequence */
+  INTCOM_FRM_vPackCom2Sec(psFrm, pau8TxBuf, pu16TxDataNbr);
+  psFrm->u8Hdr = (uint8)(INTCOM_FRM_U8_VER |
+                         ((psTx->sKey.u8Hdr + INTCOM_FRM_U8_SEQ_INC) & INTCOM_FRM_U8_SEQ_MASK));
+  pau8TxBuf[u16Start] = psFrm->u8Hdr;
+  psTx->sKey = *psFrm;
+  psTx->u8Cnt = INTCOM_FRM_U8_COM2SEC_KEY_PERIOD - 1U;
+}
+
+/** *****************************************************************************
+ * \brief         Decode the payload of a received frame
+ *
+ * \param[in]     pau8Data - payload, the byte after the status byte
+ *                u16Len   - payload bytes (LEN - 1)
+ * \param[in,out] -
+ * \param[out]    psFrm    - payload fields
+ *
+ * \return        Payload bytes decoded, 0 if the frame is too short or of
+ *                another layout version (psFrm not written)
+ *
+ ***************************************************************************** */
+static inline uint16 INTCOM_FRM_u16UnpackSec2Com(const uint8 *pau8Data, uint16 u16Len, INTCOM_FRM_S_SEC2COM *psFrm)
+{
+  uint8 *pu8Dst = (uint8 *)psFrm;
+  uint16 u16Idx;
+
+  if ((u16Len < INTCOM_FRM_U16_SEC2COM_MIN_LEN) ||
+      (INTCOM_FRM_U8_VER != (pau8Data[0] & (INTCOM_FRM_U8_VER_MASK | INTCOM_FRM_U8_DELTA))))
+  {
+    return 0U;
+  }
+  if (u16Len > INTCOM_FRM_U16_SEC2COM_LEN)
+  {
+    u16Len = INTCOM_FRM_U16_SEC2COM_LEN;
+  }
+
+  for (u16Idx = 0U; u16Idx < u16Len; u16Idx++)
+  {
+    pu8Dst[u16Idx] = pau8Data[u16Idx];
+  }
+  for (; u16Idx < INTCOM_FRM_U16_SEC2COM_LEN; u16Idx++) /* Appended fields not received */
+  {
+    pu8Dst[u16Idx] = 0U;
+  }
+  return u16Len;
+}
+
+/** *****************************************************************************
+ * \brief         Decode a keyframe or a delta frame, the receiver of a frame in
+ *                delta mode (frames without delta mode are keyframes)
+ *
+ * \param[in]     pau8Data - payload, the byte after the status byte
+ *                u16Len   - payload bytes (LEN - 1)
+ * \param[in,out] psRx     - delta mode state, 0 at init and after a lost frame
+ *                           (u16KeyLen = 0: deltas dropped until a keyframe)
+ * \param[out]    psFrm    - payload fields
+ *
+ * \return        Payload bytes of the keyframe, 0 if the frame is dropped: too
+ *                short, another layout version or a delta frame on another
+ *                keyframe (psFrm not valid)
+ *
+ ***************************************************************************** */
+static inline uint16 INTCOM_FRM_u16UnpackSec2ComDelta(const uint8 *pau8Data, uint16 u16Len,
+                                                      INTCOM_FRM_S_SEC2COM_RX *psRx, INTCOM_FRM_S_SEC2COM *psFrm)
+{
+  if (0U == (pau8Data[0] & INTCOM_FRM_U8_DELTA))
+  {
+    psRx->u16KeyLen = INTCOM_FRM_u16UnpackSec2Com(pau8Data, u16Len, &psRx->sKey);
+    *psFrm = psRx->sKey;
+    return psRx->u16KeyLen;
+  }
+
+  /* Delta frame on the keyframe held: same version and sequence */
+  if ((0U == psRx->u16KeyLen) || (pau8Data[0] != (uint8)(psRx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA)))
+  {
+    return 0U;
+  }
+  *psFrm = psRx->sKey;
+  if (FALSE == INTCOM_FRM_u8UnpackDelta(pau8Data, u16Len, INTCOM_FRM_au8Sec2ComOfs,
+                                        INTCOM_FRM_U8_SEC2COM_FIELD_NUM, (uint8 *)psFrm))
+  {
+    return 0U;
+  }
+  return psRx->u16KeyLen;
+}
+
+
+#ifdef __cplusplus
+  }
+#endif
+#endif  /* INTCOM_FRM_H */
+
+  
+/*
+ * End of file
+ */
@@ -100,6 +100,8 @@
 #define Rte_Write_P_u16DebugData0Sec(var)            (RTE_Sec.u16SecDebug0.u16Val = (var))                          
 #define Rte_Write_P_u16DebugData1Sec(var)            (RTE_Sec.u16SecDebug1.u16Val = (var))                          
 #define Rte_Write_P_u16DebugData2Sec(var)            (RTE_Sec.u16SecDebug2.u16Val = (var))                          
+#define Rte_Write_P_u16CpuLoadSec(var)               (RTE_Sec.u16SecCpuLoad.u16Val = (var))                          
+#define Rte_Write_P_u16IsrMonSec(idx, var)           (RTE_Sec.au16SecIsrMon[(idx)].u16Val = (var))                          
 #define Rte_Write_P_u1610mVV1ExtAvg(var)             (RTE_Sec.u1610mVExtV1Avg.u16Val = (var))  
 #define Rte_Write_P_u1610mVV1IntExtAvg(var)          (RTE_Sec.u1610mVIntV1Avg.u16Val = (var))   
 #define Rte_Write_P_u161mAIV1Avg(var)                (RTE_Sec.u1610mAIoutAvg.u16Val = (var))                          
@@ -559,6 +561,18 @@ SINLINE void INTCOM_Rte_Write_P_u16DebugData2Sec(uint16 u16Data)
   Rte_Write_P_u16DebugData2Sec(u16Data);
   #endif
 }
+SINLINE void INTCOM_Rte_Write_P_u16CpuLoadSec(uint16 u16Data)
+{
+  #if MG_RTE_MODULE
+  Rte_Write_P_u16CpuLoadSec(u16Data);
+  #endif
+}
+SINLINE void INTCOM_Rte_Write_P_u16IsrMonSec(uint8 u8Index, uint16 u16Data)
+{
+  #if MG_RTE_MODULE
+  Rte_Write_P_u16IsrMonSec(u8Index, u16Data);
+  #endif
+}
 SINLINE void INTCOM_Rte_Write_P_u1610mVV1ExtAvg(uint16 u16Data)
 {
   #if MG_RTE_MODULE
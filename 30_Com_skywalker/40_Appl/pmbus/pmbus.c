@@ -59,6 +59,65 @@ typedef union
   } Bytes;
 }MG_U_CRC_BF;
 
+/*
+ * Sensor values the PMBus reads answer with. PMBUS_vCopySensorData fills the
+ * bank the I2C ISR does not use and publishes it with one sequence step, the
+ * ISR takes all values of a response from one bank.
+ */
+typedef struct
+{
+  WORD_VAL u16Vin_Linear;
+  WORD_VAL u16Iin_Linear;
+  WORD_VAL u16Pin_Linear;
+  WORD_VAL u16Vcap_Linear;
+  WORD_VAL u16Vout_V1_Linear;
+  WORD_VAL u16Iout_V1_Linear;
+  WORD_VAL u16Pout_V1_Linear;
+  WORD_VAL u16Vout_VSB_Linear;
+  WORD_VAL u16Iout_VSB_Linear;
+  WORD_VAL u16Pout_VSB_Linear;
+  WORD_VAL u16Vout_V1Sense_Linear;
+  WORD_VAL u16Vout_V1IShare_Linear;
+  WORD_VAL u16Temperatue_1_Linear;
+  WORD_VAL u16Temperatue_2_Linear;
+  WORD_VAL u16Temperatue_3_Linear;
+  WORD_VAL u16FanSpeed_1_Linear;
+  WORD_VAL u16FanSpeed_2_Linear;
+  WORD_VAL u16FanSpeed_3_Linear;
+  WORD_VAL u16FanSpeed_4_Linear;
+  DWORD_VAL u32HoursUsed;
+  DWORD_VAL u32PosTotal;
+  DWORD_VAL u32PosLast;
+  DWORD_VAL u32PinEnergyCtr;
+  DWORD_VAL u32PinSampleCount;
+  DWORD_VAL u32PoutEnergyCtr;
+  DWORD_VAL u32PoutSampleCount;
+  uint8 u8PinRolloverCount;
+  uint8 u8PoutRolloverCount;
+} MG_S_SENSOR_SNAP;
+
+#if MG_READ_IMAGE
+/* Cached read command */
+typedef struct
+{
+  uint8 u8Page;
+  uint8 u8Cmd;
+  uint8 u8Size;                                       /* Largest response length */
+} MG_S_READ_IMAGE_CFG;
+
+/* One set of read responses, the I2C ISR streams from the active one */
+typedef struct
+{
+  uint8 u8AuxMode;                                    /* Aux mode the images are rendered for */
+  uint8 au8Len[MG_READ_IMAGE_NUM];                    /* 0 = not rendered */
+  uint8 au8Data[MG_READ_IMAGE_DATA_SIZE];             /* Images at mg_au8ReadImageOff */
+#if MG_READ_IMAGE_PEC
+  uint8 au8PecSeed[MG_READ_IMAGE_NUM];                /* PEC after the read address */
+  uint8 au8Pec[MG_READ_IMAGE_NUM];                    /* PEC after the last data byte */
+#endif
+} MG_S_READ_IMAGE_BANK;
+#endif
+
 /*******************************************************************************
  * Local data types (private typedefs / structs / enums)
  ******************************************************************************/
@@ -90,6 +149,9 @@ typedef union
 #define MG_STA_PWR_UP_UPD_DLY          ((uint8)30U)     /* 30 * 0.1s , When power up, to delay 3 seconds    */
 #define MG_STA_CLR_FLT_UPD_DLY         ((uint8)10U)     /* 10 * 0.1s , When clear fault, to delay 1 seconds */
 
+/* Published sensor snapshot, the bank is the lowest bit of the sequence */
+#define MG_PS_SENSOR_SNAP()            (&mg_asSensorSnap[mg_u8SensorSeq & 1U])
+
 /*******************************************************************************
  * Local data (private to module)
  ******************************************************************************/
@@ -115,7 +177,7 @@ const uint8 PMB_mg_au8I2cRxNumber[256] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* $Bx */
   0, 0, 0, 4, 4, 4, 3, 2, 0, 11, 0, 0, 0, 0, 3, 0, /* $Cx */
   0, 5, 2, 0, 17, 0, 0, 0, 0, 0, 0, 0, 3, 6, 42, 2, /* $Dx */
-  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, /* $Ex */
+  1, 0, 0, 0, 2, 0, 0, 2, 0, 0, 2, 0, 0, 0, 0, 0, /* $Ex */
   14, 3, 0, 3, 4, 2, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, /* $Fx */
 };
 
@@ -142,8 +204,8 @@ const uint8 PMB_mg_au8I2cTxNumber[] =
   2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 14, 0, 0, 0, 0, /* $Ax */
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* $Bx */
   2, 2, 2, 2, 2, 2, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, /* $Cx */
-  1, 2, 1, 0, 0, 7, 1, 0, 1, 2, 1, 1, 2, 2, 2, 0, /* $Dx */       
-  2, 2, 2, 0, 0, 4, 4, 0, 0, 0, 1, 2, 2, 2, 2, 0, /* $Ex */
+  1, 2, 1, 0, 0, 7, 1, 0, 1, 2, 1, 27, 2, 2, 2, 0, /* $Dx */       
+  2, 2, 2, 0, 205, 4, 4, 47, 0, 0, 1, 2, 2, 2, 2, 0, /* $Ex */
   0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, /* $Fx */
 };
 
@@ -163,8 +225,8 @@ const uint8 PMB_mg_au8ByteFormatP0[] = {
   0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, /* $Ax */
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* $Bx */
   0xA0, 0xA0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* $Cx */
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0xBC, 0xFC, 0xFC, 0xFC, /* $Dx */     
-  0xDC, 0xBC, 0xBC, 0xBC, 0x00, 0xBC, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* $Ex */
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0xBC, 0xBC, 0xFC, 0xFC, 0xFC, /* $Dx */     
+  0xDC, 0xBC, 0xBC, 0xBC, 0xFC, 0xBC, 0xBC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, /* $Ex */
   0xD8, 0xF8, 0xD8, 0xD8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00 /* $Fx */
 };
 
@@ -203,10 +265,67 @@ static uint8 mg_u8UpdSensor = MG_E_UPD_FAN_NTC;
 static uint16 mg_u16StatusUpdDly = MG_STA_PWR_UP_UPD_DLY;
 static PMBUS_S_SMB_MASK mg_sP0SmbMask;
 static PMBUS_S_SMB_MASK mg_sP1SmbMask;
+static uint8 mg_au8SmbAlertSrc[MG_SMBALERT_SRC_NUM];   /* Status bits not masked by SMBALERT_MASK */
+static uint8 mg_au8SmbAlertAck[MG_SMBALERT_SRC_NUM];   /* of them, answered by an alert response */
 
 static WORD_VAL mg_au8DebugRegBuf[RTE_I2C_DEB_BUF_SIZE];
 static WORD_VAL mg_u16DebugRegIndex; 
 
+static MG_S_SENSOR_SNAP mg_asSensorSnap[2];
+static volatile uint8 mg_u8SensorSeq;
+
+#if MG_READ_IMAGE
+/*
+ * Read commands answered from a precomputed image, all of them are only
+ * updated by PMBUS_vCopySensorData
+ */
+static const MG_S_READ_IMAGE_CFG mg_asReadImageCfg[MG_READ_IMAGE_NUM] =
+{
+  { MG_PAGE_00, PMB_86_READ_EIN,           7u },
+  { MG_PAGE_00, PMB_87_READ_EOUT,          7u },
+  { MG_PAGE_00, PMB_88_READ_VIN,           2u },
+  { MG_PAGE_00, PMB_89_READ_IIN,           2u },
+  { MG_PAGE_00, PMB_8A_READ_VCAP,          2u },
+  { MG_PAGE_00, PMB_8B_READ_VOUT,          2u },
+  { MG_PAGE_00, PMB_8C_READ_IOUT,          2u },
+  { MG_PAGE_00, PMB_8D_READ_TEMPERATURE_1, 2u },
+  { MG_PAGE_00, PMB_8E_READ_TEMPERATURE_2, 2u },
+  { MG_PAGE_00, PMB_8F_READ_TEMPERATURE_3, 2u },
+  { MG_PAGE_00, PMB_90_READ_FAN_SPEED_1,   2u },
+  { MG_PAGE_00, PMB_91_READ_FAN_SPEED_2,   2u },
+  { MG_PAGE_00, PMB_92_READ_FAN_SPEED_3,   2u },
+  { MG_PAGE_00, PMB_93_READ_FAN_SPEED_4,   2u },
+  { MG_PAGE_00, PMB_96_READ_POUT,          2u },
+  { MG_PAGE_00, PMB_97_READ_PIN,           2u },
+  { MG_PAGE_01, PMB_8B_READ_VOUT,          2u },
+  { MG_PAGE_01, PMB_8C_READ_IOUT,          2u },
+  { MG_PAGE_01, PMB_96_READ_POUT,          2u },
+  { MG_PAGE_00, PMB_DB_MFR_READ_ALL,       MG_READ_ALL_SIZE }
+};
+
+static uint8 mg_au8ReadImageIdx[MG_READ_IMAGE_PAGE_NUM][MG_READ_IMAGE_CMD_NUM];
+static uint8 mg_au8ReadImageOff[MG_READ_IMAGE_NUM];
+static uint8 mg_u8ReadImageAllIdx;
+static MG_S_READ_IMAGE_BANK mg_asReadImage[2];
+static volatile uint8 mg_u8ReadImageBank;
+#endif
+
+/* Words of the MFR_READ_ALL record after STATUS_WORD, rendered on page 0 */
+static const uint8 mg_au8ReadAllCmd[] =
+{
+  PMB_88_READ_VIN,
+  PMB_89_READ_IIN,
+  PMB_8B_READ_VOUT,
+  PMB_8C_READ_IOUT,
+  PMB_96_READ_POUT,
+  PMB_97_READ_PIN,
+  PMB_8D_READ_TEMPERATURE_1,
+  PMB_8E_READ_TEMPERATURE_2,
+  PMB_8F_READ_TEMPERATURE_3,
+  PMB_90_READ_FAN_SPEED_1,
+  PMB_91_READ_FAN_SPEED_2
+};
+
 uint8 mg_au8BlackBoxData[RTE_BLACK_BOX_DEEPNESS][RTE_BLACK_BOX_DATA_CNT_PER_FAULT];
 uint8 mg_au8BBVinUVPData[RTE_BLACK_BOX_DEEPNESS_VIN_UVP][RTE_BLACK_BOX_DATA_CNT_PER_FAULT];
 PMBUS_U_BLCBOX_PAGE_W_DIS mg_uBlcBoxPageWrDis;
@@ -220,6 +339,14 @@ static uint16 mg_u16TxLinearDatFormatDiv128(uint32 u32DataIn);
 static void mg_vClearPage00Fault(void);
 static void mg_vClearPage01Fault(void);
 static void mg_vClearPageAllFault(void);
+static void mg_vSensorSnapPublish(void);
+static uint8 mg_u8ReadImageRender(uint8 u8Page, uint8 u8Cmd, uint8 u8AuxMode, uint8 *pu8Data);
+static uint8 mg_u8ReadAllRender(uint16 u16StatusWord, uint8 u8AuxMode, uint8 *pu8Data);
+#if MG_READ_IMAGE
+static void mg_vReadImageInit(void);
+static void mg_vReadImageUpdate(void);
+static uint8 mg_u8ReadImageSelect(uint8 u8Cmd);
+#endif
 
 //static uint32 mg_u32LinearDatFormatToNormal(uint16 u16DataIn);
 static sint32 mg_s32LinearDatFormatToNormal(uint16 u16DataIn);
@@ -289,7 +416,6 @@ void PMBUS_vInit(void)
   PMBUS_tStatusOld.u8StatusFan34P0.ALL = 0;
 
   /* System Used Data */
-  PMBUS_tData.u32DataCopy.u32Val = 0;
   PMBUS_tData.u16Vin_Linear.u16Val = 0;
   PMBUS_tData.u16Iin_Linear.u16Val = 0;
   PMBUS_tData.u16Pin_Linear.u16Val = 0;
@@ -316,7 +442,6 @@ void PMBUS_vInit(void)
   mg_u16UnlockDebugKey.u16Val = 0;
   PMBUS_uSysStatu0.ALL = 0;
   PMBUS_uSysStatu1.ALL = 0;
-  PMBUS_uDataUpdStatus.ALL = 0;
   PMBUS_uDataUpdStatus1.ALL = 0;
 
   mg_sP0SmbMask.u8Pmb_7A = 0x6F;
@@ -341,6 +466,11 @@ void PMBUS_vInit(void)
   {
     mg_au8DebugRegBuf[u8Cnt].u16Val = 0;
   }
+
+  mg_vSensorSnapPublish();
+#if MG_READ_IMAGE
+  mg_vReadImageInit();
+#endif
 }/* PMBUS_vInit */
 
 /*******************************************************************************
@@ -392,6 +522,51 @@ uint8 PMBUS_u8GetBootMcuId(void)
 	return mg_u8BootMcuId;
 }
 
+/*******************************************************************************
+ * \brief         The latched write frame has to be handled in thread context.
+ *                vPMBus_HandleData() also runs in the deferred I2C interrupt,
+ *                which preempts the scheduler tasks. Commands that write the
+ *                blackbox (S_DAM / MEM image) or the MFR data saved by a task
+ *                share that state with the tasks and are left to the polling.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        TRUE / FALSE
+ *
+ *******************************************************************************/
+uint8 PMBUS_u8IsThreadCmd(void)
+{
+  uint8 u8PmbusCommand;
+  uint8 u8Ret = FALSE;
+
+  PMBUS_Rte_Read_R_u8PMBusCmd(&u8PmbusCommand);
+
+  switch (u8PmbusCommand)
+  {
+    case PMB_99_MFR_ID:
+    case PMB_9A_MFR_MODEL:
+    case PMB_9B_MFR_REVISION:
+    case PMB_9C_MFR_LOCATION:
+    case PMB_9D_MFR_DATE:
+    case PMB_9E_MFR_SERIAL:
+    case PMB_DD_MFR_REAL_TIME_BLACK_BOX:
+    case PMB_DE_MFR_SYSTEM_BLCAKBOX:
+    case PMB_DF_MFR_BLCAKBOX_CONFIG:
+    case PMB_E0_MFR_CLEAR_BLACKBOX:
+    {
+      u8Ret = TRUE;
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+  return u8Ret;
+}
+
 /*******************************************************************************
  * \brief          Check boot mode
  *
@@ -503,45 +678,27 @@ void PMBUS_vCopySensorData(void)
     case MG_E_UPD_FAN_NTC:
     {
       /* Update Fan Speed 1 */
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u16FanSpeed1_Linear());
       u16Dummy = mg_u16TxLinearDatFormatDiv128(((uint32) PMBUS_SCFG_u16ReadFanSpeed(0)) << 7);
-      RTE_PMB_Write_bit_Fan_Spd_1_Upd(TRUE);
       RTE_PMB_Write_u16FanSpeed1_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Fan_Spd_1_Upd(FALSE);
 			
       /* Update Fan Speed 2 */			
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u16FanSpeed2_Linear());
       u16Dummy = mg_u16TxLinearDatFormatDiv128(((uint32) PMBUS_SCFG_u16ReadFanSpeed(1)) << 7);
-      RTE_PMB_Write_bit_Fan_Spd_2_Upd(TRUE);
       RTE_PMB_Write_u16FanSpeed2_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Fan_Spd_2_Upd(FALSE);
 			
       /* Update Temperatue_1: NTC_Inlet  */
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u16Temp1_Linear());
       u16Dummy = PMBUS_SCFG_s16ReadInletTemp() & 0x07FFu;
-      RTE_PMB_Write_bit_Inlet_Upd(TRUE);
       RTE_PMB_Write_u16Temp1_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Inlet_Upd(FALSE);
 			
       /* Update Temperatue_2: NTC_PFC */
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u16Temp2_Linear());
       u16Dummy = PMBUS_SCFG_s16ReadPriPfc() & 0x07FFu;
-      RTE_PMB_Write_bit_Pfc_Upd(TRUE);
       RTE_PMB_Write_u16Temp2_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Pfc_Upd(FALSE);
 
       /* Update Temperatue_3: NTC_SR  */
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u16Temp3_Linear());
       u16Dummy = (PMBUS_SCFG_s16ReadSecSr()) & 0x07FFu;  
-      RTE_PMB_Write_bit_SR_Upd(TRUE);
       RTE_PMB_Write_u16Temp3_Linear(u16Dummy);
-      RTE_PMB_Write_bit_SR_Upd(FALSE);
       
-      RTE_PMB_Write_u32DataCopy(RTE_PMB_Read_u32Hours_Used());
-      RTE_PMB_Write_bit_Hours_Upd(TRUE);
       PMBUS_Rte_Read_R_u32PMBusCmd(&u32Dummy);
       RTE_PMB_Write_u32Hours_Used(u32Dummy);
-      RTE_PMB_Write_bit_Hours_Upd(FALSE);
 
       mg_u8UpdSensor = MG_E_UPD_OUTPUT;
 
@@ -550,60 +707,31 @@ void PMBUS_vCopySensorData(void)
 
     case MG_E_UPD_OUTPUT:
     {
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Vout_V1_Linear();
       u16Dummy = PMBUS_tData.u16Vout_V1_Mul_128.u16Val;
-      RTE_PMB_Write_bit_Vout_V1_Upd(TRUE);
       RTE_PMB_Write_u16Vout_V1_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Vout_V1_Upd(FALSE);
 			
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Iout_V1_Linear();
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u16Iout_V1_Mul_128.u16Val);
-      RTE_PMB_Write_bit_Iout_V1_Upd(TRUE);
       RTE_PMB_Write_u16Iout_V1_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Iout_V1_Upd(FALSE);
 
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Vout_VSB_Linear();
       u16Dummy = PMBUS_tData.u16Vout_VSB_Mul_128.u16Val;
-      RTE_PMB_Write_bit_Vout_VSB_Upd(TRUE);
       RTE_PMB_Write_u16Vout_VSB_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Vout_VSB_Upd(FALSE);
 
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Iout_VSB_Linear();
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u16Iout_VSB_Mul_128.u16Val);
-      RTE_PMB_Write_bit_Iout_VSB_Upd(TRUE);
       RTE_PMB_Write_u16Iout_VSB_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Iout_VSB_Upd(FALSE);
 
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Pout_V1_Linear();
       u16Dummy = mg_u16TxLinearDatFormatDiv128((PMBUS_tData.u32Pout_V1_Mul_128.u32Val + PMBUS_tData.u32Pout_VSB_Mul_128.u32Val));
-      RTE_PMB_Write_bit_Pout_V1_Upd(TRUE);
       RTE_PMB_Write_u16Pout_V1_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Pout_V1_Upd(FALSE);
 
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Pout_VSB_Linear();
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u32Pout_VSB_Mul_128.u32Val);
-      RTE_PMB_Write_bit_Pout_VSB_Upd(TRUE);
       RTE_PMB_Write_u16Pout_VSB_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Pout_VSB_Upd(FALSE);
 			
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Vout_V1Sense_Linear();
       u16Dummy = PMBUS_tData.u16Vout_V1Sense_Mul_128.u16Val;
-      RTE_PMB_Write_bit_Vout_Sense_Upd(TRUE);
       RTE_PMB_Write_u16Vout_V1Sense_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Vout_Sense_Upd(FALSE);
 			
-      PMBUS_tData.u32DataCopy.Words.LW = RTE_PMB_Read_u16Vout_V1IShare_Mul_128();
       u16Dummy = PMBUS_tData.u16Vout_V1IShare_Mul_128.u16Val;
-      RTE_PMB_Write_bit_Vout_IShare_Upd(TRUE);
       RTE_PMB_Write_u16Vout_V1IShare_Linear(u16Dummy);
-      RTE_PMB_Write_bit_Vout_IShare_Upd(FALSE);
-
-      PMBUS_tData.u32PoutEnergyCtr_Old.u32Val = PMBUS_tData.u32PoutEnergyCtr.u32Val;
-      PMBUS_tData.u32PoutSampleCount_Old.u32Val = PMBUS_tData.u32PoutSampleCount.u32Val;
-      PMBUS_tData.u8PoutRolloverCount_Old = PMBUS_tData.u8PoutRolloverCount;
-
-      RTE_PMB_Write_bit_Eout_Upd(TRUE);
 
+      /* Update Eout */
       PMBUS_tData.u32PoutSampleCount.u32Val++;
       if (PMBUS_tData.u32PoutSampleCount.u32Val > 0x00FFFFFFu)
       {
@@ -625,7 +753,6 @@ void PMBUS_vCopySensorData(void)
           PMBUS_tData.u32PoutSampleCount.u32Val = 1;
         }
       }
-      RTE_PMB_Write_bit_Eout_Upd(FALSE);
 
       mg_u8UpdSensor = MG_E_UPD_INPUT;
 
@@ -638,50 +765,33 @@ void PMBUS_vCopySensorData(void)
        * Update Vin :
        * Covert (Vin * 128) value to Y
        */
-      PMBUS_tData.u32DataCopy.Words.LW = PMBUS_tData.u16Vin_Linear.u16Val;
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u16Vin_Mul_128.u16Val);
-      RTE_PMB_Write_bit_Vin_Upd(TRUE);
       PMBUS_tData.u16Vin_Linear.u16Val = u16Dummy;
-      RTE_PMB_Write_bit_Vin_Upd(FALSE);
 
       /*
        * Update Iin :
        * Covert (Iin * 128) value to Y
        */
-      PMBUS_tData.u32DataCopy.Words.LW = PMBUS_tData.u16Iin_Linear.u16Val;
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u16Iin_Mul_128.u16Val);
-      RTE_PMB_Write_bit_Iin_Upd(TRUE);
       PMBUS_tData.u16Iin_Linear.u16Val = u16Dummy;
-      RTE_PMB_Write_bit_Iin_Upd(FALSE);
       /*
        * Update VBulk :
        * Covert (VBulk * 128) value to Y
        */
-      PMBUS_tData.u32DataCopy.Words.LW = PMBUS_tData.u16Vcap_Linear.u16Val;
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u16Vcap_Mul_128.u16Val);
-      RTE_PMB_Write_bit_VCAP_Upd(TRUE);
       PMBUS_tData.u16Vcap_Linear.u16Val = u16Dummy;
-      RTE_PMB_Write_bit_VCAP_Upd(FALSE);
 
       /*
        * Update Pin :
        * Covert (Pin * 128) value to Y
        */
-      PMBUS_tData.u32DataCopy.Words.LW = PMBUS_tData.u16Pin_Linear.u16Val;
       u16Dummy = mg_u16TxLinearDatFormatDiv128(PMBUS_tData.u32Pin_Mul_128.u32Val);
-      RTE_PMB_Write_bit_Pin_Upd(TRUE);
       PMBUS_tData.u16Pin_Linear.u16Val = u16Dummy;
-      RTE_PMB_Write_bit_Pin_Upd(FALSE);
 
       /*
        * Update Ein :
        * m = 1, b = 0, r = 0
        */
-      PMBUS_tData.u32PinEnergyCtr_Old.u32Val = PMBUS_tData.u32PinEnergyCtr.u32Val;
-      PMBUS_tData.u32PinSampleCount_Old.u32Val = PMBUS_tData.u32PinSampleCount.u32Val;
-      PMBUS_tData.u8PinRolloverCount_Old = PMBUS_tData.u8PinRolloverCount;
-
-      RTE_PMB_Write_bit_Ein_Upd(TRUE);
       PMBUS_tData.u32PinSampleCount.u32Val++;
       if (PMBUS_tData.u32PinSampleCount.u32Val > 0x00FFFFFFu)
       {
@@ -703,7 +813,6 @@ void PMBUS_vCopySensorData(void)
           PMBUS_tData.u32PinSampleCount.u32Val = 1;
         }
       }
-      RTE_PMB_Write_bit_Ein_Upd(FALSE);
 
       mg_u8UpdSensor = MG_E_UPD_FAN_NTC;
 
@@ -716,6 +825,13 @@ void PMBUS_vCopySensorData(void)
       break;
     }
   }
+
+  mg_vSensorSnapPublish();
+
+#if MG_READ_IMAGE
+  /* Publish the new values as ready-to-send read responses */
+  mg_vReadImageUpdate();
+#endif
 }/* PMBUS_vCopySensorData */
 
 /*******************************************************************************
@@ -730,6 +846,10 @@ void PMBUS_vCopySensorData(void)
  *******************************************************************************/
 void PMBUS_vCopyStatusData(void)
 {
+  uint8 u8AlertAra;
+  uint8 u8Alert;
+  uint8 u8Cnt;
+
   /* First power up, need to delay 3s then to update status */
   if (0U < mg_u16StatusUpdDly)
   {
@@ -1098,29 +1218,49 @@ void PMBUS_vCopyStatusData(void)
 
     RTE_PMB_Write_bit_Status_Upd(FALSE);
   }
-  /* Judge SMBALERT base fault status */
-  if (
-       (PMBUS_tStatus.u8StatusVoutP0.ALL & (~mg_sP0SmbMask.u8Pmb_7A)) || /* 0x7A Page0 */
-       (PMBUS_tStatus.u8StatusVoutP1.ALL & (~mg_sP1SmbMask.u8Pmb_7A)) || /* 0x7A Page1 */
-       (PMBUS_tStatus.u8StatusIoutP0.ALL & (~mg_sP0SmbMask.u8Pmb_7B)) || /* 0x7B Page0 */
-       (PMBUS_tStatus.u8StatusIoutP1.ALL & (~mg_sP1SmbMask.u8Pmb_7B)) || /* 0x7B Page1 */ 
-       (PMBUS_tStatus.u8StatusInputP0.ALL & (~mg_sP0SmbMask.u8Pmb_7C))|| /* 0x7C */
-       (PMBUS_tStatus.u8StatusTempP0.ALL & (~mg_sP0SmbMask.u8Pmb_7D)) || /* 0x7D */
-       (PMBUS_tStatus.u8StatusCmlP0.ALL & (~mg_sP0SmbMask.u8Pmb_7E))  || /* 0x7E */
-       (PMBUS_tStatus.u8StatusOtherP0.ALL & (~mg_sP0SmbMask.u8Pmb_7F))|| /* 0x7F */
-       (PMBUS_tStatus.u8StatusMfrP0.ALL   & (~mg_sP0SmbMask.u8Pmb_80))|| /* 0x80 */
-       ((PMBUS_tStatus.u8StatusFan12P0.ALL & 0xF0u) & (~mg_sP0SmbMask.u8Pmb_81)) ||  /* 0x81 */
-       ((PMBUS_tStatus.u8StatusFan34P0.ALL & 0xF0u) & (~mg_sP0SmbMask.u8Pmb_82))     /* 0x82 */
-    )
+  /*
+   * Judge SMBALERT base fault status. The host answered by the alert
+   * response has seen the bits of the last pass, only bits set since then
+   * assert SMBALERT# again. Cleared bits are acknowledged no longer.
+   */
+  u8AlertAra = RTE_PMB_Read_u8SmbAlertAra();
+  if (FALSE != u8AlertAra)
   {
-    /* SMB asserted */
-    RTE_B_COM_SMBALLERT_ST = TRUE;
+    for (u8Cnt = 0U; u8Cnt < MG_SMBALERT_SRC_NUM; u8Cnt++)
+    {
+      mg_au8SmbAlertAck[u8Cnt] = mg_au8SmbAlertSrc[u8Cnt];
+    }
   }
-  else
+
+  mg_au8SmbAlertSrc[0]  = PMBUS_tStatus.u8StatusVoutP0.ALL & (~mg_sP0SmbMask.u8Pmb_7A);   /* 0x7A Page0 */
+  mg_au8SmbAlertSrc[1]  = PMBUS_tStatus.u8StatusVoutP1.ALL & (~mg_sP1SmbMask.u8Pmb_7A);   /* 0x7A Page1 */
+  mg_au8SmbAlertSrc[2]  = PMBUS_tStatus.u8StatusIoutP0.ALL & (~mg_sP0SmbMask.u8Pmb_7B);   /* 0x7B Page0 */
+  mg_au8SmbAlertSrc[3]  = PMBUS_tStatus.u8StatusIoutP1.ALL & (~mg_sP1SmbMask.u8Pmb_7B);   /* 0x7B Page1 */
+  mg_au8SmbAlertSrc[4]  = PMBUS_tStatus.u8StatusInputP0.ALL & (~mg_sP0SmbMask.u8Pmb_7C);  /* 0x7C */
+  mg_au8SmbAlertSrc[5]  = PMBUS_tStatus.u8StatusTempP0.ALL & (~mg_sP0SmbMask.u8Pmb_7D);   /* 0x7D */
+  mg_au8SmbAlertSrc[6]  = PMBUS_tStatus.u8StatusCmlP0.ALL & (~mg_sP0SmbMask.u8Pmb_7E);    /* 0x7E */
+  mg_au8SmbAlertSrc[7]  = PMBUS_tStatus.u8StatusOtherP0.ALL & (~mg_sP0SmbMask.u8Pmb_7F);  /* 0x7F */
+  mg_au8SmbAlertSrc[8]  = PMBUS_tStatus.u8StatusMfrP0.ALL & (~mg_sP0SmbMask.u8Pmb_80);    /* 0x80 */
+  mg_au8SmbAlertSrc[9]  = (PMBUS_tStatus.u8StatusFan12P0.ALL & 0xF0u) & (~mg_sP0SmbMask.u8Pmb_81);  /* 0x81 */
+  mg_au8SmbAlertSrc[10] = (PMBUS_tStatus.u8StatusFan34P0.ALL & 0xF0u) & (~mg_sP0SmbMask.u8Pmb_82);  /* 0x82 */
+
+  u8Alert = FALSE;
+  for (u8Cnt = 0U; u8Cnt < MG_SMBALERT_SRC_NUM; u8Cnt++)
+  {
+    mg_au8SmbAlertAck[u8Cnt] &= mg_au8SmbAlertSrc[u8Cnt];
+    if (0U != (mg_au8SmbAlertSrc[u8Cnt] & (uint8)(~mg_au8SmbAlertAck[u8Cnt])))
+    {
+      u8Alert = TRUE;
+    }
+  }
+
+  /* SMB asserted / de-asserted, the alert response address is answered while asserted */
+  if (FALSE != u8AlertAra)
   {
-    /* SMB de-asserted */
-    RTE_B_COM_SMBALLERT_ST = FALSE;
+    RTE_PMB_Write_u8SmbAlertAra(FALSE);
   }
+  RTE_B_COM_SMBALLERT_ST = u8Alert;
+  PMBUS_SCFG_vUpdateSmbAlertAra(u8Alert);
 }/* PMBUS_vCopyStatusData */
 
 /*******************************************************************************
@@ -1150,6 +1290,8 @@ void PMBUS_vCopyPecAndOringStatus(void)
  *******************************************************************************/
 void PMBUS_vCopyDebugData(void)
 {
+  uint8 u8Cnt;
+
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_PRI_VIN_ADC].u16Val = RTE_Pri.u1610mVVinAvg.u16Val;
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_PRI_IIN_ADC].u16Val = RTE_Pri.u161mAIinAvg.u16Val;
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_PRI_PIN_ADC].u16Val = RTE_Pri.u16100mAPinAvg.u16Val;
@@ -1178,6 +1320,11 @@ void PMBUS_vCopyDebugData(void)
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_SEC_DEBUG_0].u16Val = RTE_Sec.u16SecDebug0.u16Val;
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_SEC_DEBUG_1].u16Val = RTE_Sec.u16SecDebug1.u16Val;
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_SEC_DEBUG_2].u16Val = RTE_Sec.u16SecDebug2.u16Val;
+  mg_au8DebugRegBuf[RTE_DEBUG_ADR_SEC_CPU_LOAD].u16Val = RTE_Sec.u16SecCpuLoad.u16Val;
+  for (u8Cnt = 0U; u8Cnt < RTE_SEC_ISR_MON_NUM; u8Cnt++)
+  {
+    mg_au8DebugRegBuf[RTE_DEBUG_ADR_SEC_ISR_MON_START + u8Cnt].u16Val = RTE_Sec.au16SecIsrMon[u8Cnt].u16Val;
+  }
 
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_TEMP_OTW_STATUS].u16Val = RTE_uTempOtwStatus.ALL;
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_TEMP_OTP_STATUS].u16Val = RTE_uTempOtpStatus.ALL;
@@ -1200,6 +1347,7 @@ void PMBUS_vCopyDebugData(void)
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_COM_DEBUG_1        ].u16Val = RTE_u16ComDebug[1];
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_COM_DEBUG_2        ].u16Val = RTE_u16ComDebug[2];
   mg_au8DebugRegBuf[RTE_DEBUG_ADR_COM_DEBUG_3        ].u16Val = RTE_u16ComDebug[3];
+  mg_au8DebugRegBuf[RTE_DEBUG_ADR_COM_CPU_LOAD       ].u16Val = PMBUS_SCFG_u16ReadSchmCpuLoad();
 
 }/* PMBUS_vCopyDebugData */
 
@@ -1786,8 +1934,10 @@ void PMBUS_vSendData(void)
   WORD_VAL u16TempData;
 	uint8 u8PmbusCommand;
   uint8 u8TmpData;
+  const MG_S_SENSOR_SNAP *psSnap;
 	
 	PMBUS_Rte_Read_R_u8PMBusCmd(&u8PmbusCommand);
+  psSnap = MG_PS_SENSOR_SNAP();
 
   if (PMBUS_uSysStatu0.Bits.QUERY_REQUEST == TRUE)
   {
@@ -1812,6 +1962,13 @@ void PMBUS_vSendData(void)
       PMBUS_uSysStatu0.Bits.PAGE_PLUS_READ = 0;
     }
 
+#if MG_READ_IMAGE
+    if ((RTE_u8I2cTxLen == 0U) && (FALSE != mg_u8ReadImageSelect(u8PmbusCommand)))
+    {
+      /* Precomputed response selected, the I2C ISR streams it */
+    }
+    else
+#endif
     /*************************************************
      *   PAGE 00/01
      *************************************************/
@@ -1846,14 +2003,18 @@ void PMBUS_vSendData(void)
         }
           /*
            * Bit  7=1    Packet Error Checking is supported
-           * Bits 6:5=01 Maximum supported bus speed is 400 kHz
-           * Bit  4=0    This device does not support the SMBus Alert Response protocol
+           * Bits 6:5=10 Maximum supported bus speed is 1 MHz (01 = 400 kHz)
+           * Bit  4=1    This device supports the SMBus Alert Response protocol
            * Bits 3:1    Reserved
            * Bit  0=0    Code Redundancy can't support
            */
         case PMB_19_CAPABILITY:
         {
+#if RTE_I2C_PMBUS_FM_PLUS
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = SUPPORT_PEC_1M_ALERT;
+#else
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = SUPPORT_PEC_400K_ALERT;
+#endif
           break;
         }
 
@@ -2145,59 +2306,29 @@ void PMBUS_vSendData(void)
 
         case PMB_86_READ_EIN:
         {
-					if (PMBUS_uDataUpdStatus1.Bits.EIN_UPDTING)
-					{
-						u16TempData.u16Val = PMBUS_tData.u32PinEnergyCtr_Old.u32Val;
-						RTE_au8I2cTxBuf[0] = 6u; /* Block Counter */
-						RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
-						RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
-						RTE_au8I2cTxBuf[3] = PMBUS_tData.u8PinRolloverCount_Old; /* Rollover Counter Byte */
-						RTE_au8I2cTxBuf[4] = PMBUS_tData.u32PinSampleCount_Old.Bytes.LB; /* Sample Counter LOW Byte */
-						RTE_au8I2cTxBuf[5] = PMBUS_tData.u32PinSampleCount_Old.Bytes.HB; /* Sample Counter MID Byte */
-						RTE_au8I2cTxBuf[6] = PMBUS_tData.u32PinSampleCount_Old.Bytes.UB; /* Sample Counter HIGH Byte */
-						RTE_u8I2cTxLen = 7;
-					}
-					else
-					{
-						u16TempData.u16Val = PMBUS_tData.u32PinEnergyCtr.u32Val;
-						RTE_au8I2cTxBuf[0] = 6u; /* Block Counter */
-						RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
-						RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
-						RTE_au8I2cTxBuf[3] = PMBUS_tData.u8PinRolloverCount; /* Rollover Counter Byte */
-						RTE_au8I2cTxBuf[4] = PMBUS_tData.u32PinSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
-						RTE_au8I2cTxBuf[5] = PMBUS_tData.u32PinSampleCount.Bytes.HB; /* Sample Counter MID Byte */
-						RTE_au8I2cTxBuf[6] = PMBUS_tData.u32PinSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
-						RTE_u8I2cTxLen = 7;
-					}
+					u16TempData.u16Val = psSnap->u32PinEnergyCtr.u32Val;
+					RTE_au8I2cTxBuf[0] = 6u; /* Block Counter */
+					RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
+					RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
+					RTE_au8I2cTxBuf[3] = psSnap->u8PinRolloverCount; /* Rollover Counter Byte */
+					RTE_au8I2cTxBuf[4] = psSnap->u32PinSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
+					RTE_au8I2cTxBuf[5] = psSnap->u32PinSampleCount.Bytes.HB; /* Sample Counter MID Byte */
+					RTE_au8I2cTxBuf[6] = psSnap->u32PinSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
+					RTE_u8I2cTxLen = 7;
           break;
         }
 				
         case PMB_87_READ_EOUT:
         {
-					if (PMBUS_uDataUpdStatus1.Bits.EOUT_UPDTING)
-					{
-						u16TempData.u16Val = PMBUS_tData.u32PoutEnergyCtr_Old.u32Val;
-						RTE_au8I2cTxBuf[0] = 6u; /* Block Counter */
-						RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
-						RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
-						RTE_au8I2cTxBuf[3] = PMBUS_tData.u8PoutRolloverCount_Old; /* Rollover Counter Byte */
-						RTE_au8I2cTxBuf[4] = PMBUS_tData.u32PoutSampleCount_Old.Bytes.LB; /* Sample Counter LOW Byte */
-						RTE_au8I2cTxBuf[5] = PMBUS_tData.u32PoutSampleCount_Old.Bytes.HB; /* Sample Counter MID Byte */
-						RTE_au8I2cTxBuf[6] = PMBUS_tData.u32PoutSampleCount_Old.Bytes.UB; /* Sample Counter HIGH Byte */
-						RTE_u8I2cTxLen = 7;
-					}
-					else
-					{
-						u16TempData.u16Val = PMBUS_tData.u32PoutEnergyCtr.u32Val;
-						RTE_au8I2cTxBuf[0] = 6u; /* Block Counter*/
-						RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
-						RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
-						RTE_au8I2cTxBuf[3] = PMBUS_tData.u8PoutRolloverCount; /* Rollover Counter Byte */
-						RTE_au8I2cTxBuf[4] = PMBUS_tData.u32PoutSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
-						RTE_au8I2cTxBuf[5] = PMBUS_tData.u32PoutSampleCount.Bytes.HB; /* Sample Counter MID Byte */
-						RTE_au8I2cTxBuf[6] = PMBUS_tData.u32PoutSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
-						RTE_u8I2cTxLen = 7;
-					}
+					u16TempData.u16Val = psSnap->u32PoutEnergyCtr.u32Val;
+					RTE_au8I2cTxBuf[0] = 6u; /* Block Counter*/
+					RTE_au8I2cTxBuf[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
+					RTE_au8I2cTxBuf[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
+					RTE_au8I2cTxBuf[3] = psSnap->u8PoutRolloverCount; /* Rollover Counter Byte */
+					RTE_au8I2cTxBuf[4] = psSnap->u32PoutSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
+					RTE_au8I2cTxBuf[5] = psSnap->u32PoutSampleCount.Bytes.HB; /* Sample Counter MID Byte */
+					RTE_au8I2cTxBuf[6] = psSnap->u32PoutSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
+					RTE_u8I2cTxLen = 7;
           break;
         }
 
@@ -2210,14 +2341,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Vin_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vin_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vin_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2233,14 +2357,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Iin_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Iin_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Iin_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2249,14 +2366,7 @@ void PMBUS_vSendData(void)
 				
 				case PMB_8A_READ_VCAP:
 				{
-					if (RTE_PMB_Read_bit_VCAP_Upd())
-					{
-						u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-					}
-					else
-					{
-						u16TempData.u16Val = PMBUS_tData.u16Vcap_Linear.u16Val;
-					}
+					u16TempData.u16Val = psSnap->u16Vcap_Linear.u16Val;
 					RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 					RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					break;
@@ -2271,14 +2381,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Vout_V1_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vout_V1_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vout_V1_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 				  }
@@ -2294,14 +2397,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Iout_V1_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Iout_V1_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Iout_V1_Linear.u16Val;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           }
@@ -2310,14 +2406,7 @@ void PMBUS_vSendData(void)
 				
         case PMB_8D_READ_TEMPERATURE_1:
         {
-          if (RTE_PMB_Read_bit_Inlet_Upd())
-          {
-            u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-          }
-          else
-          {
-            u16TempData.u16Val = PMBUS_tData.u16Temperatue_1_Linear.u16Val;
-          }
+          u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           break;
@@ -2327,25 +2416,11 @@ void PMBUS_vSendData(void)
         {
 					if (RTE_PMB_Read_bit_Aux_Mode())
 					{
-            if (RTE_PMB_Read_bit_Inlet_Upd())
-            {
-              u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-            }
-            else
-            {
-              u16TempData.u16Val = PMBUS_tData.u16Temperatue_1_Linear.u16Val;
-            }
+            u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Pfc_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Temperatue_2_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Temperatue_2_Linear.u16Val;
 					}
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
@@ -2356,25 +2431,11 @@ void PMBUS_vSendData(void)
         {
 					if (RTE_PMB_Read_bit_Aux_Mode())
 					{
-            if (RTE_PMB_Read_bit_Inlet_Upd())
-            {
-              u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-            }
-            else
-            {
-              u16TempData.u16Val = PMBUS_tData.u16Temperatue_1_Linear.u16Val;
-            }
+            u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_SR_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Temperatue_3_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Temperatue_3_Linear.u16Val;
 					}
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
           RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
@@ -2390,14 +2451,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Fan_Spd_1_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16FanSpeed_1_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16FanSpeed_1_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2413,14 +2467,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Fan_Spd_2_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16FanSpeed_2_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16FanSpeed_2_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 				  }
@@ -2437,14 +2484,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Fan_Spd_3_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16FanSpeed_3_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16FanSpeed_3_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2460,14 +2500,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Fan_Spd_4_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16FanSpeed_4_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16FanSpeed_4_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2483,14 +2516,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Pout_V1_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Pout_V1_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Pout_V1_Linear.u16Val;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           }
@@ -2506,14 +2532,7 @@ void PMBUS_vSendData(void)
 					}
 					else
 					{
-						if (RTE_PMB_Read_bit_Pin_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Pin_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Pin_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2711,11 +2730,41 @@ void PMBUS_vSendData(void)
           break;
         }
 
+        case PMB_DB_MFR_READ_ALL:
+        {
+          /* Normally served from the read image, rendered here after an aux mode change */
+          if (PMBUS_uDataUpdStatus1.Bits.STATUS_78_82_UPDTING)
+          {
+            u16TempData.u16Val = PMBUS_tStatusOld.u16StatusWordP0.ALL;
+          }
+          else
+          {
+            u16TempData.u16Val = PMBUS_tStatus.u16StatusWordP0.ALL;
+          }
+          RTE_u8I2cTxLen += mg_u8ReadAllRender(u16TempData.u16Val, RTE_PMB_Read_bit_Aux_Mode(),
+                                               (uint8 *)&RTE_au8I2cTxBuf[RTE_u8I2cTxLen]);
+          break;
+        }
+
         case PMB_DC_MFR_BLACK_BOX:
         { 
-          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 252u;
-          PMBUS_SCFG_vReadMfrBlackbox((uint8 *)&RTE_au8I2cTxBuf[RTE_u8I2cTxLen]);
-          RTE_u8I2cTxLen += 252u;
+          uint8 *pu8Image;
+
+          /*
+           * The I2C ISR streams the blackbox image, the count of a
+           * PAGE_PLUS_READ goes into the free byte in front of it
+           */
+          pu8Image = PMBUS_SCFG_pu8GetMfrBlackboxImage();
+          if (RTE_u8I2cTxLen != 0U)
+          {
+            pu8Image[0] = RTE_au8I2cTxBuf[0];
+          }
+          else
+          {
+            pu8Image++;
+          }
+          RTE_pu8I2cTxData = pu8Image;
+          RTE_u8I2cTxLen += 253u;                /* block count + 252 bytes */
           break;
         }
 
@@ -2771,62 +2820,46 @@ void PMBUS_vSendData(void)
 
         case PMB_E3_READ_HOURS_USED: 
         {
-				  if (RTE_PMB_Read_bit_Hours_Upd()) 
-					{ 
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x03u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.UB;
-					}
-					else 
-					{
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x03u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32HoursUsed.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32HoursUsed.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32HoursUsed.Bytes.UB;  
-					}
+				  RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x03u;
+				  RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32HoursUsed.Bytes.LB;
+				  RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32HoursUsed.Bytes.HB;
+				  RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32HoursUsed.Bytes.UB;
           break;
         }
         
+        case PMB_E4_MFR_CMD_STATS:
+        {
+          u8ByteNum = PMBUS_SCFG_u8ReadI2cCmdStats((uint8 *)&RTE_au8I2cTxBuf[RTE_u8I2cTxLen + 1u]);
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u8ByteNum;
+          RTE_u8I2cTxLen += u8ByteNum;
+          break;
+        }
+
+        case PMB_E7_MFR_LINK_STATS:
+        {
+          u8ByteNum = PMBUS_SCFG_u8ReadUartLinkStats((uint8 *)&RTE_au8I2cTxBuf[RTE_u8I2cTxLen + 1u]);
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u8ByteNum;
+          RTE_u8I2cTxLen += u8ByteNum;
+          break;
+        }
+
         case PMB_E5_MFR_POS_TOTAL:
         {
-          if (RTE_PMB_Read_bit_POS_TOTAL_Upd())
-          {
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.UB;
-            RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.MB;
-          }
-          else
-          {
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosTotal.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosTotal.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosTotal.Bytes.UB;
-            RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosTotal.Bytes.MB;
-          }
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosTotal.Bytes.LB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosTotal.Bytes.HB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosTotal.Bytes.UB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosTotal.Bytes.MB;
           break;
         }
         
         case PMB_E6_MFR_POS_LAST:
         {
-          if (RTE_PMB_Read_bit_POS_LAST_Upd())
-          {
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.UB;
-            RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32DataCopy.Bytes.MB;
-          }
-          else
-          {
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosLast.Bytes.LB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosLast.Bytes.HB;
-						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosLast.Bytes.UB;
-            RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = PMBUS_tData.u32PosLast.Bytes.MB;
-          }
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = 0x04u;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosLast.Bytes.LB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosLast.Bytes.HB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosLast.Bytes.UB;
+          RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = psSnap->u32PosLast.Bytes.MB;
           break;
         }
         
@@ -2890,14 +2923,7 @@ void PMBUS_vSendData(void)
         {
 					if (FALSE != PMBUS_uSysStatu0.Bits.UNLOCK_DEBUG) 
 					{
-						if (RTE_PMB_Read_bit_Vout_V1_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vout_V1_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vout_V1_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 					}
@@ -2999,10 +3025,20 @@ void PMBUS_vSendData(void)
         {
           if (FALSE != PMBUS_uSysStatu0.Bits.UNLOCK_DEBUG)
           {
-            if (mg_u16DebugRegIndex.u16Val < RTE_I2C_DEB_BUF_SIZE)
+            if ((mg_u16DebugRegIndex.u16Val >= RTE_DEBUG_ADR_I2C_LAT_START) &&
+                (mg_u16DebugRegIndex.u16Val < RTE_DEBUG_ADR_I2C_LAT_END))
+            {
+              u16TempData.u16Val = PMBUS_SCFG_u16ReadI2cLatency(mg_u16DebugRegIndex.u16Val - RTE_DEBUG_ADR_I2C_LAT_START);
+            }
+            else if (mg_u16DebugRegIndex.u16Val < RTE_I2C_DEB_BUF_SIZE)
             {
               u16TempData.u16Val = mg_au8DebugRegBuf[mg_u16DebugRegIndex.u16Val].u16Val;
             }
+            else if ((mg_u16DebugRegIndex.u16Val >= RTE_DEBUG_ADR_SCHM_PROF_START) &&
+                     (mg_u16DebugRegIndex.u16Val < RTE_DEBUG_ADR_SCHM_PROF_END))
+            {
+              u16TempData.u16Val = PMBUS_SCFG_u16ReadSchmSlotProf(mg_u16DebugRegIndex.u16Val - RTE_DEBUG_ADR_SCHM_PROF_START);
+            }
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           }
@@ -3143,14 +3179,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Vout_VSB_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vout_VSB_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vout_VSB_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 				  }
@@ -3166,14 +3195,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Iout_VSB_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Iout_VSB_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Iout_VSB_Linear.u16Val;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           }
@@ -3189,14 +3211,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Pout_VSB_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Pout_VSB_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Pout_VSB_Linear.u16Val;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
             RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
           }
@@ -3268,14 +3283,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Vout_IShare_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vout_V1IShare_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vout_V1IShare_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 				  }
@@ -3334,14 +3342,7 @@ void PMBUS_vSendData(void)
           }
           else
           {
-						if (RTE_PMB_Read_bit_Vout_Sense_Upd())
-						{
-							u16TempData.u16Val = PMBUS_tData.u32DataCopy.Words.LW;
-						}
-						else
-						{
-							u16TempData.u16Val = PMBUS_tData.u16Vout_V1Sense_Linear.u16Val;
-						}
+						u16TempData.u16Val = psSnap->u16Vout_V1Sense_Linear.u16Val;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.LB;
 						RTE_au8I2cTxBuf[RTE_u8I2cTxLen++] = u16TempData.Bytes.HB;
 				  }
@@ -3908,6 +3909,18 @@ void vPMBus_HandleData(void)
           PMBUS_SCFG_vMFR_ClearBlackBox();
           break;
         }
+
+        case PMB_E4_MFR_CMD_STATS:
+        {
+          PMBUS_SCFG_vClearI2cCmdStats();
+          break;
+        }
+
+        case PMB_E7_MFR_LINK_STATS:
+        {
+          PMBUS_SCFG_vClearUartLinkStats();
+          break;
+        }
         
         case PMB_FA_MFR_FUNCTION_CTRL:
         {
@@ -4374,6 +4387,482 @@ static void mg_vClearPageAllFault()
   mg_vClearPage01Fault();
 }
 
+/********************************************************************************
+ * \brief         Copy the sensor values into the snapshot bank the I2C ISR does
+ *                not use and publish it. The ISR can not be interrupted by the
+ *                writer, so the bank it took stays unchanged until the response
+ *                is built.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vSensorSnapPublish(void)
+{
+  MG_S_SENSOR_SNAP *psSnap;
+  uint8 u8Seq;
+
+  u8Seq = mg_u8SensorSeq + 1U;
+  psSnap = &mg_asSensorSnap[u8Seq & 1U];
+
+  psSnap->u16Vin_Linear           = PMBUS_tData.u16Vin_Linear;
+  psSnap->u16Iin_Linear           = PMBUS_tData.u16Iin_Linear;
+  psSnap->u16Pin_Linear           = PMBUS_tData.u16Pin_Linear;
+  psSnap->u16Vcap_Linear          = PMBUS_tData.u16Vcap_Linear;
+  psSnap->u16Vout_V1_Linear       = PMBUS_tData.u16Vout_V1_Linear;
+  psSnap->u16Iout_V1_Linear       = PMBUS_tData.u16Iout_V1_Linear;
+  psSnap->u16Pout_V1_Linear       = PMBUS_tData.u16Pout_V1_Linear;
+  psSnap->u16Vout_VSB_Linear      = PMBUS_tData.u16Vout_VSB_Linear;
+  psSnap->u16Iout_VSB_Linear      = PMBUS_tData.u16Iout_VSB_Linear;
+  psSnap->u16Pout_VSB_Linear      = PMBUS_tData.u16Pout_VSB_Linear;
+  psSnap->u16Vout_V1Sense_Linear  = PMBUS_tData.u16Vout_V1Sense_Linear;
+  psSnap->u16Vout_V1IShare_Linear = PMBUS_tData.u16Vout_V1IShare_Linear;
+  psSnap->u16Temperatue_1_Linear  = PMBUS_tData.u16Temperatue_1_Linear;
+  psSnap->u16Temperatue_2_Linear  = PMBUS_tData.u16Temperatue_2_Linear;
+  psSnap->u16Temperatue_3_Linear  = PMBUS_tData.u16Temperatue_3_Linear;
+  psSnap->u16FanSpeed_1_Linear    = PMBUS_tData.u16FanSpeed_1_Linear;
+  psSnap->u16FanSpeed_2_Linear    = PMBUS_tData.u16FanSpeed_2_Linear;
+  psSnap->u16FanSpeed_3_Linear    = PMBUS_tData.u16FanSpeed_3_Linear;
+  psSnap->u16FanSpeed_4_Linear    = PMBUS_tData.u16FanSpeed_4_Linear;
+  psSnap->u32HoursUsed            = PMBUS_tData.u32HoursUsed;
+  psSnap->u32PosTotal             = PMBUS_tData.u32PosTotal;
+  psSnap->u32PosLast              = PMBUS_tData.u32PosLast;
+  psSnap->u32PinEnergyCtr         = PMBUS_tData.u32PinEnergyCtr;
+  psSnap->u32PinSampleCount       = PMBUS_tData.u32PinSampleCount;
+  psSnap->u8PinRolloverCount      = PMBUS_tData.u8PinRolloverCount;
+  psSnap->u32PoutEnergyCtr        = PMBUS_tData.u32PoutEnergyCtr;
+  psSnap->u32PoutSampleCount      = PMBUS_tData.u32PoutSampleCount;
+  psSnap->u8PoutRolloverCount     = PMBUS_tData.u8PoutRolloverCount;
+
+  /* The new bank is complete before the sequence points to it */
+  __DMB();
+  mg_u8SensorSeq = u8Seq;
+}
+
+#if MG_READ_IMAGE
+/********************************************************************************
+ * \brief         Build the command index of the read images and render them
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vReadImageInit(void)
+{
+  uint8 u8Page;
+  uint8 u8Cmd;
+  uint8 u8Idx;
+  uint8 u8Off;
+
+  for (u8Page = 0U; u8Page < MG_READ_IMAGE_PAGE_NUM; u8Page++)
+  {
+    for (u8Cmd = 0U; u8Cmd < MG_READ_IMAGE_CMD_NUM; u8Cmd++)
+    {
+      mg_au8ReadImageIdx[u8Page][u8Cmd] = MG_READ_IMAGE_NONE;
+    }
+  }
+
+  mg_u8ReadImageAllIdx = MG_READ_IMAGE_NONE;
+  u8Off = 0U;
+
+  for (u8Idx = 0U; u8Idx < MG_READ_IMAGE_NUM; u8Idx++)
+  {
+    u8Page = mg_asReadImageCfg[u8Idx].u8Page;
+    u8Cmd = mg_asReadImageCfg[u8Idx].u8Cmd;
+    if (u8Cmd == PMB_DB_MFR_READ_ALL)
+    {
+      mg_u8ReadImageAllIdx = u8Idx;
+    }
+    else
+    {
+      mg_au8ReadImageIdx[u8Page][u8Cmd - MG_READ_IMAGE_CMD_FIRST] = u8Idx;
+    }
+    mg_au8ReadImageOff[u8Idx] = u8Off;
+    u8Off += mg_asReadImageCfg[u8Idx].u8Size;
+  }
+
+  mg_vReadImageUpdate();
+}
+
+/********************************************************************************
+ * \brief         Render all read images into the bank the I2C ISR does not use
+ *                and switch over. A read in progress keeps streaming from the
+ *                old bank, it is only rendered again one update later.
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ *******************************************************************************/
+static void mg_vReadImageUpdate(void)
+{
+  MG_S_READ_IMAGE_BANK *psBank;
+  uint8 *pu8Data;
+  uint8 u8Bank;
+  uint8 u8Idx;
+#if MG_READ_IMAGE_PEC
+  uint8 u8Cnt;
+  uint8 u8Pec;
+#endif
+
+  u8Bank = mg_u8ReadImageBank ^ 1U;
+  psBank = &mg_asReadImage[u8Bank];
+  psBank->u8AuxMode = RTE_PMB_Read_bit_Aux_Mode();
+
+  for (u8Idx = 0U; u8Idx < MG_READ_IMAGE_NUM; u8Idx++)
+  {
+    pu8Data = &psBank->au8Data[mg_au8ReadImageOff[u8Idx]];
+    if (u8Idx == mg_u8ReadImageAllIdx)
+    {
+      /* Main loop as PMBUS_vCopyStatusData, STATUS_WORD is never half updated here */
+      psBank->au8Len[u8Idx] = mg_u8ReadAllRender(PMBUS_tStatus.u16StatusWordP0.ALL,
+                                                 psBank->u8AuxMode,
+                                                 pu8Data);
+    }
+    else
+    {
+      psBank->au8Len[u8Idx] = mg_u8ReadImageRender(mg_asReadImageCfg[u8Idx].u8Page,
+                                                   mg_asReadImageCfg[u8Idx].u8Cmd,
+                                                   psBank->u8AuxMode,
+                                                   pu8Data);
+    }
+#if MG_READ_IMAGE_PEC
+    u8Pec = PMBUS_SCFG_u8GetReadPecSeed(mg_asReadImageCfg[u8Idx].u8Cmd);
+    psBank->au8PecSeed[u8Idx] = u8Pec;
+    for (u8Cnt = 0U; u8Cnt < psBank->au8Len[u8Idx]; u8Cnt++)
+    {
+      u8Pec = PMBUS_SCFG_u8GetCrc8(u8Pec, pu8Data[u8Cnt]);
+    }
+    psBank->au8Pec[u8Idx] = u8Pec;
+#endif
+  }
+
+  mg_u8ReadImageBank = u8Bank;
+}
+#endif
+
+/********************************************************************************
+ * \brief         Render the read response of one command from the published
+ *                sensor snapshot, same data as PMBUS_vSendData sends
+ *
+ * \param[in]     - u8Page, u8Cmd, u8AuxMode
+ * \param[in,out] -
+ * \param[out]    - pu8Data: response bytes without PEC
+ *
+ * \return        - response length, 0 = command not cached
+ *
+ *******************************************************************************/
+static uint8 mg_u8ReadImageRender(uint8 u8Page, uint8 u8Cmd, uint8 u8AuxMode, uint8 *pu8Data)
+{
+  const MG_S_SENSOR_SNAP *psSnap = MG_PS_SENSOR_SNAP();
+  WORD_VAL u16TempData;
+  uint8 u8Len = 2U;
+
+  u16TempData.u16Val = 0;
+
+  switch (u8Cmd)
+  {
+    case PMB_86_READ_EIN:
+    {
+      u16TempData.u16Val = psSnap->u32PinEnergyCtr.u32Val;
+      pu8Data[0] = 6u; /* Block Counter */
+      pu8Data[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
+      pu8Data[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
+      pu8Data[3] = psSnap->u8PinRolloverCount; /* Rollover Counter Byte */
+      pu8Data[4] = psSnap->u32PinSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
+      pu8Data[5] = psSnap->u32PinSampleCount.Bytes.HB; /* Sample Counter MID Byte */
+      pu8Data[6] = psSnap->u32PinSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
+      u8Len = 7U;
+      break;
+    }
+
+    case PMB_87_READ_EOUT:
+    {
+      u16TempData.u16Val = psSnap->u32PoutEnergyCtr.u32Val;
+      pu8Data[0] = 6u; /* Block Counter */
+      pu8Data[1] = u16TempData.Bytes.LB; /* Energy Counter Low Byte */
+      pu8Data[2] = u16TempData.Bytes.HB; /* Energy Counter High Byte */
+      pu8Data[3] = psSnap->u8PoutRolloverCount; /* Rollover Counter Byte */
+      pu8Data[4] = psSnap->u32PoutSampleCount.Bytes.LB; /* Sample Counter LOW Byte */
+      pu8Data[5] = psSnap->u32PoutSampleCount.Bytes.HB; /* Sample Counter MID Byte */
+      pu8Data[6] = psSnap->u32PoutSampleCount.Bytes.UB; /* Sample Counter HIGH Byte */
+      u8Len = 7U;
+      break;
+    }
+
+    case PMB_88_READ_VIN:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16Vin_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_89_READ_IIN:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16Iin_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_8A_READ_VCAP:
+    {
+      u16TempData.u16Val = psSnap->u16Vcap_Linear.u16Val;
+      break;
+    }
+
+    case PMB_8B_READ_VOUT:
+    {
+      if (!u8AuxMode)
+      {
+        if (u8Page == MG_PAGE_00)
+        {
+          u16TempData.u16Val = psSnap->u16Vout_V1_Linear.u16Val;
+        }
+        else
+        {
+          u16TempData.u16Val = psSnap->u16Vout_VSB_Linear.u16Val;
+        }
+      }
+      break;
+    }
+
+    case PMB_8C_READ_IOUT:
+    {
+      if (!u8AuxMode)
+      {
+        if (u8Page == MG_PAGE_00)
+        {
+          u16TempData.u16Val = psSnap->u16Iout_V1_Linear.u16Val;
+        }
+        else
+        {
+          u16TempData.u16Val = psSnap->u16Iout_VSB_Linear.u16Val;
+        }
+      }
+      break;
+    }
+
+    case PMB_8D_READ_TEMPERATURE_1:
+    {
+      u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
+      break;
+    }
+
+    case PMB_8E_READ_TEMPERATURE_2:
+    {
+      if (u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
+      }
+      else
+      {
+        u16TempData.u16Val = psSnap->u16Temperatue_2_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_8F_READ_TEMPERATURE_3:
+    {
+      if (u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16Temperatue_1_Linear.u16Val;
+      }
+      else
+      {
+        u16TempData.u16Val = psSnap->u16Temperatue_3_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_90_READ_FAN_SPEED_1:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16FanSpeed_1_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_91_READ_FAN_SPEED_2:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16FanSpeed_2_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_92_READ_FAN_SPEED_3:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16FanSpeed_3_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_93_READ_FAN_SPEED_4:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16FanSpeed_4_Linear.u16Val;
+      }
+      break;
+    }
+
+    case PMB_96_READ_POUT:
+    {
+      if (!u8AuxMode)
+      {
+        if (u8Page == MG_PAGE_00)
+        {
+          u16TempData.u16Val = psSnap->u16Pout_V1_Linear.u16Val;
+        }
+        else
+        {
+          u16TempData.u16Val = psSnap->u16Pout_VSB_Linear.u16Val;
+        }
+      }
+      break;
+    }
+
+    case PMB_97_READ_PIN:
+    {
+      if (!u8AuxMode)
+      {
+        u16TempData.u16Val = psSnap->u16Pin_Linear.u16Val;
+      }
+      break;
+    }
+
+    default:
+    {
+      /* Served by PMBUS_vSendData */
+      u8Len = 0U;
+      break;
+    }
+  }
+
+  if (u8Len == 2U)
+  {
+    pu8Data[0] = u16TempData.Bytes.LB;
+    pu8Data[1] = u16TempData.Bytes.HB;
+  }
+
+  return u8Len;
+}
+
+/********************************************************************************
+ * \brief         Render the MFR_READ_ALL record, the words are the responses of
+ *                the single read commands on page 0
+ *
+ * \param[in]     - u16StatusWord, u8AuxMode
+ * \param[in,out] -
+ * \param[out]    - pu8Data: record with block count, without PEC
+ *
+ * \return        - record length, MG_READ_ALL_SIZE
+ *
+ *******************************************************************************/
+static uint8 mg_u8ReadAllRender(uint16 u16StatusWord, uint8 u8AuxMode, uint8 *pu8Data)
+{
+  uint8 u8Idx;
+  uint8 u8Len;
+  uint16 u16Load;
+
+  pu8Data[0] = MG_READ_ALL_SIZE - 1U;                 /* Block Counter */
+  pu8Data[1] = MG_READ_ALL_VERSION;
+  pu8Data[2] = mg_u8SensorSeq;                        /* Changes with every new sample */
+  pu8Data[3] = (uint8)u16StatusWord;
+  pu8Data[4] = (uint8)(u16StatusWord >> 8);
+  u8Len = 5U;
+
+  for (u8Idx = 0U; u8Idx < DIM(mg_au8ReadAllCmd); u8Idx++)
+  {
+    u8Len += mg_u8ReadImageRender(MG_PAGE_00, mg_au8ReadAllCmd[u8Idx], u8AuxMode, &pu8Data[u8Len]);
+  }
+
+  /* Version 2: CPU load of both MCUs, as in the debug registers */
+  u16Load = PMBUS_SCFG_u16ReadSchmCpuLoad();
+  pu8Data[u8Len++] = (uint8)u16Load;
+  pu8Data[u8Len++] = (uint8)(u16Load >> 8);
+  u16Load = RTE_Sec.u16SecCpuLoad.u16Val;
+  pu8Data[u8Len++] = (uint8)u16Load;
+  pu8Data[u8Len++] = (uint8)(u16Load >> 8);
+
+  return u8Len;
+}
+
+#if MG_READ_IMAGE
+/********************************************************************************
+ * \brief         Select the read image of the command on the current page as
+ *                I2C transmit data. Called by PMBUS_vSendData in the I2C ISR.
+ *
+ * \param[in]     - u8Cmd
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        - TRUE = image selected, FALSE = render by the command switch
+ *
+ *******************************************************************************/
+static uint8 mg_u8ReadImageSelect(uint8 u8Cmd)
+{
+  const MG_S_READ_IMAGE_BANK *psBank;
+  uint8 u8Idx = MG_READ_IMAGE_NONE;
+  uint8 u8Selected = FALSE;
+
+  if ((mg_u8Page < MG_READ_IMAGE_PAGE_NUM)
+      && (u8Cmd >= MG_READ_IMAGE_CMD_FIRST)
+      && (u8Cmd <= MG_READ_IMAGE_CMD_LAST))
+  {
+    u8Idx = mg_au8ReadImageIdx[mg_u8Page][u8Cmd - MG_READ_IMAGE_CMD_FIRST];
+  }
+  else if ((mg_u8Page == MG_PAGE_00) && (u8Cmd == PMB_DB_MFR_READ_ALL))
+  {
+    u8Idx = mg_u8ReadImageAllIdx;
+  }
+
+  if (u8Idx != MG_READ_IMAGE_NONE)
+  {
+    psBank = &mg_asReadImage[mg_u8ReadImageBank];
+
+    /* Aux mode changed since the last update: the switch knows better */
+    if ((psBank->au8Len[u8Idx] != 0U)
+        && (psBank->u8AuxMode == RTE_PMB_Read_bit_Aux_Mode()))
+    {
+      RTE_pu8I2cTxData = &psBank->au8Data[mg_au8ReadImageOff[u8Idx]];
+      RTE_u8I2cTxLen = psBank->au8Len[u8Idx];
+      u8Selected = TRUE;
+
+#if MG_READ_IMAGE_PEC
+      /*
+       * Frame so far as rendered for (plain read, same address): take the
+       * precomputed PEC, otherwise the I2C ISR adds up the data bytes
+       */
+      if ((RTE_bPEC_Enable) && (RTE_u8I2cPEC == psBank->au8PecSeed[u8Idx]))
+      {
+        RTE_u8I2cPEC = psBank->au8Pec[u8Idx];
+        RTE_I2C_TX_PEC_RDY = TRUE;
+      }
+#endif
+    }
+  }
+
+  return u8Selected;
+}
+#endif
+
 #if 0
 /********************************************************************************
  * \brief         Convert linear data format to normal value which multiply 128
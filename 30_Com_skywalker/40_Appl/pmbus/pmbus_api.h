@@ -74,6 +74,17 @@ void vPMBus_HandleData(void);
 
 uint8 PMBUS_u8GetBootMcuId(void);
 
+/*******************************************************************************
+ * Function:        PMBUS_u8IsThreadCmd
+ *
+ * Parameters:      -
+ * Returned value:  TRUE: the latched write frame is handled by the polling task
+ *
+ * Description:     Commands not handled in the deferred I2C interrupt
+ *
+ ******************************************************************************/
+uint8 PMBUS_u8IsThreadCmd(void);
+
 void PMBUS_vClearAllFault(void);
 
 void PMBUS_vClearPowerOffFault(void);
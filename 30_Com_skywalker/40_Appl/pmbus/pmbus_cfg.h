@@ -188,8 +188,10 @@
 
 #define PMBUS_ADR_SEC_AVAILABLE_POWER   0xD7  /* Add by Hulk 20180515 */
 
+#define PMB_E4_MFR_CMD_STATS            0xE4  /* I2C traffic per command code, any write clears */
 #define PMB_E5_MFR_POS_TOTAL            0xE5  /* the Total Power On Seconds */
 #define PMB_E6_MFR_POS_LAST             0xE6  /* the last total Power On Seconds */
+#define PMB_E7_MFR_LINK_STATS           0xE7  /* Inter-MCU status frames per UART, any write clears */
 #define PMBUS_ADR_ADJUST_VSB_VOL_GAIN   0xE9  /* No change */
 #define PMBUS_ADR_ADJUST_V1_VOL_GAIN    0xEA  /* No change */
 #define PMBUS_ADR_ADJUST_V1_CUR_GAIN    0xEB  /* No change */
@@ -200,6 +202,7 @@
 /*
  * Non-Standard PMBus commands
  */
+#define PMB_DB_MFR_READ_ALL             0xDB  /* Telemetry record of page 0 and the CPU loads, one block read */
 #define PMB_DC_MFR_BLACK_BOX            0xDC
 #define PMB_DD_MFR_REAL_TIME_BLACK_BOX  0xDD
 #define PMB_DE_MFR_SYSTEM_BLCAKBOX      0xDE
@@ -331,6 +334,11 @@
 #define SUPPORT_400K_ALERT           0x30	   /* Support 400Kbps?no PEC, with ALERT#  */
 #define SUPPORT_PEC_400K_ALERT       0xB0	   /* Support 400Kbps?PEC? with ALERT#  */
 
+#define SUPPORT_1M                   0x40	   /* Support 1Mbps?no PEC, no ALERT#	  */
+#define SUPPORT_PEC_1M               0xC0	   /* Support 1Mbps?PEC?no ALERT#  */
+#define SUPPORT_1M_ALERT             0x50	   /* Support 1Mbps?no PEC, with ALERT#  */
+#define SUPPORT_PEC_1M_ALERT         0xD0	   /* Support 1Mbps?PEC? with ALERT#  */
+
 #define FAN1_NOT_INST                0x00      /* Fan1 is not installed, default as duty control fan speed, 1 pulse per revolution  */
 #define FAN1_INST_DUTY_CTRL_1_PULSE  0x80      /* Fan1 is installed, Using duty control fan speed, 1 pulse per revolution  */
 #define FAN1_INST_DUTY_CTRL_2_PULSE  0x90      /* Fan1 is installed, Using duty control fan speed, 2 pulse per revolution  */
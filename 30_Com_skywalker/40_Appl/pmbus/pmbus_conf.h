@@ -60,6 +60,7 @@
 #define RTE_DEBUG_ADR_SEC_DEBUG_0        0x1b
 #define RTE_DEBUG_ADR_SEC_DEBUG_1        0x1c
 #define RTE_DEBUG_ADR_SEC_DEBUG_2        0x1d
+#define RTE_DEBUG_ADR_SEC_CPU_LOAD       0x1e
 
 #define RTE_DEBUG_ADR_TEMP_OTW_STATUS      0x20
 #define RTE_DEBUG_ADR_TEMP_OTP_STATUS      0x21
@@ -71,6 +72,9 @@
 #define RTE_DEBUG_ADR_COM_STATUS_01        0x27
 #define RTE_DEBUG_ADR_COM_STATUS_02        0x28
 
+/* Secondary ISR timing monitor, RTE_SEC_ISR_MON_NUM words */
+#define RTE_DEBUG_ADR_SEC_ISR_MON_START    0x30
+
 #define RTE_DEBUG_ADR_V_VSB_INT_AVG        0x50
 #define RTE_DEBUG_ADR_V_VSB_EXT_AVG        0x51
 #define RTE_DEBUG_ADR_I_VSB_AVG            0x52
@@ -82,8 +86,47 @@
 #define RTE_DEBUG_ADR_COM_DEBUG_1          0x58
 #define RTE_DEBUG_ADR_COM_DEBUG_2          0x59
 #define RTE_DEBUG_ADR_COM_DEBUG_3          0x5A
+#define RTE_DEBUG_ADR_COM_CPU_LOAD         0x5B
+
+/* Scheduler slot profiler, SCHM_E_PROF_COUNT words per slot, read directly from SCHM */
+#define RTE_DEBUG_ADR_SCHM_PROF_START      0x80
+#define RTE_DEBUG_ADR_SCHM_PROF_END        (RTE_DEBUG_ADR_SCHM_PROF_START + (SCHM_SLOT_NUM * SCHM_E_PROF_COUNT))
+
+/*
+ * PMBus write frame latency and I2C interrupt run time, I2CPRT_E_LAT_COUNT words
+ * read directly from I2CPRT. Inside the free words of the 8 bit debug index, the
+ * slot profiler takes all of 0x80 .. 0xFF.
+ */
+#define RTE_DEBUG_ADR_I2C_LAT_START        0x70
+#define RTE_DEBUG_ADR_I2C_LAT_END          (RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_COUNT)
+
+/* Precomputed read responses of the telemetry commands, selected by the I2C ISR */
+#define MG_READ_IMAGE                      1       /* 1 = Serve READ_EIN .. READ_PIN from images */
+#define MG_READ_IMAGE_CMD_FIRST            PMB_86_READ_EIN
+#define MG_READ_IMAGE_CMD_LAST             PMB_97_READ_PIN
+#define MG_READ_IMAGE_CMD_NUM              (MG_READ_IMAGE_CMD_LAST - MG_READ_IMAGE_CMD_FIRST + 1u)
+#define MG_READ_IMAGE_NUM                  20u     /* Entries of mg_asReadImageCfg */
+#define MG_READ_IMAGE_PAGE_NUM             2u      /* Page 0 and 1 */
+#define MG_READ_IMAGE_DATA_SIZE            79u     /* Sum of u8Size in mg_asReadImageCfg */
+#define MG_READ_IMAGE_NONE                 0xFFu
+#define MG_READ_IMAGE_PEC                  1       /* 1 = Precompute the PEC of the images */
+
+/*
+ * MFR_READ_ALL record: block count, version, sensor sample sequence,
+ * STATUS_WORD, then READ_VIN, IIN, VOUT, IOUT, POUT, PIN, TEMPERATURE_1..3,
+ * FAN_SPEED_1..2 of page 0. All words low byte first, same data as the single
+ * reads. A new version only appends words.
+ * Version 2: CPU load of the Com MCU and of the secondary MCU, 0.1 % steps.
+ */
+#define MG_READ_ALL_VERSION                0x02u
+#define MG_READ_ALL_SIZE                   31u     /* Block count + 30 bytes */
+
+/* SMBALERT# sources: STATUS_VOUT/IOUT of both pages, INPUT, TEMPERATURE, CML, OTHER, MFR, FANS_1_2, FANS_3_4 */
+#define MG_SMBALERT_SRC_NUM                11u
 
 #define RTE_PMB_Read_u8PecErrCmd()         (RTE_u8I2cPECErrCmd)
+#define RTE_PMB_Read_u8SmbAlertAra()       (RTE_u8SmbAlertAra)
+#define RTE_PMB_Write_u8SmbAlertAra(u8Val) (RTE_u8SmbAlertAra = (u8Val))
 #define RTE_PMB_Write_u8PecErrCmd(u8Val)   (RTE_u8I2cPECErrCmd = (u8Val))
 
 
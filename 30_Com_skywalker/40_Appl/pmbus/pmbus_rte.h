@@ -119,84 +119,12 @@
 #define RTE_PMB_Read_bit_Fault_Sim_En()           (PMBUS_uEepromEnable.ENABLE)
 #define RTE_PMB_Write_bit_Fault_Sim_En(u8Val)     (PMBUS_uEepromEnable.ENABLE = (u8Val))
 
-#define RTE_PMB_Read_bit_Vin_Upd()                (PMBUS_uDataUpdStatus.Bits.VIN_UPDTING)
-#define RTE_PMB_Write_bit_Vin_Upd(u8Val)          (PMBUS_uDataUpdStatus.Bits.VIN_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Iin_Upd()                (PMBUS_uDataUpdStatus.Bits.IIN_UPDTING)
-#define RTE_PMB_Write_bit_Iin_Upd(u8Val)          (PMBUS_uDataUpdStatus.Bits.IIN_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Pin_Upd()                (PMBUS_uDataUpdStatus.Bits.PIN_UPDTING)
-#define RTE_PMB_Write_bit_Pin_Upd(u8Val)          (PMBUS_uDataUpdStatus.Bits.PIN_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Vout_V1_Upd()            (PMBUS_uDataUpdStatus.Bits.VOUT_V1_UPDTING)
-#define RTE_PMB_Write_bit_Vout_V1_Upd(u8Val)      (PMBUS_uDataUpdStatus.Bits.VOUT_V1_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Vout_IShare_Upd()            (PMBUS_uDataUpdStatus1.Bits.VOUT_V1_ISHARE_UPDTING)
-#define RTE_PMB_Write_bit_Vout_IShare_Upd(u8Val)      (PMBUS_uDataUpdStatus1.Bits.VOUT_V1_ISHARE_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Vout_Sense_Upd()            (PMBUS_uDataUpdStatus1.Bits.VOUT_V1_SENSE_UPDTING)
-#define RTE_PMB_Write_bit_Vout_Sense_Upd(u8Val)      (PMBUS_uDataUpdStatus1.Bits.VOUT_V1_SENSE_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Iout_V1_Upd()            (PMBUS_uDataUpdStatus.Bits.IOUT_V1_UPDTING)
-#define RTE_PMB_Write_bit_Iout_V1_Upd(u8Val)      (PMBUS_uDataUpdStatus.Bits.IOUT_V1_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Pout_V1_Upd()            (PMBUS_uDataUpdStatus.Bits.POUT_V1_UPDTING)
-#define RTE_PMB_Write_bit_Pout_V1_Upd(u8Val)      (PMBUS_uDataUpdStatus.Bits.POUT_V1_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Inlet_Upd()              (PMBUS_uDataUpdStatus.Bits.TEMP_INLET_UPDTING)
-#define RTE_PMB_Write_bit_Inlet_Upd(u8Val)        (PMBUS_uDataUpdStatus.Bits.TEMP_INLET_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_SR_Upd()                 (PMBUS_uDataUpdStatus.Bits.TEMP_SR_UPDTING)
-#define RTE_PMB_Write_bit_SR_Upd(u8Val)           (PMBUS_uDataUpdStatus.Bits.TEMP_SR_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Pfc_Upd()                (PMBUS_uDataUpdStatus.Bits.TEMP_PFC_UPDTING)
-#define RTE_PMB_Write_bit_Pfc_Upd(u8Val)          (PMBUS_uDataUpdStatus.Bits.TEMP_PFC_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Hours_Upd()              (PMBUS_uDataUpdStatus.Bits.HOURS_USED_UPDTING)
-#define RTE_PMB_Write_bit_Hours_Upd(u8Val)        (PMBUS_uDataUpdStatus.Bits.HOURS_USED_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Fan_Spd_1_Upd()          (PMBUS_uDataUpdStatus.Bits.FAN_SPD_1_UPDTING)
-#define RTE_PMB_Write_bit_Fan_Spd_1_Upd(u8Val)    (PMBUS_uDataUpdStatus.Bits.FAN_SPD_1_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Fan_Spd_2_Upd()          (PMBUS_uDataUpdStatus.Bits.FAN_SPD_2_UPDTING)
-#define RTE_PMB_Write_bit_Fan_Spd_2_Upd(u8Val)    (PMBUS_uDataUpdStatus.Bits.FAN_SPD_2_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Fan_Spd_3_Upd()          (PMBUS_uDataUpdStatus.Bits.FAN_SPD_3_UPDTING)
-#define RTE_PMB_Write_bit_Fan_Spd_3_Upd(u8Val)    (PMBUS_uDataUpdStatus.Bits.FAN_SPD_3_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Fan_Spd_4_Upd()          (PMBUS_uDataUpdStatus.Bits.FAN_SPD_4_UPDTING)
-#define RTE_PMB_Write_bit_Fan_Spd_4_Upd(u8Val)    (PMBUS_uDataUpdStatus.Bits.FAN_SPD_4_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Vout_VSB_Upd()           (PMBUS_uDataUpdStatus.Bits.VOUT_VSB_UPDTING)
-#define RTE_PMB_Write_bit_Vout_VSB_Upd(u8Val)     (PMBUS_uDataUpdStatus.Bits.VOUT_VSB_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Iout_VSB_Upd()           (PMBUS_uDataUpdStatus.Bits.IOUT_VSB_UPDTING)
-#define RTE_PMB_Write_bit_Iout_VSB_Upd(u8Val)     (PMBUS_uDataUpdStatus.Bits.IOUT_VSB_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Pout_VSB_Upd()           (PMBUS_uDataUpdStatus1.Bits.POUT_VSB_UPDTING)
-#define RTE_PMB_Write_bit_Pout_VSB_Upd(u8Val)     (PMBUS_uDataUpdStatus1.Bits.POUT_VSB_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Ein_Upd()                (PMBUS_uDataUpdStatus1.Bits.EIN_UPDTING)
-#define RTE_PMB_Write_bit_Ein_Upd(u8Val)          (PMBUS_uDataUpdStatus1.Bits.EIN_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_Eout_Upd()               (PMBUS_uDataUpdStatus1.Bits.EOUT_UPDTING)
-#define RTE_PMB_Write_bit_Eout_Upd(u8Val)         (PMBUS_uDataUpdStatus1.Bits.EOUT_UPDTING = (u8Val))
-
 #define RTE_PMB_Read_bit_Status_Upd()             (PMBUS_uDataUpdStatus1.Bits.STATUS_78_82_UPDTING)
 #define RTE_PMB_Write_bit_Status_Upd(u8Val)       (PMBUS_uDataUpdStatus1.Bits.STATUS_78_82_UPDTING = (u8Val))
 
 //#define RTE_PMB_Read_bit_V1_VI_OUT_Upd()          (PMBUS_uDataUpdStatus1.Bits.FALT_UPDT_V1_VI_OUT)
 //#define RTE_PMB_Write_bit_V1_VI_OUT_Upd(u8Val)    (PMBUS_uDataUpdStatus1.Bits.FALT_UPDT_V1_VI_OUT = (u8Val))
 
-#define RTE_PMB_Read_bit_VCAP_Upd()               (PMBUS_uDataUpdStatus1.Bits.VCAP_UPDTING)
-#define RTE_PMB_Write_bit_VCAP_Upd(u8Val)         (PMBUS_uDataUpdStatus1.Bits.VCAP_UPDTING = (u8Val))
-
-#define RTE_PMB_Read_bit_POS_TOTAL_Upd()          (PMBUS_uDataUpdStatus1.Bits.MFR_POS_TOTAL)
-#define RTE_PMB_Write_bit_POS_TOTAL_Upd(u8Val)    (PMBUS_uDataUpdStatus1.Bits.MFR_POS_TOTAL = (u8Val))
-
-#define RTE_PMB_Read_bit_POS_LAST_Upd()           (PMBUS_uDataUpdStatus1.Bits.MFR_POS_LAST)
-#define RTE_PMB_Write_bit_POS_LAST_Upd(u8Val)     (PMBUS_uDataUpdStatus1.Bits.MFR_POS_LAST = (u8Val))
-
 
 #define RTE_PMBUS_Read_bit_Time_Clear_Enable()           (PMBUS_uSysStatu1.Bits.TIME_CLEAR_ENABLE) 
 #define RTE_PMBUS_Write_bit_Time_Clear_Enable(u8Data)    (PMBUS_uSysStatu1.Bits.TIME_CLEAR_ENABLE = (u8Data))
@@ -292,9 +220,6 @@
 #define RTE_PMB_Read_u32Hours_Used()              (PMBUS_tData.u32HoursUsed.u32Val)
 #define RTE_PMB_Write_u32Hours_Used(u32Data)      (PMBUS_tData.u32HoursUsed.u32Val = (u32Data))
 
-#define RTE_PMB_Read_u32DataCopy()                (PMBUS_tData.u32DataCopy.u32Val)
-#define RTE_PMB_Write_u32DataCopy(u32Data)        (PMBUS_tData.u32DataCopy.u32Val = (u32Data))
-
 #define RTE_PMB_Read_u16Vcap_Linear()             (PMBUS_tData.u16Vcap_Linear.u16Val)
 #define RTE_PMB_Write_u16Vcap_Linear(u16Data)     (PMBUS_tData.u16Vcap_Linear.u16Val = (u16Data))
 
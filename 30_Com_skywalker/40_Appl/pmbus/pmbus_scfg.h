@@ -27,6 +27,7 @@
 
 #include "i2cprt_cfg.h"
 #include "i2cprt_api.h"
+#include "crc_api.h"
 #include "flash_api.h"
 #include "global.h"
 #include "uartprt_api.h"
@@ -38,6 +39,7 @@
 #include "cali_api.h"
 #include "fanctrl_api.h"
 #include "blabox_api.h"
+#include "schm_api.h"
 #include "tempctrl_cfg.h"
 #include "tempctrl_api.h"
 		
@@ -47,6 +49,16 @@ SINLINE void PMBUS_SCFG_vSetBlockWrState(void)
 	I2CPRT_vSetI2cState(I2CPRT_CFG_E_I2C_BLOCK_WRITE);
 }
 
+SINLINE uint8 PMBUS_SCFG_u8GetReadPecSeed(uint8 u8Cmd)
+{
+	return I2CPRT_u8GetReadPecSeed(u8Cmd);
+}
+
+SINLINE uint8 PMBUS_SCFG_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
+{
+	return CRC_u8GetCrc8(u8InCrc, u8InData);
+}
+
 SINLINE uint32 PMBUS_SCFG_u32ReadWordFlash(uint32 u32Addr)
 {
 	return FLASH_u32ReadWordFlash(u32Addr);
@@ -166,6 +178,46 @@ SINLINE uint16 PMBUS_SCFG_u16ReadFanCtrlDuty(uint8 u8Index)
   return FANCTRL_u16ReadFanCtrlDuty(u8Index);
 }
 
+SINLINE uint16 PMBUS_SCFG_u16ReadSchmSlotProf(uint16 u16Index)
+{
+  return SCHM_u16GetSlotProf((uint8)(u16Index / SCHM_E_PROF_COUNT), (SCHM_E_PROF)(u16Index % SCHM_E_PROF_COUNT));
+}
+
+SINLINE uint16 PMBUS_SCFG_u16ReadI2cLatency(uint16 u16Index)
+{
+  return I2CPRT_u16GetLatency((I2CPRT_E_LAT)u16Index);
+}
+
+SINLINE uint8 PMBUS_SCFG_u8ReadI2cCmdStats(uint8 *pu8Data)
+{
+  return I2CPRT_u8GetCmdStats(pu8Data);
+}
+
+SINLINE void PMBUS_SCFG_vClearI2cCmdStats(void)
+{
+  I2CPRT_vClearCmdStats();
+}
+
+SINLINE uint8 PMBUS_SCFG_u8ReadUartLinkStats(uint8 *pu8Data)
+{
+  return UARTPRT_u8GetLinkStats(pu8Data);
+}
+
+SINLINE void PMBUS_SCFG_vClearUartLinkStats(void)
+{
+  UARTPRT_vClearLinkStats();
+}
+
+SINLINE void PMBUS_SCFG_vUpdateSmbAlertAra(uint8 u8Alert)
+{
+  I2CPRT_vUpdateAra(u8Alert);
+}
+
+SINLINE uint16 PMBUS_SCFG_u16ReadSchmCpuLoad(void)
+{
+  return SCHM_u16GetCpuLoad();
+}
+
 SINLINE void PMBUS_SCFG_vSysSetFanCtrlDuty(uint8 u8Index, uint16 u16Duty)
 {
   FANCTRL_vSysSetFanCtrlDuty(u8Index,u16Duty);
@@ -210,9 +262,9 @@ SINLINE uint8 PMBUS_SCFG_u8GetEnableBlackbox(void)
   return BLABOX_vGetEnableBlackbox();
 }
 
-SINLINE void PMBUS_SCFG_vReadMfrBlackbox(uint8* pu8Buffer)
+SINLINE uint8* PMBUS_SCFG_pu8GetMfrBlackboxImage(void)
 {
-  (void)BLABOX_vMFR_BLABOX(pu8Buffer);
+  return BLABOX_pu8MFR_BLABOX();
 }
 
 SINLINE void PMBUS_SCFG_vSetOtWarnValue(sint16 s16Data)
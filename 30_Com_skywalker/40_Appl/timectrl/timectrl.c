@@ -42,6 +42,7 @@
 static uint16    mg_u16MinIn1SCnt = MG_MINUTE_IN_1S;
 static uint8     mg_u8HalfHourInMinCnt = MG_HALF_HOUR_IN_MIN;
 static uint8     mg_u8SaveMinutePos = 0;
+static uint8     mg_u8SavePend = FALSE;        /* EEPROM queue was full, save again */
 static DWORD_VAL mg_u32MinutesUsed;
 static DWORD_VAL mg_u32MinutesUsedOld;
 
@@ -203,11 +204,9 @@ void TIMECTRL_vSaveHoursUsed( void )
   static uint8 mg_RtcTrSecondUnit = 0;
   uint8 u8Crc = 0;
   DWORD_VAL u32HoursUsed;
-	uint32 u32HoursUsedPre;
 	uint32 RtcTrSecondUnit;
   static uint8 u8PowerOnRst = TRUE;
   static uint32 u32PosLast = 0;
-  uint32 u32TmpData;
 	
   uint8 au8EepromWriteBuf[5] = {0,0,0,0,0};
 	RtcTrSecondUnit = TIMECTRL_CFG_RTC_TR_SECOND_UNIT;
@@ -227,17 +226,9 @@ void TIMECTRL_vSaveHoursUsed( void )
         u32PosLast++;
       }
       mg_u32MinutesUsed.u32Val++;
-      TIMECTRL_RTE_Read_R_PosTotal(&u32TmpData);
-      TIMECTRL_RTE_Write_P_vDataCopy(u32TmpData);
-      TIMECTRL_RTE_Write_B_P_PSO_TOTAL_UPDTING(TRUE);
+      /* PMBus reads take the values from the next sensor snapshot */
       TIMECTRL_RTE_Write_P_u32PosTotal(mg_u32MinutesUsed.u32Val);
-      TIMECTRL_RTE_Write_B_P_PSO_TOTAL_UPDTING(FALSE);
-      
-      TIMECTRL_RTE_Read_R_PosLast(&u32TmpData);
-      TIMECTRL_RTE_Write_P_vDataCopy(u32TmpData);
-      TIMECTRL_RTE_Write_B_P_PSO_LAST_UPDTING(TRUE);
       TIMECTRL_RTE_Write_P_u32PosLast(u32PosLast);
-      TIMECTRL_RTE_Write_B_P_PSO_LAST_UPDTING(FALSE);
 
     }
     else
@@ -260,7 +251,7 @@ void TIMECTRL_vSaveHoursUsed( void )
     }
   }
 
-  if ((FALSE != TIMECTRL_RTE_Read_B_R_INPUT_OFF()) || (0 == mg_u8HalfHourInMinCnt))
+  if ((FALSE != TIMECTRL_RTE_Read_B_R_INPUT_OFF()) || (0 == mg_u8HalfHourInMinCnt) || (FALSE != mg_u8SavePend))
   {
     TIMECTRL_RTE_Write_B_P_INPUT_OFF(FALSE);
     if (0U == mg_u8HalfHourInMinCnt)
@@ -270,15 +261,11 @@ void TIMECTRL_vSaveHoursUsed( void )
     }
     
     u32HoursUsed.u32Val = mg_u32MinutesUsed.u32Val / 3600u;
-		TIMECTRL_RTE_Read_R_PmbusHoursUsed(&u32HoursUsedPre);
-    TIMECTRL_RTE_Write_P_vDataCopy(u32HoursUsedPre);
-    TIMECTRL_RTE_Write_P_vWrBitHoursUpd(TRUE );
     TIMECTRL_RTE_Write_P_vWrHoursUsed(u32HoursUsed.u32Val);
-    TIMECTRL_RTE_Write_P_vWrBitHoursUpd(FALSE);
     
     if (mg_u32MinutesUsedOld.u32Val != mg_u32MinutesUsed.u32Val) 
     {
-      mg_u32MinutesUsedOld.u32Val = mg_u32MinutesUsed.u32Val;
+      /* Old value kept until the EEPROM queue takes the write: retried next call */
       u8Crc = CRC_INIT_02;
       u8Crc = TIMECATL_SCFG_u8GetCrc8(u8Crc, mg_u32MinutesUsed.Bytes.MB);
       u8Crc = TIMECATL_SCFG_u8GetCrc8(u8Crc, mg_u32MinutesUsed.Bytes.UB);
@@ -292,20 +279,21 @@ void TIMECTRL_vSaveHoursUsed( void )
 
       if (0 == mg_u8SaveMinutePos)
       {
-				if(TIMECTRL_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(TIMECATL_SCFG_u8WriteMem(EEP_USED_MINUTES_LB, au8EepromWriteBuf, 5u) == TRUE)
 				{
-          TIMECATL_SCFG_vWriteMem(EEP_USED_MINUTES_LB, au8EepromWriteBuf, 5u);
+          mg_u32MinutesUsedOld.u32Val = mg_u32MinutesUsed.u32Val;
+          mg_u8SaveMinutePos = 0x01u; 
 				}
-        mg_u8SaveMinutePos = 0x01u; 
       }
       else
       {
-				if(TIMECTRL_SCFG_u8IsEepromStandbyState() == TRUE)
+				if(TIMECATL_SCFG_u8WriteMem(EEP_USED_MINUTES_1_LB, au8EepromWriteBuf, 5u) == TRUE)
 				{
-          TIMECATL_SCFG_vWriteMem(EEP_USED_MINUTES_1_LB, au8EepromWriteBuf, 5u);
+          mg_u32MinutesUsedOld.u32Val = mg_u32MinutesUsed.u32Val;
+          mg_u8SaveMinutePos = 0x00;
 				}
-        mg_u8SaveMinutePos = 0x00;
       }
+      mg_u8SavePend = (mg_u32MinutesUsedOld.u32Val != mg_u32MinutesUsed.u32Val) ? TRUE : FALSE;
     }
   } 
 } /* TIME_vHoursUsed() */
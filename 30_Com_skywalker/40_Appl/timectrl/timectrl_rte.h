@@ -57,13 +57,9 @@
  **********************************************/
 /* Flags */
 #define RTE_Write_B_P_INPUT_OFF                 (RTE_B_COM_INPUT_OFF)
-#define RTE_Write_B_P_HOURS_USED_UPDTING        (PMBUS_uDataUpdStatus.Bits.HOURS_USED_UPDTING)
-#define RTE_Write_B_P_PSO_TOTAL_UPDTING         (PMBUS_uDataUpdStatus1.Bits.MFR_POS_TOTAL)
-#define RTE_Write_B_P_PSO_LAST_UPDTING          (PMBUS_uDataUpdStatus1.Bits.MFR_POS_LAST)
 
 /* Variables */
 
-#define RTE_Write_P_u32PmbusDataCopy            (PMBUS_tData.u32DataCopy.u32Val)
 #define RTE_Write_P_u32PmbusHoursUsed           (PMBUS_tData.u32HoursUsed.u32Val)
 #define RTE_Write_P_u32PosTotal(var)            (PMBUS_tData.u32PosTotal.u32Val = var)
 #define RTE_Write_P_u32PosLast(var)             (PMBUS_tData.u32PosLast.u32Val = var)
@@ -103,26 +99,6 @@ SINLINE void TIMECTRL_RTE_Write_B_P_INPUT_OFF(uint8 u8State)
   RTE_Write_B_P_INPUT_OFF = u8State;
 }
 
-SINLINE void TIMECTRL_RTE_Write_P_vDataCopy(uint32 u32Data)
-{
-	RTE_Write_P_u32PmbusDataCopy = u32Data;
-}
-
-SINLINE void TIMECTRL_RTE_Write_P_vWrBitHoursUpd(uint8 u8Data)
-{
-	RTE_Write_B_P_HOURS_USED_UPDTING  = u8Data;
-}
-
-SINLINE void TIMECTRL_RTE_Write_B_P_PSO_TOTAL_UPDTING(uint8 u8Data)
-{
-	RTE_Write_B_P_PSO_TOTAL_UPDTING  = u8Data;
-}
-
-SINLINE void TIMECTRL_RTE_Write_B_P_PSO_LAST_UPDTING(uint8 u8Data)
-{
-	RTE_Write_B_P_PSO_LAST_UPDTING  = u8Data;
-}
-
 SINLINE void TIMECTRL_RTE_Write_P_vWrHoursUsed(uint32 u32Data)
 {
   RTE_Write_P_u32PmbusHoursUsed = u32Data;
@@ -40,9 +40,9 @@ SINLINE void TIMECATL_SCFG_vReadMem_1(uint8* pu8Buffer)
 	(void)EEPROM_u32ReadBuffer(pu8Buffer,EEP_USED_MINUTES_1_LB, 5);
 }
 
-SINLINE void TIMECATL_SCFG_vWriteMem(uint16 u16ReadAddr, const uint8* pu8Buffer,  uint16 u16NumByteToWrite)
+SINLINE uint8 TIMECATL_SCFG_u8WriteMem(uint16 u16WriteAddr, const uint8* pu8Buffer, uint16 u16NumByteToWrite)
 {
-	(void)EEPROM_u32WriteBuffer(pu8Buffer, u16ReadAddr,u16NumByteToWrite);
+	return EEPROM_u8QueueWrite(pu8Buffer, u16WriteAddr, u16NumByteToWrite, NULL);
 }
 
 SINLINE uint8 TIMECATL_SCFG_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
@@ -50,11 +50,6 @@ SINLINE uint8 TIMECATL_SCFG_u8GetCrc8(uint8 u8InCrc, uint8 u8InData)
 	return CRC_u8GetCrc8(u8InCrc,u8InData);
 }
 
-SINLINE uint8 TIMECTRL_SCFG_u8IsEepromStandbyState()
-{
-  return TRUE;//(uint8)(EEPROM_u32WaitEepromStandbyState() == 0?1u:0U);
-}
-
 
 
 #ifdef __cplusplus
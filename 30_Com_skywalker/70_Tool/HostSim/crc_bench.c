@@ -0,0 +1,282 @@
+/** *****************************************************************************
+ * \file    crc_bench.c
+ * \brief   Host micro benchmark of the crc module
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * Usage: crc_bench [MB per case]
+ *
+ * Links the unmodified crc.c and compares the per byte calls CRC_u8GetCrc8()
+ * and CRC_u16GetCrc16(), as used by the callers so far, against the block
+ * functions for the block sizes of the framed transports (PMBus read, inter
+ * MCU frame, data area, firmware image). The block results are first checked
+ * against the per byte calls for every length and alignment up to 64 bytes.
+ * "make crc_bench" builds the firmware configuration (crc_conf.h), "make
+ * crc_bench_s4" the same with the slice-by-4 tables.
+ *
+ * The host CPU is not the Cortex-M0/M4: the ratio between the rows is what
+ * carries over, not the absolute numbers.
+ */
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/* Module header */
+  #include "crc_api.h"
+  #include "crc_conf.h"
+
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+#define MG_BUF_SIZE        16384u
+#define MG_CHECK_LEN       64u
+#define MG_DEFAULT_MB      32u
+
+/*******************************************************************************
+ * Local data types (private typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef struct
+{
+  uint64 u64Ns;
+  uint64 u64Cyc;
+} MG_S_TIME;
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static int mg_iPerfFd = -1;
+static const char *mg_pcCycSrc = "n/a";
+
+static uint8 mg_au8Buf[MG_BUF_SIZE + 4u];
+
+/* PMBus read with PEC, inter MCU frame, data area block, firmware image */
+static const uint32 mg_au32BlkLen[] = { 8u, 64u, 1024u, MG_BUF_SIZE };
+
+/* Sink for the results, keeps the compiler from dropping the loops */
+volatile uint32 mg_u32Sink;
+
+/*******************************************************************************
+ * Local function prototypes (private to module)
+ ******************************************************************************/
+
+static void mg_vCycOpen(void);
+static void mg_vNow(MG_S_TIME *psTime);
+static uint32 mg_u32Check(void);
+static void mg_vBench(uint8 u8Crc16, uint32 u32Len, uint32 u32Rep);
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+static void mg_vCycOpen(void)
+{
+  struct perf_event_attr sAttr;
+
+  memset(&sAttr, 0, sizeof(sAttr));
+  sAttr.type           = PERF_TYPE_HARDWARE;
+  sAttr.size           = sizeof(sAttr);
+  sAttr.config         = PERF_COUNT_HW_CPU_CYCLES;
+  sAttr.disabled       = 1;
+  sAttr.exclude_kernel = 1;
+  sAttr.exclude_hv     = 1;
+
+  mg_iPerfFd = (int)syscall(__NR_perf_event_open, &sAttr, 0, -1, -1, 0);
+  if (mg_iPerfFd >= 0)
+  {
+    ioctl(mg_iPerfFd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(mg_iPerfFd, PERF_EVENT_IOC_ENABLE, 0);
+    mg_pcCycSrc = "core cycles";
+  }
+  else
+  {
+    #if defined(__x86_64__) || defined(__i386__)
+    mg_pcCycSrc = "TSC cycles";
+    #endif
+  }
+}
+
+static void mg_vNow(MG_S_TIME *psTime)
+{
+  struct timespec sTs;
+  uint64 u64Cyc = 0u;
+
+  if (mg_iPerfFd >= 0)
+  {
+    if (read(mg_iPerfFd, &u64Cyc, sizeof(u64Cyc)) != (ssize_t)sizeof(u64Cyc))
+    {
+      u64Cyc = 0u;
+    }
+  }
+  else
+  {
+    #if defined(__x86_64__) || defined(__i386__)
+    u64Cyc = (uint64)__rdtsc();
+    #endif
+  }
+  clock_gettime(CLOCK_MONOTONIC, &sTs);
+  psTime->u64Ns  = ((uint64)sTs.tv_sec * 1000000000ull) + (uint64)sTs.tv_nsec;
+  psTime->u64Cyc = u64Cyc;
+}
+
+/* Block results against the per byte calls, returns the number of mismatches */
+static uint32 mg_u32Check(void)
+{
+  uint32 u32Off;
+  uint32 u32Len;
+  uint32 u32Idx;
+  uint32 u32Err = 0u;
+  uint16 u16Crc;
+  uint8  u8Crc;
+
+  for (u32Off = 0u; u32Off < 4u; u32Off++)
+  {
+    for (u32Len = 0u; u32Len <= MG_CHECK_LEN; u32Len++)
+    {
+      u16Crc = 0xFFFFu;
+      u8Crc  = 0u;
+      for (u32Idx = 0u; u32Idx < u32Len; u32Idx++)
+      {
+        u16Crc = CRC_u16GetCrc16(u16Crc, mg_au8Buf[u32Off + u32Idx]);
+        u8Crc  = CRC_u8GetCrc8(u8Crc, mg_au8Buf[u32Off + u32Idx]);
+      }
+      if (u16Crc != CRC_u16GetCrc16Blk(0xFFFFu, &mg_au8Buf[u32Off], u32Len))
+      {
+        printf("CRC16 mismatch, offset %lu length %lu\n", u32Off, u32Len);
+        u32Err++;
+      }
+      if (u8Crc != CRC_u8GetCrc8Blk(0u, &mg_au8Buf[u32Off], u32Len))
+      {
+        printf("CRC8 mismatch, offset %lu length %lu\n", u32Off, u32Len);
+        u32Err++;
+      }
+    }
+  }
+  return u32Err;
+}
+
+static void mg_vBench(uint8 u8Crc16, uint32 u32Len, uint32 u32Rep)
+{
+  MG_S_TIME sStart;
+  MG_S_TIME sEnd;
+  double f64ByteNs[2];
+  double f64ByteCyc[2];
+  uint64 u64Bytes = (uint64)u32Len * u32Rep;
+  uint32 u32Run;
+  uint32 u32Loop;
+  uint32 u32Idx;
+  uint32 u32Crc = 0u;
+
+  /* Run 0: per byte calls, run 1: block function */
+  for (u32Run = 0u; u32Run < 2u; u32Run++)
+  {
+    mg_vNow(&sStart);
+    for (u32Loop = 0u; u32Loop < u32Rep; u32Loop++)
+    {
+      if (0u == u32Run)
+      {
+        for (u32Idx = 0u; u32Idx < u32Len; u32Idx++)
+        {
+          u32Crc = (0u != u8Crc16) ? CRC_u16GetCrc16((uint16)u32Crc, mg_au8Buf[u32Idx]) :
+                                     CRC_u8GetCrc8((uint8)u32Crc, mg_au8Buf[u32Idx]);
+        }
+      }
+      else
+      {
+        u32Crc = (0u != u8Crc16) ? CRC_u16GetCrc16Blk((uint16)u32Crc, mg_au8Buf, u32Len) :
+                                   CRC_u8GetCrc8Blk((uint8)u32Crc, mg_au8Buf, u32Len);
+      }
+    }
+    mg_vNow(&sEnd);
+    mg_u32Sink = u32Crc;
+    f64ByteNs[u32Run]  = (double)(sEnd.u64Ns - sStart.u64Ns) / (double)u64Bytes;
+    f64ByteCyc[u32Run] = (double)(sEnd.u64Cyc - sStart.u64Cyc) / (double)u64Bytes;
+  }
+
+  printf("%-6s %6lu  %8.3f %8.3f  %8.3f %8.3f  %6.2fx\n",
+         (0u != u8Crc16) ? "CRC16" : "CRC8", u32Len,
+         f64ByteNs[0], f64ByteNs[1],
+         (f64ByteCyc[0] > 0.0) ? (1.0 / f64ByteCyc[0]) : 0.0,
+         (f64ByteCyc[1] > 0.0) ? (1.0 / f64ByteCyc[1]) : 0.0,
+         (f64ByteNs[1] > 0.0) ? (f64ByteNs[0] / f64ByteNs[1]) : 0.0);
+}
+
+/*******************************************************************************
+ * Main
+ ******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+  uint32 u32Mb = MG_DEFAULT_MB;
+  uint32 u32Idx;
+  uint32 u32Blk;
+  uint32 u32Rep;
+
+  if (argc > 1)
+  {
+    u32Mb = (uint32)strtoul(argv[1], NULL, 0);
+    u32Mb = (0u == u32Mb) ? 1u : u32Mb;
+  }
+
+  srand(1u);
+  for (u32Idx = 0u; u32Idx < sizeof(mg_au8Buf); u32Idx++)
+  {
+    mg_au8Buf[u32Idx] = (uint8)rand();
+  }
+
+  if (0u != mg_u32Check())
+  {
+    printf("Block functions do not match the per byte calls\n");
+    return 1;
+  }
+
+  mg_vCycOpen();
+
+  printf("crc module: CRC8 slice-by-4 %lu, CRC16 slice-by-4 %lu, %lu MB per case\n",
+         (uint32)MG_CRC8_SLICE_BY_4, (uint32)MG_CRC16_SLICE_BY_4, u32Mb);
+  printf("block results match the per byte calls (length 0..%u, 4 alignments)\n\n", MG_CHECK_LEN);
+  printf("                 ns/byte            bytes/cycle (%s)\n", mg_pcCycSrc);
+  printf("crc     bytes  per byte    block  per byte    block  speedup\n");
+
+  for (u32Blk = 0u; u32Blk < (sizeof(mg_au32BlkLen) / sizeof(mg_au32BlkLen[0])); u32Blk++)
+  {
+    u32Rep = (u32Mb << 20u) / mg_au32BlkLen[u32Blk];
+    mg_vBench(0u, mg_au32BlkLen[u32Blk], u32Rep);
+    mg_vBench(1u, mg_au32BlkLen[u32Blk], u32Rep);
+  }
+
+  return 0;
+}
+
+
+/*
+ * End of file
+ */
@@ -0,0 +1,102 @@
+/** *****************************************************************************
+ * \file    core_cmFunc.h
+ * \brief   Host replacement of the CMSIS core register access functions
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * NOTE: Only used by the host simulation build. PRIMASK is kept in a variable
+ *       of the simulated MCAL (sim_mcal.c) so that the simulation can decide
+ *       whether an injected interrupt may run or has to stay pending.
+ */
+
+#ifndef __CORE_CMFUNC_H
+#define __CORE_CMFUNC_H
+
+#include <stdint.h>
+
+extern volatile uint32_t SIM_u32Primask;
+extern volatile uint32_t SIM_u32Control;
+extern volatile uint32_t SIM_u32Ipsr;
+
+__attribute__((always_inline)) static inline void __enable_irq(void)
+{
+  SIM_u32Primask = 0u;
+}
+
+__attribute__((always_inline)) static inline void __disable_irq(void)
+{
+  SIM_u32Primask = 1u;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_PRIMASK(void)
+{
+  return SIM_u32Primask;
+}
+
+__attribute__((always_inline)) static inline void __set_PRIMASK(uint32_t priMask)
+{
+  SIM_u32Primask = priMask & 1u;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_CONTROL(void)
+{
+  return SIM_u32Control;
+}
+
+__attribute__((always_inline)) static inline void __set_CONTROL(uint32_t control)
+{
+  SIM_u32Control = control;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_IPSR(void)
+{
+  return SIM_u32Ipsr;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_APSR(void)
+{
+  return 0u;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_xPSR(void)
+{
+  return SIM_u32Ipsr;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_PSP(void)
+{
+  return 0u;
+}
+
+__attribute__((always_inline)) static inline void __set_PSP(uint32_t topOfProcStack)
+{
+  (void)topOfProcStack;
+}
+
+__attribute__((always_inline)) static inline uint32_t __get_MSP(void)
+{
+  return 0u;
+}
+
+__attribute__((always_inline)) static inline void __set_MSP(uint32_t topOfMainStack)
+{
+  (void)topOfMainStack;
+}
+
+#endif /* __CORE_CMFUNC_H */
+
+/*
+ * End of file
+ */
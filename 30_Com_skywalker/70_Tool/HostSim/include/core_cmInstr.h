@@ -0,0 +1,66 @@
+/** *****************************************************************************
+ * \file    core_cmInstr.h
+ * \brief   Host replacement of the CMSIS core instruction intrinsics
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * NOTE: This header is found before 50_Lib/Core_Lib/core_cmInstr.h only in the
+ *       host simulation build (see Makefile). It keeps the CMSIS names so the
+ *       firmware sources compile unchanged, but implements them in plain C.
+ */
+
+#ifndef __CORE_CMINSTR_H
+#define __CORE_CMINSTR_H
+
+#include <stdint.h>
+
+/* Barriers and hints have no meaning for the single threaded host model */
+__attribute__((always_inline)) static inline void __NOP(void) {}
+__attribute__((always_inline)) static inline void __WFI(void) {}
+__attribute__((always_inline)) static inline void __WFE(void) {}
+__attribute__((always_inline)) static inline void __SEV(void) {}
+
+/* armcc built-in intrinsic used directly by some modules */
+__attribute__((always_inline)) static inline void __nop(void) {}
+__attribute__((always_inline)) static inline void __ISB(void) { __sync_synchronize(); }
+__attribute__((always_inline)) static inline void __DSB(void) { __sync_synchronize(); }
+__attribute__((always_inline)) static inline void __DMB(void) { __sync_synchronize(); }
+
+__attribute__((always_inline)) static inline uint32_t __REV(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+__attribute__((always_inline)) static inline uint32_t __REV16(uint32_t value)
+{
+  return ((value & 0xFF00FF00u) >> 8) | ((value & 0x00FF00FFu) << 8);
+}
+
+__attribute__((always_inline)) static inline int32_t __REVSH(int32_t value)
+{
+  return (int32_t)(int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__attribute__((always_inline)) static inline uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 &= 31u;
+  return (op2 == 0u) ? op1 : ((op1 >> op2) | (op1 << (32u - op2)));
+}
+
+#endif /* __CORE_CMINSTR_H */
+
+/*
+ * End of file
+ */
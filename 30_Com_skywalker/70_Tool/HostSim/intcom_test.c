@@ -0,0 +1,547 @@
+/** *****************************************************************************
+ * \file    intcom_test.c
+ * \brief   Host test of the inter-MCU frame codec in delta mode
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * Usage: intcom_test [frames]
+ *
+ * Round trips the status frames between the Com MCU (this file, its
+ * intcom_frm.h) and the secondary MCU (intcom_test_sec.c, the intcom_frm.h of
+ * the secondary): COM2SEC packed here and decoded there, SEC2COM the other way.
+ * The primary MCU is not in this tree, COM2PRI / PRI2COM use the same helpers.
+ *
+ * - Field mask: each field changed alone and a few together against the
+ *   keyframe, the bitmap, the delta frame length and the decoded frame checked.
+ * - Lost delta frame: the next delta frame still decodes, it is relative to
+ *   the keyframe.
+ * - Lost keyframe: the delta frames of its sequence are dropped by the
+ *   receiver until the next keyframe; after an unanswered frame the
+ *   transmitter sends the keyframe next (intcom.c) and the link is back at once.
+ * - Truncated delta frame: dropped, the next frame decodes.
+ * - Telemetry stream: every frame decoded equal, the payload and frame bytes
+ *   against keyframes only. The fields change with the rates of
+ *   mg_asCom2SecRate / mg_asSec2ComRate, an assumption and not a recording:
+ *   averaged measurements move in the LSBs from frame to frame, status bits
+ *   and temperatures rarely, revisions, debug words and calibration not.
+ */
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Module header */
+  #include "intcom_frm.h"
+
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+#define MG_U32_FRM_NUM        100000u
+#define MG_U16_FRAME_AUX      6u        /* STX, address, LEN, status byte, CRC16 */
+#define MG_U16_BUF_LEN        64u
+#define MG_U8_FAIL_PRINT      10u
+#define MG_MAP_LEN(n)         (((uint16)(n) + 7u) >> 3u)
+
+/*******************************************************************************
+ * Local data types (private typedefs / structs / enums)
+ ******************************************************************************/
+
+/* One direction: packed at one end, decoded at the other */
+typedef struct
+{
+  const char *pcName;
+  uint16 u16Len;              /* Keyframe payload bytes */
+  uint8 u8FieldNum;
+  const uint8 *pau8Ofs;
+  const uint8 *pau8ChgPct;    /* Frames in which each field changes, % */
+  uint16 (*pu16Tx)(uint8 *pu8Frm, uint8 *pau8TxBuf);
+  uint16 (*pu16Rx)(const uint8 *pau8Data, uint16 u16Len, uint8 *pu8Frm);
+  void (*pvTxLost)(void);
+} MG_S_LINK;
+
+/*******************************************************************************
+ * Local function prototypes (private to module)
+ ******************************************************************************/
+
+/* Secondary MCU end, intcom_test_sec.c */
+void SEC_vReset(void);
+void SEC_vTxLost(void);
+uint16 SEC_u16TxSec2Com(uint8 *pu8Frm, uint8 *pau8TxBuf);
+uint16 SEC_u16RxCom2Sec(const uint8 *pau8Data, uint16 u16Len, uint8 *pu8Frm);
+
+static void mg_vReset(void);
+static void mg_vTxLost(void);
+static uint16 mg_u16TxCom2Sec(uint8 *pu8Frm, uint8 *pau8TxBuf);
+static uint16 mg_u16RxSec2Com(const uint8 *pau8Data, uint16 u16Len, uint8 *pu8Frm);
+static uint32 mg_u32Rand(void);
+static void mg_vFail(const MG_S_LINK *psLink, const char *pcCase, uint32 u32Frm, const char *pcWhat);
+static void mg_vChangeField(const MG_S_LINK *psLink, uint8 *pu8Frm, uint8 u8Field);
+static uint16 mg_u16Send(const MG_S_LINK *psLink, uint8 *pu8Frm, uint8 *pau8TxBuf, uint8 *pu8Rx, uint8 u8Deliver);
+static void mg_vTestMask(const MG_S_LINK *psLink);
+static void mg_vTestLostDelta(const MG_S_LINK *psLink);
+static void mg_vTestLostKey(const MG_S_LINK *psLink);
+static void mg_vTestTruncated(const MG_S_LINK *psLink);
+static void mg_vTestStream(const MG_S_LINK *psLink, uint32 u32FrmNum);
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static INTCOM_FRM_S_COM2SEC_TX mg_sCom2SecTx;
+static INTCOM_FRM_S_SEC2COM_RX mg_sSec2ComRx;
+
+static uint32 mg_u32Err;
+static uint32 mg_u32Seed = 1u;
+
+/* Rsvd, status, debug address, V1 / I / share gain, AC frequency, share
+ * offset, V1 / I1 calibration */
+static const uint8 mg_asCom2SecRate[INTCOM_FRM_U8_COM2SEC_FIELD_NUM] =
+{
+  0u, 2u, 0u, 0u, 0u, 0u, 30u, 0u, 0u, 0u, 0u, 0u
+};
+
+/* Revisions, temperature status, LLC status 0..2, debug words, V1 external,
+ * current, power, NTC 1 / 2, V1 internal, share, local current, CPU load,
+ * ISR monitor */
+static const uint8 mg_asSec2ComRate[INTCOM_FRM_U8_SEC2COM_FIELD_NUM] =
+{
+  0u, 0u, 1u, 2u, 2u, 2u, 0u, 60u, 60u, 60u, 10u, 10u, 60u, 60u, 60u, 30u, 10u
+};
+
+static const MG_S_LINK mg_asLink[] =
+{
+  {
+    "COM2SEC", INTCOM_FRM_U16_COM2SEC_LEN, INTCOM_FRM_U8_COM2SEC_FIELD_NUM, INTCOM_FRM_au8Com2SecOfs,
+    mg_asCom2SecRate, mg_u16TxCom2Sec, SEC_u16RxCom2Sec, mg_vTxLost
+  },
+  {
+    "SEC2COM", INTCOM_FRM_U16_SEC2COM_LEN, INTCOM_FRM_U8_SEC2COM_FIELD_NUM, INTCOM_FRM_au8Sec2ComOfs,
+    mg_asSec2ComRate, SEC_u16TxSec2Com, mg_u16RxSec2Com, SEC_vTxLost
+  }
+};
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/* Both ends as at init */
+static void mg_vReset(void)
+{
+  memset(&mg_sCom2SecTx, 0, sizeof(mg_sCom2SecTx));
+  memset(&mg_sSec2ComRx, 0, sizeof(mg_sSec2ComRx));
+  SEC_vReset();
+}
+
+/* COM2SEC not answered: keyframe next, as intcom.c */
+static void mg_vTxLost(void)
+{
+  mg_sCom2SecTx.u8Cnt = 0U;
+}
+
+static uint16 mg_u16TxCom2Sec(uint8 *pu8Frm, uint8 *pau8TxBuf)
+{
+  INTCOM_FRM_S_COM2SEC sFrm;
+  uint16 u16Len = 0U;
+
+  memcpy(&sFrm, pu8Frm, sizeof(sFrm));
+  INTCOM_FRM_vPackCom2SecDelta(&sFrm, &mg_sCom2SecTx, pau8TxBuf, &u16Len);
+  memcpy(pu8Frm, &sFrm, sizeof(sFrm));
+  return u16Len;
+}
+
+static uint16 mg_u16RxSec2Com(const uint8 *pau8Data, uint16 u16Len, uint8 *pu8Frm)
+{
+  INTCOM_FRM_S_SEC2COM sFrm;
+  uint16 u16Ret;
+
+  u16Ret = INTCOM_FRM_u16UnpackSec2ComDelta(pau8Data, u16Len, &mg_sSec2ComRx, &sFrm);
+  if (0U != u16Ret)
+  {
+    memcpy(pu8Frm, &sFrm, sizeof(sFrm));
+  }
+  return u16Ret;
+}
+
+/* Same sequence on every host */
+static uint32 mg_u32Rand(void)
+{
+  mg_u32Seed = (mg_u32Seed * 1103515245u) + 12345u;
+  return (mg_u32Seed >> 8) & 0xFFFFu;
+}
+
+static void mg_vFail(const MG_S_LINK *psLink, const char *pcCase, uint32 u32Frm, const char *pcWhat)
+{
+  if (mg_u32Err < MG_U8_FAIL_PRINT)
+  {
+    printf("%s %s frame %lu: %s\n", psLink->pcName, pcCase, (unsigned long)u32Frm, pcWhat);
+  }
+  mg_u32Err++;
+}
+
+/* A new value of the field, at least one byte differs */
+static void mg_vChangeField(const MG_S_LINK *psLink, uint8 *pu8Frm, uint8 u8Field)
+{
+  uint8 u8Idx;
+
+  for (u8Idx = psLink->pau8Ofs[u8Field]; u8Idx < psLink->pau8Ofs[u8Field + 1u]; u8Idx++)
+  {
+    pu8Frm[u8Idx] = (uint8)mg_u32Rand();
+  }
+  pu8Frm[psLink->pau8Ofs[u8Field]] ^= 0x80u;
+  pu8Frm[psLink->pau8Ofs[u8Field]] |= 0x01u;
+}
+
+/* Pack the frame, decode it at the other end if delivered. Returns the
+ * payload bytes sent, the frame with its header in pu8Frm. */
+static uint16 mg_u16Send(const MG_S_LINK *psLink, uint8 *pu8Frm, uint8 *pau8TxBuf, uint8 *pu8Rx, uint8 u8Deliver)
+{
+  uint16 u16Len;
+
+  u16Len = psLink->pu16Tx(pu8Frm, pau8TxBuf);
+  if (FALSE != u8Deliver)
+  {
+    memset(pu8Rx, 0xEE, psLink->u16Len);
+    if (0U == psLink->pu16Rx(pau8TxBuf, u16Len, pu8Rx))
+    {
+      memset(pu8Rx, 0xEE, psLink->u16Len);
+    }
+  }
+  return u16Len;
+}
+
+/** *****************************************************************************
+ * \brief         Each field changed alone, then the first, a middle and the
+ *                last field together: bitmap, length and decoded frame
+ *
+ * \param[in]     psLink - direction
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vTestMask(const MG_S_LINK *psLink)
+{
+  uint8 au8Frm[MG_U16_BUF_LEN];
+  uint8 au8Key[MG_U16_BUF_LEN];
+  uint8 au8Buf[MG_U16_BUF_LEN];
+  uint8 au8Rx[MG_U16_BUF_LEN];
+  uint8 au8Map[4];
+  uint16 u16MapLen = MG_MAP_LEN(psLink->u8FieldNum);
+  uint16 u16Len;
+  uint16 u16Exp;
+  uint8 au8Set[3];
+  uint8 u8Field;
+  uint8 u8Idx;
+
+  mg_vReset();
+  for (u8Idx = 0u; u8Idx < psLink->u16Len; u8Idx++)
+  {
+    au8Frm[u8Idx] = (uint8)mg_u32Rand();
+  }
+
+  au8Set[0] = 0u;
+  au8Set[1] = psLink->u8FieldNum / 2u;
+  au8Set[2] = psLink->u8FieldNum - 1u;
+
+  for (u8Field = 0u; u8Field <= psLink->u8FieldNum; u8Field++)
+  {
+    /* Keyframe first: the frame is not answered, the next one is a keyframe */
+    psLink->pvTxLost();
+    u16Len = mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+    if ((u16Len != psLink->u16Len) || (0u != (au8Buf[0] & INTCOM_FRM_U8_DELTA)))
+    {
+      mg_vFail(psLink, "mask", u8Field, "no keyframe after a lost frame");
+    }
+    if (0 != memcmp(au8Rx, au8Frm, psLink->u16Len))
+    {
+      mg_vFail(psLink, "mask", u8Field, "keyframe decoded wrong");
+    }
+    memcpy(au8Key, au8Frm, psLink->u16Len);
+
+    /* The field alone, then (u8Field = u8FieldNum) three fields together */
+    memset(au8Map, 0, sizeof(au8Map));
+    u16Exp = 1u + u16MapLen;
+    for (u8Idx = 0u; u8Idx < 3u; u8Idx++)
+    {
+      uint8 u8Chg = (u8Field < psLink->u8FieldNum) ? u8Field : au8Set[u8Idx];
+
+      if (0u == (au8Map[u8Chg >> 3u] & (1u << (u8Chg & 7u))))
+      {
+        mg_vChangeField(psLink, au8Frm, u8Chg);
+        au8Map[u8Chg >> 3u] |= (uint8)(1u << (u8Chg & 7u));
+        u16Exp += psLink->pau8Ofs[u8Chg + 1u] - psLink->pau8Ofs[u8Chg];
+      }
+    }
+
+    u16Len = mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+    if ((u16Exp >= psLink->u16Len) && (u16Len == psLink->u16Len))
+    {
+      /* Not shorter as delta frame: sent as keyframe */
+    }
+    else if ((u16Len != u16Exp) || (au8Buf[0] != (au8Key[0] | INTCOM_FRM_U8_DELTA)))
+    {
+      mg_vFail(psLink, "mask", u8Field, "delta frame length or header");
+    }
+    else if (0 != memcmp(&au8Buf[1], au8Map, u16MapLen))
+    {
+      mg_vFail(psLink, "mask", u8Field, "bitmap");
+    }
+    if (0 != memcmp(au8Rx, au8Frm, psLink->u16Len))
+    {
+      mg_vFail(psLink, "mask", u8Field, "delta frame decoded wrong");
+    }
+  }
+
+  /* Nothing changed: header and an empty bitmap */
+  psLink->pvTxLost();
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+  u16Len = mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+  memset(au8Map, 0, sizeof(au8Map));
+  if ((u16Len != (1u + u16MapLen)) || (0 != memcmp(&au8Buf[1], au8Map, u16MapLen)) ||
+      (0 != memcmp(au8Rx, au8Frm, psLink->u16Len)))
+  {
+    mg_vFail(psLink, "mask", 0u, "unchanged frame");
+  }
+}
+
+/** *****************************************************************************
+ * \brief         A delta frame lost on the line, the next one decodes
+ *
+ * \param[in]     psLink - direction
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vTestLostDelta(const MG_S_LINK *psLink)
+{
+  uint8 au8Frm[MG_U16_BUF_LEN];
+  uint8 au8Buf[MG_U16_BUF_LEN];
+  uint8 au8Rx[MG_U16_BUF_LEN];
+
+  mg_vReset();
+  memset(au8Frm, 0x11, sizeof(au8Frm));
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+
+  mg_vChangeField(psLink, au8Frm, psLink->u8FieldNum - 1u);
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, FALSE);
+
+  mg_vChangeField(psLink, au8Frm, 1u);
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+  if ((0u == (au8Buf[0] & INTCOM_FRM_U8_DELTA)) || (0 != memcmp(au8Rx, au8Frm, psLink->u16Len)))
+  {
+    mg_vFail(psLink, "lost delta", 2u, "next delta frame decoded wrong");
+  }
+}
+
+/** *****************************************************************************
+ * \brief         A keyframe lost on the line: its delta frames are dropped until
+ *                the next keyframe, or until the transmitter sends one after the
+ *                unanswered frame
+ *
+ * \param[in]     psLink - direction
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vTestLostKey(const MG_S_LINK *psLink)
+{
+  uint8 au8Frm[MG_U16_BUF_LEN];
+  uint8 au8Buf[MG_U16_BUF_LEN];
+  uint8 au8Rx[MG_U16_BUF_LEN];
+  uint32 u32Frm;
+  uint32 u32Dropped = 0u;
+
+  mg_vReset();
+  memset(au8Frm, 0x22, sizeof(au8Frm));
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+
+  /* Up to the next keyframe, which is lost */
+  for (u32Frm = 1u; u32Frm < 64u; u32Frm++)
+  {
+    mg_vChangeField(psLink, au8Frm, (uint8)(u32Frm % psLink->u8FieldNum));
+    (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, FALSE);
+    if (0u == (au8Buf[0] & INTCOM_FRM_U8_DELTA))
+    {
+      break;
+    }
+  }
+
+  /* The delta frames of the lost keyframe must not be applied on the old one */
+  for (u32Frm++; u32Frm < 64u; u32Frm++)
+  {
+    mg_vChangeField(psLink, au8Frm, (uint8)(u32Frm % psLink->u8FieldNum));
+    (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+    if (0u == (au8Buf[0] & INTCOM_FRM_U8_DELTA))
+    {
+      break;
+    }
+    if (0xEEu != au8Rx[0])
+    {
+      mg_vFail(psLink, "lost key", u32Frm, "delta frame of a lost keyframe applied");
+    }
+    u32Dropped++;
+  }
+  if ((u32Dropped != (INTCOM_FRM_U8_COM2SEC_KEY_PERIOD - 1u)) || (0 != memcmp(au8Rx, au8Frm, psLink->u16Len)))
+  {
+    mg_vFail(psLink, "lost key", u32Frm, "no resync at the next keyframe");
+  }
+
+  /* Lost keyframe, not answered: keyframe next and the link is back at once */
+  mg_vChangeField(psLink, au8Frm, 0u);
+  psLink->pvTxLost();
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, FALSE);
+  psLink->pvTxLost();
+  mg_vChangeField(psLink, au8Frm, 1u);
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+  if ((0u != (au8Buf[0] & INTCOM_FRM_U8_DELTA)) || (0 != memcmp(au8Rx, au8Frm, psLink->u16Len)))
+  {
+    mg_vFail(psLink, "lost key", 0u, "no resync after the unanswered frame");
+  }
+}
+
+/** *****************************************************************************
+ * \brief         A delta frame one byte short is dropped, the next decodes
+ *
+ * \param[in]     psLink - direction
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vTestTruncated(const MG_S_LINK *psLink)
+{
+  uint8 au8Frm[MG_U16_BUF_LEN];
+  uint8 au8Buf[MG_U16_BUF_LEN];
+  uint8 au8Rx[MG_U16_BUF_LEN];
+  uint16 u16Len;
+
+  mg_vReset();
+  memset(au8Frm, 0x33, sizeof(au8Frm));
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+
+  mg_vChangeField(psLink, au8Frm, psLink->u8FieldNum - 1u);
+  u16Len = mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, FALSE);
+  if (0U != psLink->pu16Rx(au8Buf, u16Len - 1u, au8Rx))
+  {
+    mg_vFail(psLink, "truncated", 1u, "short delta frame accepted");
+  }
+
+  mg_vChangeField(psLink, au8Frm, 1u);
+  (void)mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+  if (0 != memcmp(au8Rx, au8Frm, psLink->u16Len))
+  {
+    mg_vFail(psLink, "truncated", 2u, "next delta frame decoded wrong");
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Telemetry stream, every frame decoded, bytes against keyframes
+ *                only
+ *
+ * \param[in]     psLink   - direction
+ *                u32FrmNum - frames
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vTestStream(const MG_S_LINK *psLink, uint32 u32FrmNum)
+{
+  uint8 au8Frm[MG_U16_BUF_LEN];
+  uint8 au8Buf[MG_U16_BUF_LEN];
+  uint8 au8Rx[MG_U16_BUF_LEN];
+  uint32 u32Frm;
+  uint32 u32Key = 0u;
+  uint32 u32Delta = 0u;
+  uint32 u32Full;
+  uint16 u16Len;
+  uint8 u8Field;
+
+  mg_vReset();
+  memset(au8Frm, 0, sizeof(au8Frm));
+  for (u32Frm = 0u; u32Frm < u32FrmNum; u32Frm++)
+  {
+    for (u8Field = 0u; u8Field < psLink->u8FieldNum; u8Field++)
+    {
+      if ((mg_u32Rand() % 100u) < psLink->pau8ChgPct[u8Field])
+      {
+        mg_vChangeField(psLink, au8Frm, u8Field);
+      }
+    }
+    u16Len = mg_u16Send(psLink, au8Frm, au8Buf, au8Rx, TRUE);
+    if (0u == (au8Buf[0] & INTCOM_FRM_U8_DELTA))
+    {
+      u32Key++;
+    }
+    u32Delta += u16Len;
+    if (0 != memcmp(au8Rx, au8Frm, psLink->u16Len))
+    {
+      mg_vFail(psLink, "stream", u32Frm, "decoded wrong");
+    }
+  }
+
+  u32Full = u32FrmNum * psLink->u16Len;
+  printf("%-8s %8lu %8lu  %9lu %9lu %6.1f%%  %9lu %9lu %6.1f%%\n", psLink->pcName,
+         (unsigned long)u32FrmNum, (unsigned long)u32Key,
+         (unsigned long)u32Full, (unsigned long)u32Delta, 100.0 * (double)(u32Full - u32Delta) / (double)u32Full,
+         (unsigned long)(u32Full + (u32FrmNum * MG_U16_FRAME_AUX)),
+         (unsigned long)(u32Delta + (u32FrmNum * MG_U16_FRAME_AUX)),
+         100.0 * (double)(u32Full - u32Delta) / (double)(u32Full + (u32FrmNum * MG_U16_FRAME_AUX)));
+}
+
+/*******************************************************************************
+ * Global functions (public to other modules)
+ ******************************************************************************/
+
+int main(int argc, char **argv)
+{
+  uint32 u32FrmNum = MG_U32_FRM_NUM;
+  uint8 u8Link;
+
+  if (argc > 1)
+  {
+    u32FrmNum = (uint32)strtoul(argv[1], NULL, 0);
+  }
+
+  for (u8Link = 0u; u8Link < (sizeof(mg_asLink) / sizeof(mg_asLink[0])); u8Link++)
+  {
+    mg_vTestMask(&mg_asLink[u8Link]);
+    mg_vTestLostDelta(&mg_asLink[u8Link]);
+    mg_vTestLostKey(&mg_asLink[u8Link]);
+    mg_vTestTruncated(&mg_asLink[u8Link]);
+  }
+
+  printf("%-8s %8s %8s  %9s %9s %7s  %9s %9s %7s\n", "", "frames", "keyframe",
+         "payload", "delta", "saved", "frame", "delta", "saved");
+  for (u8Link = 0u; u8Link < (sizeof(mg_asLink) / sizeof(mg_asLink[0])); u8Link++)
+  {
+    mg_vTestStream(&mg_asLink[u8Link], u32FrmNum);
+  }
+
+  if (0u != mg_u32Err)
+  {
+    printf("%lu errors\n", (unsigned long)mg_u32Err);
+    return 1;
+  }
+  printf("delta frames decode equal: field mask, lost delta frame, lost keyframe, truncated frame, stream\n");
+  return 0;
+}
+
+
+/*
+ * End of file
+ */
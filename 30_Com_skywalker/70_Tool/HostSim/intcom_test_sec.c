@@ -0,0 +1,126 @@
+/** *****************************************************************************
+ * \file    intcom_test_sec.c
+ * \brief   Secondary MCU side of the inter-MCU frame codec host test
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * Built against the intcom_frm.h of the secondary MCU, which has the other
+ * direction of each frame than the one of the Com MCU: COM2SEC is decoded and
+ * SEC2COM packed here. Both headers are generated with the same names, so each
+ * side is a translation unit of its own and the frames cross as payload bytes,
+ * as on the UART. The delta mode state is kept here as in intcom.c.
+ */
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include <string.h>
+
+/* Module header */
+  #include "intcom_frm.h"
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static INTCOM_FRM_S_SEC2COM_TX mg_sSec2ComTx;
+static INTCOM_FRM_S_COM2SEC_RX mg_sCom2SecRx;
+
+/*******************************************************************************
+ * Global functions (public to other modules)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Delta mode state as at init: keyframe next, no keyframe held
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SEC_vReset(void)
+{
+  memset(&mg_sSec2ComTx, 0, sizeof(mg_sSec2ComTx));
+  memset(&mg_sCom2SecRx, 0, sizeof(mg_sCom2SecRx));
+}
+
+/** *****************************************************************************
+ * \brief         A SEC2COM frame was not answered: keyframe next, as intcom.c
+ *
+ * \param[in]     -
+ * \param[in,out] -
+ * \param[out]    -
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SEC_vTxLost(void)
+{
+  mg_sSec2ComTx.u8Cnt = 0U;
+}
+
+/** *****************************************************************************
+ * \brief         Pack a SEC2COM frame in delta mode
+ *
+ * \param[in]     -
+ * \param[in,out] pu8Frm    - INTCOM_FRM_U16_SEC2COM_LEN payload bytes, the header
+ *                            is set
+ * \param[out]    pau8TxBuf - payload sent
+ *
+ * \return        Payload bytes sent
+ *
+ ***************************************************************************** */
+uint16 SEC_u16TxSec2Com(uint8 *pu8Frm, uint8 *pau8TxBuf)
+{
+  INTCOM_FRM_S_SEC2COM sFrm;
+  uint16 u16Len = 0U;
+
+  memcpy(&sFrm, pu8Frm, sizeof(sFrm));
+  INTCOM_FRM_vPackSec2ComDelta(&sFrm, &mg_sSec2ComTx, pau8TxBuf, &u16Len);
+  memcpy(pu8Frm, &sFrm, sizeof(sFrm));
+  return u16Len;
+}
+
+/** *****************************************************************************
+ * \brief         Decode a COM2SEC frame in delta mode
+ *
+ * \param[in]     pau8Data - payload received
+ *                u16Len   - payload bytes
+ * \param[in,out] -
+ * \param[out]    pu8Frm   - INTCOM_FRM_U16_COM2SEC_LEN payload bytes
+ *
+ * \return        Payload bytes of the keyframe, 0 if dropped
+ *
+ ***************************************************************************** */
+uint16 SEC_u16RxCom2Sec(const uint8 *pau8Data, uint16 u16Len, uint8 *pu8Frm)
+{
+  INTCOM_FRM_S_COM2SEC sFrm;
+  uint16 u16Ret;
+
+  u16Ret = INTCOM_FRM_u16UnpackCom2SecDelta(pau8Data, u16Len, &mg_sCom2SecRx, &sFrm);
+  if (0U != u16Ret)
+  {
+    memcpy(pu8Frm, &sFrm, sizeof(sFrm));
+  }
+  return u16Ret;
+}
+
+
+/*
+ * End of file
+ */
@@ -0,0 +1,168 @@
+/** *****************************************************************************
+ * \file    sim_api.h
+ * \brief   Service function request file for the host simulation
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+#ifndef SIM_API_H
+#define SIM_API_H
+#ifdef __cplusplus
+  extern "C"  {
+#endif
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include "global.h"
+
+/*******************************************************************************
+ * Global data types (public typedefs / structs / enums)
+ ******************************************************************************/
+
+/* Accumulated run time of one measured section */
+typedef struct
+{
+  uint64 u64Cnt;
+  uint64 u64NsSum;
+  uint64 u64NsMin;
+  uint64 u64NsMax;
+  uint64 u64InstSum;
+  uint64 u64InstMax;
+} SIM_S_PROF;
+
+/*******************************************************************************
+ * Global function prototypes (public to other modules)
+ ******************************************************************************/
+
+/***************************************
+ * sim_mcal.c
+ **************************************/
+
+/** *****************************************************************************
+ * \brief         Map the STM32 memory windows and reset all simulated peripherals.
+ *                Must be called before SCHM_vInit().
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SIM_vInit(void);
+
+/** *****************************************************************************
+ * \brief         Advance the simulated time by one scheduler tick and raise the
+ *                time base update flag
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SIM_vTick(void);
+
+/** *****************************************************************************
+ * \brief         Number of simulated scheduler ticks since SIM_vInit()
+ *
+ * \return        Tick count
+ *
+ ***************************************************************************** */
+uint32 SIM_u32GetTick(void);
+
+/** *****************************************************************************
+ * \brief         Set the raw code of a simulated ADC input
+ *
+ * \param[in]     u8Index   ADC_CFG_E_INDEX of the input
+ * \param[in]     u16Val    12 bit ADC code
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SIM_vSetAdcRaw(uint8 u8Index, uint16 u16Val);
+
+/** *****************************************************************************
+ * \brief         Number of bytes the firmware has written to a UART
+ *
+ * \param[in]     u8UartIndex   UART_CFG_E_INDEX
+ *
+ * \return        Byte count
+ *
+ ***************************************************************************** */
+uint32 SIM_u32UartTxCnt(uint8 u8UartIndex);
+
+/** *****************************************************************************
+ * \brief         Act as PMBus host: one SMBus transaction (write part, optional
+ *                repeated start read part and STOP) through the real I2C ISR
+ *
+ * \param[in]     pu8Wr     Bytes after the write address (command, data, PEC)
+ * \param[in]     u8WrLen   Number of bytes to write
+ * \param[out]    pu8Rd     Read bytes, may be NULL if u8RdLen is 0
+ * \param[in]     u8RdLen   Number of bytes to read
+ * \param[in,out] psIsrProf Run time of every ISR entry is added here, may be NULL
+ * \param[in,out] psTxProf  Run time of the read data entries (TXIS) is also
+ *                          added here, may be NULL
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SIM_vPmbusTransfer(const uint8 *pu8Wr, uint8 u8WrLen, uint8 *pu8Rd, uint8 u8RdLen,
+                        SIM_S_PROF *psIsrProf, SIM_S_PROF *psTxProf);
+
+/** *****************************************************************************
+ * \brief         Own 8 bit address of the simulated PMBus slave
+ *
+ * \return        Write address
+ *
+ ***************************************************************************** */
+uint8 SIM_u8PmbusAddr(void);
+
+/***************************************
+ * sim_main.c
+ **************************************/
+
+/** *****************************************************************************
+ * \brief         Monotonic wall clock in nanoseconds
+ *
+ * \return        Time stamp
+ *
+ ***************************************************************************** */
+uint64 SIM_u64NowNs(void);
+
+/** *****************************************************************************
+ * \brief         Retired user space instructions of this process, 0 if the
+ *                performance counter is not available
+ *
+ * \return        Instruction count
+ *
+ ***************************************************************************** */
+uint64 SIM_u64NowInst(void);
+
+/** *****************************************************************************
+ * \brief         Add one measurement to a profile record
+ *
+ * \param[in,out] psProf   Profile record
+ * \param[in]     u64Ns    Wall clock of the measured section
+ * \param[in]     u64Inst  Instructions of the measured section
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+void SIM_vProfAdd(SIM_S_PROF *psProf, uint64 u64Ns, uint64 u64Inst);
+
+
+#ifdef __cplusplus
+  }
+#endif
+#endif  /* SIM_API_H */
+
+
+/*
+ * End of file
+ */
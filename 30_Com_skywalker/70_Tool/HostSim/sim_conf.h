@@ -0,0 +1,88 @@
+/** *****************************************************************************
+ * \file    sim_conf.h
+ * \brief   Configurations file for the host simulation of the Com firmware
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+#ifndef SIM_CONF_H
+#define SIM_CONF_H
+#ifdef __cplusplus
+  extern "C"  {
+#endif
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include "global.h"
+
+/*******************************************************************************
+ * Global constants and macros (public to other modules)
+ ******************************************************************************/
+
+/***************************************
+ * Time base
+ **************************************/
+#define SIM_CONF_TICK_US                  ((uint32)100u)     /* Same as TIMER_CFG_TIMER_FRQ_SCHM */
+#define SIM_CONF_TICKS_PER_SEC            ((uint32)(1000000u / SIM_CONF_TICK_US))
+#define SIM_CONF_DEFAULT_TICKS            ((uint32)100000u)  /* 10s simulated time */
+#define SIM_CONF_DEFAULT_PMBUS_POLL_MS    ((uint32)10u)      /* 0 = no host traffic */
+
+/***************************************
+ * Memory windows mapped at the STM32F0 addresses
+ **************************************/
+#define SIM_CONF_FLASH_BASE               ((uint32)0x08000000u)
+#define SIM_CONF_FLASH_SIZE               ((uint32)0x00010000u)
+#define SIM_CONF_SYS_MEM_BASE             ((uint32)0x1FFFF000u)   /* Option bytes */
+#define SIM_CONF_SYS_MEM_SIZE             ((uint32)0x00001000u)
+#define SIM_CONF_APB_AHB1_BASE            ((uint32)0x40000000u)
+#define SIM_CONF_APB_AHB1_SIZE            ((uint32)0x00030000u)
+#define SIM_CONF_AHB2_BASE                ((uint32)0x48000000u)   /* GPIO */
+#define SIM_CONF_AHB2_SIZE                ((uint32)0x00002000u)
+#define SIM_CONF_SCS_BASE                 ((uint32)0xE000E000u)   /* NVIC, SCB, SysTick */
+#define SIM_CONF_SCS_SIZE                 ((uint32)0x00001000u)
+
+/***************************************
+ * Simulated peripherals
+ **************************************/
+#define SIM_CONF_EEPROM_SIZE              ((uint32)0x10000u)  /* M24C512 */
+#define SIM_CONF_FLASH_PAGE_SIZE          ((uint32)0x0800u)
+
+/* UART byte time in ticks: 10 bit per byte at 38400 baud = 260us */
+#define SIM_CONF_UART_BYTE_TICKS          ((uint32)3u)
+
+/* Default ADC codes (12 bit) of the simulated analog inputs */
+#define SIM_CONF_ADC_NTC_DEFAULT          ((uint16)2048u)
+#define SIM_CONF_ADC_INT_VSB_DEFAULT      ((uint16)3000u)
+#define SIM_CONF_ADC_EXT_VSB_DEFAULT      ((uint16)3000u)
+#define SIM_CONF_ADC_I_VSB_DEFAULT        ((uint16)200u)
+
+/***************************************
+ * Report
+ **************************************/
+#define SIM_CONF_BASE_SLOTS               10u    /* 100us cases 1..10 */
+#define SIM_CONF_1MS_SLOTS                10u    /* 1ms cases 1..10 */
+#define SIM_CONF_10MS_SLOTS               10u    /* 10ms cases 1..10 */
+#define SIM_CONF_100MS_SLOTS              5u     /* 100ms cases 1..5 */
+
+
+#ifdef __cplusplus
+  }
+#endif
+#endif  /* SIM_CONF_H */
+
+
+/*
+ * End of file
+ */
@@ -0,0 +1,498 @@
+/** *****************************************************************************
+ * \file    sim_main.c
+ * \brief   Host simulation of the Com firmware scheduler
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * Usage: com_sim [ticks] [pmbus poll period in ms]
+ *
+ * SCHM_vInit() and the unmodified scheduler run on simulated peripherals
+ * (sim_mcal.c). Every 100us tick is timed and charged to the scheduler slot it
+ * executes, i.e. the innermost switch case of SCHM_vSchmRoutine(). When PMBus
+ * polling is enabled, the simulation acts as host and reads the usual telemetry
+ * commands round robin through the real I2C ISR, with a PAGE write in between
+ * to measure the frame handling latency and a blackbox clear left to the
+ * polling task.
+ */
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+/* Module header */
+  #include "sim_api.h"
+  #include "sim_conf.h"
+  #include "schm_scb.h"
+  #include "schm_api.h"
+  #include "crc_api.h"
+  #include "i2cprt_api.h"
+  #include "rte.h"
+  #include "pmbus_cfg.h"
+  #include "pmbus_conf.h"
+
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+#define MG_SLOT_CNT        (SIM_CONF_BASE_SLOTS + SIM_CONF_1MS_SLOTS + SIM_CONF_10MS_SLOTS + SIM_CONF_100MS_SLOTS)
+#define MG_PMBUS_RD_MAX    ((uint8)34u)
+#define MG_DEBUG_KEY_UL    ((uint16)0x4C55u)  /* PMB_F6_UNLOCK_DEBUG key */
+#define MG_DEBUG_TICKS     ((uint32)20u)      /* Ticks to handle a write frame */
+
+/*******************************************************************************
+ * Local data types (private typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef struct
+{
+  uint8 u8Cmd;
+  uint8 u8WrLen;      /* Data bytes after the command, all 0 */
+  uint8 u8Len;        /* Read bytes without PEC */
+  const char *pcName;
+} MG_S_PMBUS_POLL;
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static int mg_iPerfFd = -1;
+
+static SIM_S_PROF mg_asSlotProf[MG_SLOT_CNT];
+static SIM_S_PROF mg_sTickProf;
+static SIM_S_PROF mg_sIsrProf;
+static SIM_S_PROF mg_sIsrTxProf;
+
+/* Typical BMC telemetry poll, PAGE write for the frame latency, blackbox
+ * clear handled by the polling in thread context */
+static const MG_S_PMBUS_POLL mg_asPmbusPoll[] =
+{
+  { 0x79u, 0u, 2u, "STATUS_WORD"   },
+  { 0x88u, 0u, 2u, "READ_VIN"      },
+  { 0x89u, 0u, 2u, "READ_IIN"      },
+  { 0x8Bu, 0u, 2u, "READ_VOUT"     },
+  { 0x8Cu, 0u, 2u, "READ_IOUT"     },
+  { 0x8Du, 0u, 2u, "READ_TEMP_1"   },
+  { 0x90u, 0u, 2u, "READ_FAN_1"    },
+  { 0x96u, 0u, 2u, "READ_POUT"     },
+  { 0x97u, 0u, 2u, "READ_PIN"      },
+  { 0x00u, 1u, 0u, "PAGE"          },
+  { 0xE0u, 0u, 0u, "CLEAR_BLACKBOX" }
+};
+
+/*******************************************************************************
+ * Local function prototypes (private to module)
+ ******************************************************************************/
+
+static void mg_vPerfOpen(void);
+static uint8 mg_u8SlotOfTick(uint32 u32Tick);
+static void mg_vSlotName(uint8 u8Slot, char *pcName, size_t sLen);
+static void mg_vPmbusPoll(uint32 u32Idx);
+static void mg_vPmbusXfer(uint8 *pu8Wr, uint8 u8WrLen, uint8 *pu8Rd, uint8 u8RdLen);
+static void mg_vRunTicks(uint32 u32Ticks);
+static uint16 mg_u16ReadDebugReg(uint8 u8Index);
+static void mg_vPrintProf(const char *pcName, const SIM_S_PROF *psProf);
+static void mg_vPrintSchmProf(void);
+static void mg_vPrintI2cLatency(void);
+
+/*******************************************************************************
+ * Global functions (public to other modules)
+ ******************************************************************************/
+
+uint64 SIM_u64NowNs(void)
+{
+  struct timespec sTs;
+
+  clock_gettime(CLOCK_MONOTONIC, &sTs);
+  return ((uint64)sTs.tv_sec * 1000000000ull) + (uint64)sTs.tv_nsec;
+}
+
+uint64 SIM_u64NowInst(void)
+{
+  uint64 u64Cnt = 0u;
+
+  if ((mg_iPerfFd < 0) || (read(mg_iPerfFd, &u64Cnt, sizeof(u64Cnt)) != (ssize_t)sizeof(u64Cnt)))
+  {
+    u64Cnt = 0u;
+  }
+  return u64Cnt;
+}
+
+void SIM_vProfAdd(SIM_S_PROF *psProf, uint64 u64Ns, uint64 u64Inst)
+{
+  if ((0u == psProf->u64Cnt) || (u64Ns < psProf->u64NsMin))
+  {
+    psProf->u64NsMin = u64Ns;
+  }
+  psProf->u64NsMax = MAX(psProf->u64NsMax, u64Ns);
+  psProf->u64InstMax = MAX(psProf->u64InstMax, u64Inst);
+  psProf->u64NsSum += u64Ns;
+  psProf->u64InstSum += u64Inst;
+  psProf->u64Cnt++;
+}
+
+/** *****************************************************************************
+ * \brief         Run the firmware on the simulated peripherals and print the
+ *                per slot run time report
+ *
+ * \param[in]     argc, argv   [ticks] [pmbus poll period in ms]
+ *
+ * \return        Exit code
+ *
+ ***************************************************************************** */
+int main(int argc, char *argv[])
+{
+  uint32 u32Ticks = SIM_CONF_DEFAULT_TICKS;
+  uint32 u32PollMs = SIM_CONF_DEFAULT_PMBUS_POLL_MS;
+  uint32 u32Tick;
+  uint32 u32PollIdx = 0u;
+  uint64 u64Ns;
+  uint64 u64Inst;
+  uint8 u8Slot;
+  char acName[32];
+  uint32 au32UartTx[2];
+
+  if (argc > 1)
+  {
+    u32Ticks = (uint32)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    u32PollMs = (uint32)strtoul(argv[2], NULL, 0);
+  }
+
+  mg_vPerfOpen();
+  SIM_vInit();
+  SCHM_vInit();
+
+  for (u32Tick = 1u; u32Tick <= u32Ticks; u32Tick++)
+  {
+    SIM_vTick();
+
+    u64Inst = SIM_u64NowInst();
+    u64Ns = SIM_u64NowNs();
+    SCHM_vSchmIdleLoop();
+    u64Ns = SIM_u64NowNs() - u64Ns;
+    u64Inst = SIM_u64NowInst() - u64Inst;
+
+    u8Slot = mg_u8SlotOfTick(u32Tick);
+    SIM_vProfAdd(&mg_asSlotProf[u8Slot], u64Ns, u64Inst);
+    SIM_vProfAdd(&mg_sTickProf, u64Ns, u64Inst);
+
+    /* Host traffic between two ticks, as the I2C ISR preempts the scheduler */
+    if ((0u != u32PollMs) && (0u == (u32Tick % (u32PollMs * (1000u / SIM_CONF_TICK_US)))))
+    {
+      mg_vPmbusPoll(u32PollIdx++);
+    }
+  }
+
+  printf("Com host simulation: %lu ticks of %luus, PMBus poll %lums, instructions %s\n",
+         (unsigned long)u32Ticks, (unsigned long)SIM_CONF_TICK_US, (unsigned long)u32PollMs,
+         (mg_iPerfFd < 0) ? "n/a" : "counted");
+  printf("%-16s %9s %9s %9s %9s %11s %11s\n", "slot", "count", "min ns", "avg ns", "max ns", "avg inst", "max inst");
+  for (u8Slot = 0u; u8Slot < MG_SLOT_CNT; u8Slot++)
+  {
+    /* Last case of each level only dispatches to the next level */
+    if (0u != mg_asSlotProf[u8Slot].u64Cnt)
+    {
+      mg_vSlotName(u8Slot, acName, sizeof(acName));
+      mg_vPrintProf(acName, &mg_asSlotProf[u8Slot]);
+    }
+  }
+  mg_vPrintProf("all ticks", &mg_sTickProf);
+  mg_vPrintProf("I2C ISR entry", &mg_sIsrProf);
+  mg_vPrintProf("I2C ISR TXIS", &mg_sIsrTxProf);
+  mg_vPrintSchmProf();
+
+  /* The debug register reads below run the firmware on */
+  au32UartTx[0] = SIM_u32UartTxCnt(0u);
+  au32UartTx[1] = SIM_u32UartTxCnt(1u);
+  mg_vPrintI2cLatency();
+  printf("UART1 tx %lu bytes, UART2 tx %lu bytes\n",
+         (unsigned long)au32UartTx[0], (unsigned long)au32UartTx[1]);
+
+  return EXIT_SUCCESS;
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Open the user space instruction counter of this process
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vPerfOpen(void)
+{
+  struct perf_event_attr sAttr;
+
+  memset(&sAttr, 0, sizeof(sAttr));
+  sAttr.type = PERF_TYPE_HARDWARE;
+  sAttr.size = sizeof(sAttr);
+  sAttr.config = PERF_COUNT_HW_INSTRUCTIONS;
+  sAttr.exclude_kernel = 1;
+  sAttr.exclude_hv = 1;
+
+  mg_iPerfFd = (int)syscall(__NR_perf_event_open, &sAttr, 0, -1, -1, 0);
+  if (mg_iPerfFd >= 0)
+  {
+    ioctl(mg_iPerfFd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(mg_iPerfFd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Scheduler slot executed by a tick, mirrors the counters of
+ *                SCHM_vSchmRoutine() (tick 1 is the first routine call)
+ *
+ * \param[in]     u32Tick   Tick number
+ *
+ * \return        Slot index: base cases, then 1ms, 10ms and 100ms cases
+ *
+ ***************************************************************************** */
+static uint8 mg_u8SlotOfTick(uint32 u32Tick)
+{
+  uint32 u32Case = ((u32Tick - 1u) % SIM_CONF_BASE_SLOTS) + 1u;
+
+  if (u32Case != SIM_CONF_BASE_SLOTS)
+  {
+    return (uint8)(u32Case - 1u);
+  }
+
+  u32Tick /= SIM_CONF_BASE_SLOTS;
+  u32Case = ((u32Tick - 1u) % SIM_CONF_1MS_SLOTS) + 1u;
+  if (u32Case != SIM_CONF_1MS_SLOTS)
+  {
+    return (uint8)(SIM_CONF_BASE_SLOTS + u32Case - 1u);
+  }
+
+  u32Tick /= SIM_CONF_1MS_SLOTS;
+  u32Case = ((u32Tick - 1u) % SIM_CONF_10MS_SLOTS) + 1u;
+  if (u32Case != SIM_CONF_10MS_SLOTS)
+  {
+    return (uint8)(SIM_CONF_BASE_SLOTS + SIM_CONF_1MS_SLOTS + u32Case - 1u);
+  }
+
+  u32Tick /= SIM_CONF_10MS_SLOTS;
+  u32Case = ((u32Tick - 1u) % SIM_CONF_100MS_SLOTS) + 1u;
+  return (uint8)(SIM_CONF_BASE_SLOTS + SIM_CONF_1MS_SLOTS + SIM_CONF_10MS_SLOTS + u32Case - 1u);
+}
+
+static void mg_vSlotName(uint8 u8Slot, char *pcName, size_t sLen)
+{
+  if (u8Slot < SIM_CONF_BASE_SLOTS)
+  {
+    snprintf(pcName, sLen, "100us case %u", (unsigned)(u8Slot + 1u));
+  }
+  else if (u8Slot < (SIM_CONF_BASE_SLOTS + SIM_CONF_1MS_SLOTS))
+  {
+    snprintf(pcName, sLen, "1ms case %u", (unsigned)(u8Slot - SIM_CONF_BASE_SLOTS + 1u));
+  }
+  else if (u8Slot < (SIM_CONF_BASE_SLOTS + SIM_CONF_1MS_SLOTS + SIM_CONF_10MS_SLOTS))
+  {
+    snprintf(pcName, sLen, "10ms case %u", (unsigned)(u8Slot - SIM_CONF_BASE_SLOTS - SIM_CONF_1MS_SLOTS + 1u));
+  }
+  else
+  {
+    snprintf(pcName, sLen, "100ms case %u",
+             (unsigned)(u8Slot - SIM_CONF_BASE_SLOTS - SIM_CONF_1MS_SLOTS - SIM_CONF_10MS_SLOTS + 1u));
+  }
+}
+
+/** *****************************************************************************
+ * \brief         One PMBus read (write command, repeated start, read data + PEC)
+ *
+ * \param[in]     u32Idx   Running poll number
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vPmbusPoll(uint32 u32Idx)
+{
+  const MG_S_PMBUS_POLL *psPoll = &mg_asPmbusPoll[u32Idx % DIM(mg_asPmbusPoll)];
+  uint8 au8Wr[MG_PMBUS_RD_MAX];
+  uint8 au8Rd[MG_PMBUS_RD_MAX];
+  uint8 u8WrLen = 0u;
+
+  memset(au8Wr, 0, sizeof(au8Wr));
+  au8Wr[u8WrLen++] = psPoll->u8Cmd;
+  u8WrLen += psPoll->u8WrLen;
+  mg_vPmbusXfer(au8Wr, u8WrLen, au8Rd, psPoll->u8Len);
+}
+
+/** *****************************************************************************
+ * \brief         One PMBus frame, the PEC appended to a write frame or read
+ *                after the data
+ *
+ * \param[in]     pu8Wr    Command and data, one byte spare for the PEC
+ *                u8WrLen  Command and data bytes
+ *                pu8Rd    Read data, one byte spare for the PEC
+ *                u8RdLen  Read bytes without PEC, 0 for a write frame
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vPmbusXfer(uint8 *pu8Wr, uint8 u8WrLen, uint8 *pu8Rd, uint8 u8RdLen)
+{
+  uint8 u8Pec;
+  uint8 u8Cnt;
+
+  if (FALSE != RTE_bPEC_Enable)
+  {
+    if (0u == u8RdLen)
+    {
+      /* Write frame ends with the PEC over address and data */
+      u8Pec = CRC_u8GetCrc8(0u, SIM_u8PmbusAddr());
+      for (u8Cnt = 0u; u8Cnt < u8WrLen; u8Cnt++)
+      {
+        u8Pec = CRC_u8GetCrc8(u8Pec, pu8Wr[u8Cnt]);
+      }
+      pu8Wr[u8WrLen++] = u8Pec;
+    }
+    else
+    {
+      u8RdLen++;
+    }
+  }
+  SIM_vPmbusTransfer(pu8Wr, u8WrLen, pu8Rd, u8RdLen, &mg_sIsrProf, &mg_sIsrTxProf);
+}
+
+/** *****************************************************************************
+ * \brief         Run the firmware without host traffic
+ *
+ * \param[in]     u32Ticks   Number of ticks
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vRunTicks(uint32 u32Ticks)
+{
+  for (; u32Ticks > 0u; u32Ticks--)
+  {
+    SIM_vTick();
+    SCHM_vSchmIdleLoop();
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Read a word through PMB_F5_DEBUG_REG as the GUI does: unlock,
+ *                write the debug index, read the word
+ *
+ * \param[in]     u8Index   Debug index, RTE_DEBUG_ADR_*
+ *
+ * \return        Word read
+ *
+ ***************************************************************************** */
+static uint16 mg_u16ReadDebugReg(uint8 u8Index)
+{
+  uint8 au8Wr[4];
+  uint8 au8Rd[3];
+
+  au8Wr[0] = PMB_F6_UNLOCK_DEBUG;
+  au8Wr[1] = (uint8)MG_DEBUG_KEY_UL;
+  au8Wr[2] = (uint8)(MG_DEBUG_KEY_UL >> 8);
+  mg_vPmbusXfer(au8Wr, 3u, au8Rd, 0u);
+  mg_vRunTicks(MG_DEBUG_TICKS);
+
+  au8Wr[0] = PMB_F5_DEBUG_REG;
+  au8Wr[1] = u8Index;
+  mg_vPmbusXfer(au8Wr, 2u, au8Rd, 0u);
+  mg_vRunTicks(MG_DEBUG_TICKS);
+
+  au8Wr[0] = PMB_F5_DEBUG_REG;
+  mg_vPmbusXfer(au8Wr, 1u, au8Rd, 2u);
+  return (uint16)(au8Rd[0] | ((uint16)au8Rd[1] << 8));
+}
+
+static void mg_vPrintProf(const char *pcName, const SIM_S_PROF *psProf)
+{
+  uint64 u64Cnt = MAX(psProf->u64Cnt, 1u);
+
+  printf("%-16s %9llu %9llu %9llu %9llu %11llu %11llu\n", pcName,
+         (unsigned long long)psProf->u64Cnt,
+         (unsigned long long)psProf->u64NsMin,
+         (unsigned long long)(psProf->u64NsSum / u64Cnt),
+         (unsigned long long)psProf->u64NsMax,
+         (unsigned long long)(psProf->u64InstSum / u64Cnt),
+         (unsigned long long)psProf->u64InstMax);
+}
+
+/** *****************************************************************************
+ * \brief         Firmware slot profiler as read through PMB_F5_DEBUG_REG
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vPrintSchmProf(void)
+{
+  uint8 u8Slot;
+  uint8 u8Case;
+  char acName[32];
+
+  printf("\nFirmware slot profiler (0.1us)\n");
+  printf("%-16s %9s %9s %9s %9s\n", "slot", "min", "avg", "max", "overrun");
+  for (u8Slot = 0u; u8Slot < SCHM_SLOT_NUM; u8Slot++)
+  {
+    /* Firmware slots skip the dispatching cases of the report above */
+    u8Case = (uint8)((u8Slot / SCHM_SLOT_1MS_NUM) * SIM_CONF_BASE_SLOTS + (u8Slot % SCHM_SLOT_1MS_NUM));
+    mg_vSlotName(u8Case, acName, sizeof(acName));
+    printf("%-16s %9u %9u %9u %9u\n", acName,
+           (unsigned)SCHM_u16GetSlotProf(u8Slot, SCHM_E_PROF_MIN),
+           (unsigned)SCHM_u16GetSlotProf(u8Slot, SCHM_E_PROF_AVG),
+           (unsigned)SCHM_u16GetSlotProf(u8Slot, SCHM_E_PROF_MAX),
+           (unsigned)SCHM_u16GetSlotProf(u8Slot, SCHM_E_PROF_OVERRUN));
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Firmware PMBus write frame latency, last data byte to handled,
+ *                and the I2C interrupt run time, read through PMB_F5_DEBUG_REG
+ *                as on the hardware. The read frames count themselves.
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vPrintI2cLatency(void)
+{
+  printf("\nPMBus write frame latency (0.1us)\n");
+  printf("%-16s %9s %9s %9s %9s %9s\n", "", "min", "avg", "max", "deferred", "polled");
+  printf("%-16s %9u %9u %9u %9u %9u\n", "frames",
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_MIN),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_AVG),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_MAX),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_DEFERRED),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_POLLED));
+  printf("\nFirmware I2C interrupt run time (0.1us, host time stamp)\n");
+  printf("%-16s %9s %9s %9s\n", "", "max", "byte max", "over");
+  printf("%-16s %9u %9u %9u\n", "interrupts",
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_ISR_MAX),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_ISR_BYTE_MAX),
+         (unsigned)mg_u16ReadDebugReg(RTE_DEBUG_ADR_I2C_LAT_START + I2CPRT_E_LAT_ISR_OVER));
+}
+
+/*
+ * End of file
+ */
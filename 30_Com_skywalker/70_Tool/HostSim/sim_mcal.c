@@ -0,0 +1,766 @@
+/** *****************************************************************************
+ * \file    sim_mcal.c
+ * \brief   Simulated MCAL modules for the host build of the Com firmware
+ *
+ * \section AUTHOR
+ *    1. HDC Software Team
+ *
+ * \section SVN
+ *  $Date$
+ *  $Author$
+ *  $Revision$
+ *
+ * \section LICENSE
+ * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)
+ * All rights reserved.
+ ***************************************************************************** */
+
+/*
+ * This file replaces clock.c, timer.c, adc.c, uart.c, i2c.c, flash.c, rtc.c and
+ * eeprom.c in the host build. It implements the same public functions, so the
+ * SCHM_scfg_* hooks and all BSW/APPL modules link against the simulation
+ * without any change.
+ *
+ * Modules that only write peripheral registers (port.c, pwm.c, StdPeriphDriver.c
+ * and the register macros of i2cprt/port/timectrl) stay in the build. For them
+ * the STM32F0 memory windows are mapped as plain RAM at their real addresses.
+ */
+
+/*******************************************************************************
+ * Included header
+ ******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include <StdPeriphDriver.h>
+
+/* Module header */
+#define UART_EXPORT_H
+  #include "sim_api.h"
+  #include "sim_conf.h"
+  #include "adc_api.h"
+  #include "clock_api.h"
+  #include "timer_api.h"
+  #include "uart_api.h"
+  #include "uart_cfg.h"
+  #include "i2c_api.h"
+  #include "i2c_rte.h"
+  #include "i2cprt_cfg.h"
+  #include "flash_api.h"
+  #include "flash_conf.h"
+  #include "rtc_api.h"
+  #include "eeprom_api.h"
+  #include "eeprom_scb.h"
+  #include "eeprom_conf.h"
+
+/*******************************************************************************
+ * Local constants and macros (private to module)
+ ******************************************************************************/
+
+#define MG_UART_ISR_TC               ((uint8)0x40u)   /* USART_ISR_TC */
+#define MG_I2C_ISR_DIR               ((uint32)0x00010000u)
+
+/*******************************************************************************
+ * Local data types (private typedefs / structs / enums)
+ ******************************************************************************/
+
+typedef struct
+{
+  uint32 u32Base;
+  uint32 u32Size;
+} MG_S_WINDOW;
+
+/* Queued EEPROM request, see eeprom.c */
+typedef struct
+{
+  uint8 *pu8Data;
+  uint16 u16Addr;
+  uint16 u16Len;
+  EEPROM_pfvDone pfvDone;
+  uint8 u8Write;
+  uint8 au8Copy[EEPROM_CONF_REQ_COPY_SIZE];
+} MG_S_EEP_REQ;
+
+typedef struct
+{
+  uint32 u32TxCnt;
+  uint32 u32TxReadyTick;
+  uint8  u8RxData;
+} MG_S_UART;
+
+/*******************************************************************************
+ * Global data (public to other modules)
+ ******************************************************************************/
+
+/* Core registers of the host core_cmFunc.h */
+volatile uint32_t SIM_u32Primask = 1u;
+volatile uint32_t SIM_u32Control = 0u;
+volatile uint32_t SIM_u32Ipsr    = 0u;
+
+/* Same symbol as in flash.c */
+__IO uint32 FLASH_mg_u32Offset = 0U;
+
+/*******************************************************************************
+ * Local data (private to module)
+ ******************************************************************************/
+
+static const MG_S_WINDOW mg_asWindow[] =
+{
+  { SIM_CONF_FLASH_BASE,    SIM_CONF_FLASH_SIZE    },
+  { SIM_CONF_SYS_MEM_BASE,  SIM_CONF_SYS_MEM_SIZE  },
+  { SIM_CONF_APB_AHB1_BASE, SIM_CONF_APB_AHB1_SIZE },
+  { SIM_CONF_AHB2_BASE,     SIM_CONF_AHB2_SIZE     },
+  { SIM_CONF_SCS_BASE,      SIM_CONF_SCS_SIZE      }
+};
+
+static uint32    mg_u32Tick;
+static uint8     mg_u8TimerUpdateFlg;
+static uint64    mg_u64TickNs;
+static uint16    mg_au16AdcRaw[ADC_CFG_E_INDEX_COUNT];
+static MG_S_UART mg_asUart[UART_CFG_E_INDEX_COUNT];
+static uint8     mg_au8Eeprom[SIM_CONF_EEPROM_SIZE];
+static MG_S_EEP_REQ mg_asEepReq[EEPROM_CONF_REQ_NUM];
+static uint8     mg_u8EepReqHead;
+static uint8     mg_u8EepReqTail;
+static uint8     mg_u8EepSyncResult;
+
+/*******************************************************************************
+ * Local function prototypes (private to module)
+ ******************************************************************************/
+
+static void mg_vMapWindows(void);
+static void mg_vRtcUpdate(void);
+static void mg_vI2cRaise(uint32 u32Flags, SIM_S_PROF *psIsrProf, SIM_S_PROF *psEvtProf);
+static uint8 mg_u8Bcd(uint32 u32Val);
+static uint8 mg_u8EepQueue(uint8 u8Write, uint8* pu8Data, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone);
+static void mg_vEepSyncDone(EEPROM_E_RESULT eResult);
+
+/* Firmware interrupt handlers (i2cprt.c) */
+void I2CPRT_CFG_vI2cIsr(void);
+void I2CPRT_CFG_vDeferredIsr(void);
+
+/*******************************************************************************
+ * Global functions (public to other modules)
+ ******************************************************************************/
+
+/***************************************
+ * Simulation control
+ **************************************/
+void SIM_vInit(void)
+{
+  mg_vMapWindows();
+
+  /* Erased flash with the boot loader existing flag */
+  memset((void *)(uintptr_t)SIM_CONF_FLASH_BASE, 0xFF, SIM_CONF_FLASH_SIZE);
+  *(volatile uint32_t *)(uintptr_t)MG_BL_EXISTING_ADDR = MG_BL_EXISTING_FLG;
+
+  /* Virgin EEPROM */
+  memset(mg_au8Eeprom, 0xFF, sizeof(mg_au8Eeprom));
+
+  mg_au16AdcRaw[ADC_CFG_E_INDEX_PA0_AIN0_INTC]   = SIM_CONF_ADC_NTC_DEFAULT;
+  mg_au16AdcRaw[ADC_CFG_E_INDEX_PA1_AIN1_IntVsb] = SIM_CONF_ADC_INT_VSB_DEFAULT;
+  mg_au16AdcRaw[ADC_CFG_E_INDEX_PA5_AIN5_ExtVsb] = SIM_CONF_ADC_EXT_VSB_DEFAULT;
+  mg_au16AdcRaw[ADC_CFG_E_INDEX_PA6_AIN6_IVsb]   = SIM_CONF_ADC_I_VSB_DEFAULT;
+
+  mg_u32Tick = 0u;
+  mg_u8TimerUpdateFlg = FALSE;
+  memset(mg_asUart, 0, sizeof(mg_asUart));
+}
+
+void SIM_vTick(void)
+{
+  mg_u32Tick++;
+  mg_u8TimerUpdateFlg = TRUE;
+  mg_u64TickNs = SIM_u64NowNs();
+
+  /* I2C status flags are cleared by writing ICR */
+  I2C1->ISR &= ~I2C1->ICR;
+  I2C1->ICR = 0u;
+
+  if (0u == (mg_u32Tick % SIM_CONF_TICKS_PER_SEC))
+  {
+    mg_vRtcUpdate();
+  }
+}
+
+uint32 SIM_u32GetTick(void)
+{
+  return mg_u32Tick;
+}
+
+void SIM_vSetAdcRaw(uint8 u8Index, uint16 u16Val)
+{
+  if (u8Index < (uint8)ADC_CFG_E_INDEX_COUNT)
+  {
+    mg_au16AdcRaw[u8Index] = u16Val;
+  }
+}
+
+uint32 SIM_u32UartTxCnt(uint8 u8UartIndex)
+{
+  return mg_asUart[u8UartIndex].u32TxCnt;
+}
+
+uint8 SIM_u8PmbusAddr(void)
+{
+  return (uint8)(I2C1->OAR1 & 0xFEu);
+}
+
+void SIM_vPmbusTransfer(const uint8 *pu8Wr, uint8 u8WrLen, uint8 *pu8Rd, uint8 u8RdLen,
+                        SIM_S_PROF *psIsrProf, SIM_S_PROF *psTxProf)
+{
+  uint8 u8Cnt;
+
+  /* START + write address */
+  mg_vI2cRaise(I2C_ISR_ADDR, psIsrProf, NULL);
+
+  for (u8Cnt = 0u; u8Cnt < u8WrLen; u8Cnt++)
+  {
+    I2C1->RXDR = pu8Wr[u8Cnt];
+    mg_vI2cRaise(I2C_ISR_RXNE, psIsrProf, NULL);
+  }
+
+  if (0u != u8RdLen)
+  {
+    /* Repeated START + read address */
+    mg_vI2cRaise(I2C_ISR_ADDR | MG_I2C_ISR_DIR, psIsrProf, NULL);
+
+    for (u8Cnt = 0u; u8Cnt < u8RdLen; u8Cnt++)
+    {
+      mg_vI2cRaise(I2C_ISR_TXIS | MG_I2C_ISR_DIR, psIsrProf, psTxProf);
+      pu8Rd[u8Cnt] = (uint8)I2C1->TXDR;
+    }
+
+    /* The host NACKs the last byte it reads */
+    mg_vI2cRaise(I2C_ISR_NACKF | MG_I2C_ISR_DIR, psIsrProf, NULL);
+  }
+
+  /* STOP, raises the interrupt if enabled, otherwise the firmware polls it */
+  if (0u != (I2C1->CR1 & I2C_CR1_STOPIE))
+  {
+    mg_vI2cRaise(I2C_ISR_STOPF, psIsrProf, NULL);
+  }
+  else
+  {
+    I2C1->ISR = I2C_ISR_STOPF;
+    I2C1->ICR = 0u;
+  }
+}
+
+/***************************************
+ * CLOCK
+ **************************************/
+void CLOCK_vInit(void)
+{
+}
+
+void CLOCK_vDeInit(void)
+{
+}
+
+void SystemInit(void)
+{
+}
+
+void CLOCK_vSysCoreClkUpdate(void)
+{
+}
+
+/***************************************
+ * TIMER
+ **************************************/
+void TIMER_vInit(void)
+{
+  mg_u8TimerUpdateFlg = FALSE;
+}
+
+void TIMER_vDeInit(void)
+{
+}
+
+void TIMER_vClearUpdateFlg(TIMER_CFG_E_INDEX eTimerIndex)
+{
+  (void)eTimerIndex;
+  mg_u8TimerUpdateFlg = FALSE;
+}
+
+uint8 TIMER_u8GetUpdateFlg(TIMER_CFG_E_INDEX eTimerIndex)
+{
+  (void)eTimerIndex;
+  return mg_u8TimerUpdateFlg;
+}
+
+/* CPU cycles since the tick from the host clock, the simulated tick never overruns */
+uint16 TIMER_u16GetCounter(TIMER_CFG_E_INDEX eTimerIndex)
+{
+  uint64 u64Cnt = ((SIM_u64NowNs() - mg_u64TickNs) * (RTE_U32_CPU_CLK_FREQ / 1000000u)) / 1000u;
+
+  (void)eTimerIndex;
+  return (uint16)MIN(u64Cnt, (uint64)TIMER_CFG_TIMER_SCHM_PERIOD);
+}
+
+/* The host loop calls the idle loop once per due tick, WFE never waits */
+void TIMER_vEnableWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex)
+{
+  (void)eTimerIndex;
+}
+
+void TIMER_vClearWakeUpEvent(TIMER_CFG_E_INDEX eTimerIndex)
+{
+  (void)eTimerIndex;
+}
+
+/***************************************
+ * ADC
+ **************************************/
+void ADC_vInit(void)
+{
+}
+
+void ADC_vDeInit(void)
+{
+}
+
+void ADC_vReadRaw(ADC_CFG_E_INDEX eAdcIndex, uint16 *pu16AdcVal)
+{
+  *pu16AdcVal = mg_au16AdcRaw[eAdcIndex];
+}
+
+/***************************************
+ * UART
+ **************************************/
+void UART_vInit(void)
+{
+  memset(mg_asUart, 0, sizeof(mg_asUart));
+}
+
+void UART_vDeInit(void)
+{
+}
+
+uint8 UART_u8UartReadRxReg(uint8 u8UartIndex)
+{
+  return mg_asUart[u8UartIndex].u8RxData;
+}
+
+void UART_vUartWriteTxReg(uint8 u8UartIndex, uint8 u8TxData)
+{
+  (void)u8TxData;
+  mg_asUart[u8UartIndex].u32TxCnt++;
+  mg_asUart[u8UartIndex].u32TxReadyTick = mg_u32Tick + SIM_CONF_UART_BYTE_TICKS;
+}
+
+uint8 UART_u8UartReadTxEmptyFlg(uint8 u8UartIndex)
+{
+  return (mg_u32Tick >= mg_asUart[u8UartIndex].u32TxReadyTick) ? MG_UART_ISR_TC : 0u;
+}
+
+uint8 UART_u8UartReadRxIsrFlg(uint8 u8UartIndex)
+{
+  /* Same flag as uart.c */
+  return UART_u8UartReadTxEmptyFlg(u8UartIndex);
+}
+
+uint16 UART_u16UartReadBaudrate(uint8 u8UartIndex)
+{
+  return (uint16)UART_CFG_UART_SETUP[u8UartIndex].u32BaudRate;
+}
+
+void UART_vStartTxDma(uint8 u8UartIndex, const uint8 *pu8Data, uint16 u16Len)
+{
+  (void)pu8Data;
+  mg_asUart[u8UartIndex].u32TxCnt += u16Len;
+  mg_asUart[u8UartIndex].u32TxReadyTick = mg_u32Tick + (u16Len * SIM_CONF_UART_BYTE_TICKS);
+}
+
+uint16 UART_u16ReadTxDmaCnt(uint8 u8UartIndex)
+{
+  uint32 u32Bytes = 0u;
+
+  /* Bytes on the line, less the shift and the transmit data register */
+  if (mg_u32Tick < mg_asUart[u8UartIndex].u32TxReadyTick)
+  {
+    u32Bytes = (mg_asUart[u8UartIndex].u32TxReadyTick - mg_u32Tick + SIM_CONF_UART_BYTE_TICKS - 1u) / SIM_CONF_UART_BYTE_TICKS;
+  }
+  return (u32Bytes > 2u) ? (uint16)(u32Bytes - 2u) : 0u;
+}
+
+void UART_vStartRxDma(uint8 u8UartIndex, uint8 *pu8Buf, uint16 u16Size)
+{
+  /* Nothing is received */
+  (void)u8UartIndex;
+  (void)pu8Buf;
+  (void)u16Size;
+}
+
+uint16 UART_u16StopRxDma(uint8 u8UartIndex)
+{
+  (void)u8UartIndex;
+  return 0u;
+}
+
+/***************************************
+ * I2C
+ **************************************/
+void I2C_vInit(void)
+{
+  I2C1->OAR1 = I2C_OAR1_OA1EN | I2CPRT_CFG_BASE_SLA_ADR;
+  I2C1->ISR = I2C_ISR_TXE;
+}
+
+void I2C_vDeInit(void)
+{
+}
+
+void I2C_vI2cTimeOutHandler(void)
+{
+  /* The simulated bus lines never get stuck */
+  MONCTRL_RTE_Write_B_P_I2C_RESET_FLG(FALSE);
+}
+
+void I2C_vClearTimeoutCnt(uint8 u8Index)
+{
+  (void)u8Index;
+}
+
+void I2C_vDisableNvicInt(uint8 u8Index)
+{
+  (void)u8Index;
+}
+
+void I2C_vEnableNvicInt(uint8 u8Index)
+{
+  (void)u8Index;
+}
+
+/***************************************
+ * FLASH
+ **************************************/
+void FLASH_vInit(void)
+{
+}
+
+void FLASH_vDeInit(void)
+{
+}
+
+uint8 FLASH_u8ReadBlExistFlg(void)
+{
+  return (MG_BL_EXISTING_FLG == FLASH_u32ReadWordFlash(MG_BL_EXISTING_ADDR)) ? TRUE : FALSE;
+}
+
+uint32 FLASH_u32BootloaderFwVer(void)
+{
+  return FLASH_u32ReadWordFlash(MG_BL_FW_REV_ADDR);
+}
+
+uint8 FLASH_u8AppWr32(uint8* Buff, uint32 size)
+{
+  uint32 u32Addr = FLASH_mg_u32Offset + MG_APP_START_ADDR;
+
+  if (0U == (u32Addr & (MG_PAGE_SIZE - 1U)))
+  {
+    (void)FLASH_u8ErasePageFlash(u32Addr);
+  }
+  return FLASH_u8AppWr(u32Addr, Buff, size);
+}
+
+uint8 FLASH_u8AppWr(uint32 u32phyAddr, uint8* Buff, uint32 size)
+{
+  uint32 u32Idx;
+  volatile uint8 *pu8Dst = (volatile uint8 *)(uintptr_t)u32phyAddr;
+
+  if ((u32phyAddr < SIM_CONF_FLASH_BASE) || ((u32phyAddr + size) > (SIM_CONF_FLASH_BASE + SIM_CONF_FLASH_SIZE)))
+  {
+    return FLG_MOD_FAIL;
+  }
+  for (u32Idx = 0U; u32Idx < size; u32Idx++)
+  {
+    /* NOR flash: programming can only clear bits */
+    pu8Dst[u32Idx] &= Buff[u32Idx];
+  }
+  return FLG_MOD_OK;
+}
+
+uint16 FLASH_u16ReadHalfWordFlash(uint32 u32Addr)
+{
+  return *(volatile uint16_t *)(uintptr_t)u32Addr;
+}
+
+uint32 FLASH_u32ReadWordFlash(uint32 u32Addr)
+{
+  return *(volatile uint32_t *)(uintptr_t)u32Addr;
+}
+
+uint8 FLASH_u8WriteHalfWordFlash(uint32 u32Addr, uint16 u16Data)
+{
+  uint8 au8Data[2];
+
+  au8Data[0] = LOBYTE(u16Data);
+  au8Data[1] = HIBYTE(u16Data);
+  return FLASH_u8AppWr(u32Addr, au8Data, 2U);
+}
+
+uint8 FLASH_u8WriteWordFlash(uint32 u32Addr, uint32 u32Data)
+{
+  uint8 au8Data[4];
+
+  au8Data[0] = (uint8)u32Data;
+  au8Data[1] = (uint8)(u32Data >> 8);
+  au8Data[2] = (uint8)(u32Data >> 16);
+  au8Data[3] = (uint8)(u32Data >> 24);
+  return FLASH_u8AppWr(u32Addr, au8Data, 4U);
+}
+
+uint8 FLASH_u8ErasePageFlash(uint32 u32Addr)
+{
+  u32Addr &= ~(SIM_CONF_FLASH_PAGE_SIZE - 1U);
+  if ((u32Addr < SIM_CONF_FLASH_BASE) || (u32Addr >= (SIM_CONF_FLASH_BASE + SIM_CONF_FLASH_SIZE)))
+  {
+    return FLG_MOD_FAIL;
+  }
+  memset((void *)(uintptr_t)u32Addr, 0xFF, SIM_CONF_FLASH_PAGE_SIZE);
+  return FLG_MOD_OK;
+}
+
+void FLASH_vRemapVectorTable(void)
+{
+}
+
+/***************************************
+ * RTC
+ **************************************/
+void RTC_vInit(void)
+{
+  RTC->TR = 0u;
+}
+
+void RTC_vDeInit(void)
+{
+}
+
+/***************************************
+ * EEPROM (M24C512 on I2C2)
+ **************************************/
+void EEPROM_vInit(void)
+{
+  mg_u8EepReqHead = 0u;
+  mg_u8EepReqTail = 0u;
+}
+
+void EEPROM_vDeInit(void)
+{
+}
+
+/* One request per 1ms call, as the I2C2 engine needs a few ms for a page write */
+void EEPROM_vTask(void)
+{
+  MG_S_EEP_REQ *psReq;
+  EEPROM_E_RESULT eResult = EEPROM_E_RESULT_OK;
+
+  if (mg_u8EepReqHead == mg_u8EepReqTail)
+  {
+    return;
+  }
+  psReq = &mg_asEepReq[mg_u8EepReqTail];
+  if (((uint32)psReq->u16Addr + psReq->u16Len) > SIM_CONF_EEPROM_SIZE)
+  {
+    eResult = EEPROM_E_RESULT_NACK;
+  }
+  else if (FALSE != psReq->u8Write)
+  {
+    memcpy(&mg_au8Eeprom[psReq->u16Addr], psReq->pu8Data, psReq->u16Len);
+  }
+  else
+  {
+    memcpy(psReq->pu8Data, &mg_au8Eeprom[psReq->u16Addr], psReq->u16Len);
+  }
+  mg_u8EepReqTail = (uint8)((mg_u8EepReqTail + 1u) & EEPROM_CONF_REQ_MASK);
+  if (NULL != psReq->pfvDone)
+  {
+    psReq->pfvDone(eResult);
+  }
+}
+
+uint8 EEPROM_u8QueueRead(uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  return mg_u8EepQueue(FALSE, pu8Buffer, u16Addr, u16Len, pfvDone);
+}
+
+uint8 EEPROM_u8QueueWrite(const uint8* pu8Buffer, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  return mg_u8EepQueue(TRUE, (uint8*)pu8Buffer, u16Addr, u16Len, pfvDone);
+}
+
+uint8 EEPROM_u8GetFreeReq(void)
+{
+  return (uint8)((mg_u8EepReqTail - mg_u8EepReqHead - 1u) & EEPROM_CONF_REQ_MASK);
+}
+
+uint8 EEPROM_u8IsIdle(void)
+{
+  return (uint8)(mg_u8EepReqHead == mg_u8EepReqTail);
+}
+
+uint32 EEPROM_u32ReadBuffer(uint8* pBuffer, uint16 ReadAddr, uint16 NumByteToRead)
+{
+  mg_u8EepSyncResult = 0xFFu;
+  if (FALSE == EEPROM_u8QueueRead(pBuffer, ReadAddr, NumByteToRead, mg_vEepSyncDone))
+  {
+    return EEPROM_CONF_FAIL;
+  }
+  while (0xFFu == mg_u8EepSyncResult)
+  {
+    EEPROM_vTask();
+  }
+  return (EEPROM_E_RESULT_OK == mg_u8EepSyncResult) ? EEPROM_CONF_OK : EEPROM_CONF_FAIL;
+}
+
+uint32 EEPROM_u32WriteBuffer(const uint8* pBuffer, uint16 WriteAddr, uint16 NumByteToWrite)
+{
+  mg_u8EepSyncResult = 0xFFu;
+  if (FALSE == EEPROM_u8QueueWrite(pBuffer, WriteAddr, NumByteToWrite, mg_vEepSyncDone))
+  {
+    return EEPROM_CONF_FAIL;
+  }
+  while (0xFFu == mg_u8EepSyncResult)
+  {
+    EEPROM_vTask();
+  }
+  return (EEPROM_E_RESULT_OK == mg_u8EepSyncResult) ? EEPROM_CONF_OK : EEPROM_CONF_FAIL;
+}
+
+/*******************************************************************************
+ * Local functions (private to module)
+ ******************************************************************************/
+
+/** *****************************************************************************
+ * \brief         Map the STM32 memory windows as RAM at their real addresses
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vMapWindows(void)
+{
+  uint8 u8Idx;
+  void *pvMem;
+
+  for (u8Idx = 0u; u8Idx < DIM(mg_asWindow); u8Idx++)
+  {
+    pvMem = mmap((void *)(uintptr_t)mg_asWindow[u8Idx].u32Base, mg_asWindow[u8Idx].u32Size,
+                 PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (pvMem != (void *)(uintptr_t)mg_asWindow[u8Idx].u32Base)
+    {
+      fprintf(stderr, "sim: cannot map 0x%08lX (+0x%lX)\n",
+              (unsigned long)mg_asWindow[u8Idx].u32Base, (unsigned long)mg_asWindow[u8Idx].u32Size);
+      exit(EXIT_FAILURE);
+    }
+  }
+}
+
+/** *****************************************************************************
+ * \brief         Count the RTC time register (BCD hh:mm:ss) one second up
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vRtcUpdate(void)
+{
+  uint32 u32Sec = mg_u32Tick / SIM_CONF_TICKS_PER_SEC;
+
+  RTC->TR = ((uint32)mg_u8Bcd((u32Sec / 3600u) % 24u) << 16)
+          | ((uint32)mg_u8Bcd((u32Sec / 60u) % 60u) << 8)
+          | (uint32)mg_u8Bcd(u32Sec % 60u);
+}
+
+static uint8 mg_u8Bcd(uint32 u32Val)
+{
+  return (uint8)(((u32Val / 10u) << 4) | (u32Val % 10u));
+}
+
+/** *****************************************************************************
+ * \brief         Add an EEPROM request, short writes are copied like eeprom.c
+ *
+ * \return        TRUE if queued
+ *
+ ***************************************************************************** */
+static uint8 mg_u8EepQueue(uint8 u8Write, uint8* pu8Data, uint16 u16Addr, uint16 u16Len, EEPROM_pfvDone pfvDone)
+{
+  MG_S_EEP_REQ *psReq = &mg_asEepReq[mg_u8EepReqHead];
+  uint8 u8Next = (uint8)((mg_u8EepReqHead + 1u) & EEPROM_CONF_REQ_MASK);
+
+  if ((u8Next == mg_u8EepReqTail) || (0u == u16Len))
+  {
+    return FALSE;
+  }
+  psReq->u8Write = u8Write;
+  psReq->u16Addr = u16Addr;
+  psReq->u16Len = u16Len;
+  psReq->pfvDone = pfvDone;
+  psReq->pu8Data = pu8Data;
+  if ((FALSE != u8Write) && (u16Len <= EEPROM_CONF_REQ_COPY_SIZE))
+  {
+    memcpy(psReq->au8Copy, pu8Data, u16Len);
+    psReq->pu8Data = psReq->au8Copy;
+  }
+  mg_u8EepReqHead = u8Next;
+  return TRUE;
+}
+
+static void mg_vEepSyncDone(EEPROM_E_RESULT eResult)
+{
+  mg_u8EepSyncResult = (uint8)eResult;
+}
+
+/** *****************************************************************************
+ * \brief         Raise I2C1 events and run the I2C1 interrupt handler once,
+ *                followed by PendSV if the handler has pended it
+ *
+ * \param[in]     u32Flags   ISR register flags of the event
+ * \param[in,out] psIsrProf  Run time of the ISR entry is added here, may be NULL
+ *
+ * \return        -
+ *
+ ***************************************************************************** */
+static void mg_vI2cRaise(uint32 u32Flags, SIM_S_PROF *psIsrProf, SIM_S_PROF *psEvtProf)
+{
+  uint64 u64Ns;
+  uint64 u64Inst;
+
+  I2C1->ISR = u32Flags;
+  I2C1->ICR = 0u;
+
+  u64Inst = SIM_u64NowInst();
+  u64Ns = SIM_u64NowNs();
+  I2CPRT_CFG_vI2cIsr();
+  u64Ns = SIM_u64NowNs() - u64Ns;
+  u64Inst = SIM_u64NowInst() - u64Inst;
+
+  if (NULL != psIsrProf)
+  {
+    SIM_vProfAdd(psIsrProf, u64Ns, u64Inst);
+  }
+  if (NULL != psEvtProf)
+  {
+    SIM_vProfAdd(psEvtProf, u64Ns, u64Inst);
+  }
+
+  I2C1->ISR &= ~I2C1->ICR;
+  I2C1->ICR = 0u;
+
+  /* Lowest priority exception, tail chained after the I2C interrupt */
+  if (0u != (SCB->ICSR & SCB_ICSR_PENDSVSET_Msk))
+  {
+    SCB->ICSR = 0u;
+    I2CPRT_CFG_vDeferredIsr();
+    I2C1->ISR &= ~I2C1->ICR;
+    I2C1->ICR = 0u;
+  }
+}
+
+/*
+ * End of file
+ */
@@ -0,0 +1,857 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+typedef signed char sint8;
+typedef unsigned char uint8;
+typedef signed short int sint16;   /* Add for 32bit MCU */
+typedef unsigned short int uint16; /* Add for 32bit MCU */
+typedef signed long sint32;
+typedef unsigned long uint32;
+
+/*
+Inter-MCU frame codec generator
+
+  intcom_frm_gen [-s intcom_frm.txt] <mcu> <intcom_frm.h>
+
+  e.g. intcom_frm_gen com ../30_Com_skywalker/40_Appl/intcom/intcom_frm.h
+       intcom_frm_gen sec ../20_Secondary_skywalker/40_Appl/intcom/intcom_frm.h
+       intcom_frm_gen pri <primary>/40_Appl/intcom/intcom_frm.h
+
+Reads the frame schema (intcom_frm.txt, see there) and writes the intcom_frm.h
+of one MCU (com, pri, sec): the layout struct of every frame the MCU sends or
+receives, the pack function of the frames it sends and the unpack function of
+the frames it receives. Generate the header of all MCUs after a schema change.
+
+The payload is little endian as the MCUs. If every field of a frame is at a
+payload offset aligned to its size, the struct has the payload layout: the
+pack and unpack functions are a bounded copy. Otherwise the fields are packed
+and unpacked byte by byte (a warning is printed).
+
+Payload byte 0 is the header: layout version (bits 0..3), keyframe sequence
+(bits 4..6) and the delta flag (bit 7). A frame with "delta <n>" in the schema
+(aligned frames only) also gets a delta pack and unpack function: every n-th
+frame is a keyframe with the full payload, the frames between carry a bitmap
+of the fields changed since the keyframe and only those fields. The receiver
+applies a delta only on the keyframe of the same sequence it holds.
+*/
+
+#define MAX_FRAME       8
+#define MAX_FIELD       64
+#define MAX_NAME        32
+#define MAX_TEXT        96
+#define MAX_PAYLOAD     122u    /* MG_TX_BUF_SIZE 128 - STX, ADDR, LEN, STATUS - CRC16 */
+#define MAX_VERSION     15      /* Header bits 0..3 */
+
+typedef enum
+{
+  TYPE_U8 = 0,
+  TYPE_U16,
+  TYPE_S16
+} TYPE_E;
+
+typedef struct
+{
+  uint8 u8Type;
+  uint8 u8Num;
+  uint8 u8Append;
+  uint16 u16Ofs;        /* payload offset */
+  char acName[MAX_NAME];
+  char acScale[MAX_NAME];
+  char acDesc[MAX_TEXT];
+} FIELD_T;
+
+typedef struct
+{
+  char acName[MAX_NAME];   /* COM2PRI */
+  char acFunc[MAX_NAME];   /* Com2Pri */
+  char acSrc[MAX_NAME];
+  char acDst[MAX_NAME];
+  char acDesc[MAX_TEXT];
+  FIELD_T asField[MAX_FIELD];
+  uint8 u8FieldNum;
+  uint16 u16Len;
+  uint16 u16MinLen;
+  uint8 u8Overlay;
+  uint8 u8KeyPeriod;       /* delta mode: keyframe every n-th frame, 0 = off */
+} FRAME_T;
+
+static FRAME_T asFrame[MAX_FRAME];
+static uint8 u8FrameNum;
+static uint16 u16Version = 0xFFFFu;
+
+static const char *const apcType[] = { "uint8", "uint16", "sint16" };
+static const uint8 au8TypeSize[] = { 1u, 2u, 2u };
+
+static const char *pcMcuName(const char *pcMcu)
+{
+  if (0 == strcmp(pcMcu, "com"))
+  {
+    return "Com";
+  }
+  if (0 == strcmp(pcMcu, "pri"))
+  {
+    return "primary";
+  }
+  return "secondary";
+}
+
+/* u16CpuLoad -> CPU_LOAD */
+static void vMacroName(const char *pcName, char *pcOut)
+{
+  while ((*pcName != '\0') && !isupper((unsigned char)*pcName))
+  {
+    pcName++;
+  }
+  while (*pcName != '\0')
+  {
+    if (isupper((unsigned char)pcName[0]) && (pcOut[-1] != '\0') && islower((unsigned char)pcName[-1]))
+    {
+      *pcOut++ = '_';
+    }
+    *pcOut++ = (char)toupper((unsigned char)*pcName++);
+  }
+  *pcOut = '\0';
+}
+
+/* COM2PRI -> Com2Pri */
+static void vFuncName(const char *pcName, char *pcOut)
+{
+  uint8 u8Up = 1u;
+
+  while (*pcName != '\0')
+  {
+    *pcOut++ = u8Up ? (char)toupper((unsigned char)*pcName) : (char)tolower((unsigned char)*pcName);
+    u8Up = isdigit((unsigned char)*pcName) ? 1u : 0u;
+    pcName++;
+  }
+  *pcOut = '\0';
+}
+
+static int iParseType(const char *pcType)
+{
+  if (0 == strcmp(pcType, "u8"))
+  {
+    return TYPE_U8;
+  }
+  if (0 == strcmp(pcType, "u16"))
+  {
+    return TYPE_U16;
+  }
+  if (0 == strcmp(pcType, "s16"))
+  {
+    return TYPE_S16;
+  }
+  return -1;
+}
+
+static int iReadSchema(const char *pcFile)
+{
+  FILE *pF;
+  char acLine[256];
+  char acKey[MAX_NAME];
+  char acType[MAX_NAME];
+  int iNum;
+  int iPos;
+  int iLine = 0;
+  int iType;
+  uint8 i;
+  FRAME_T *psFrm = NULL;
+  FIELD_T *psFld;
+
+  pF = fopen(pcFile, "r");
+  if (NULL == pF)
+  {
+    fprintf(stderr, "cannot open %s\n", pcFile);
+    return -1;
+  }
+
+  while (NULL != fgets(acLine, sizeof(acLine), pF))
+  {
+    iLine++;
+    acLine[strcspn(acLine, "#\r\n")] = '\0';
+    if (1 != sscanf(acLine, "%31s", acKey))
+    {
+      continue;
+    }
+
+    if (0 == strcmp(acKey, "version"))
+    {
+      if ((1 != sscanf(acLine, "%*s %d", &iNum)) || (iNum < 0) || (iNum > MAX_VERSION))
+      {
+        fprintf(stderr, "%s:%d: version 0 .. %d\n", pcFile, iLine, MAX_VERSION);
+        return -1;
+      }
+      u16Version = (uint16)iNum;
+    }
+    else if (0 == strcmp(acKey, "frame"))
+    {
+      if (u8FrameNum >= MAX_FRAME)
+      {
+        fprintf(stderr, "%s:%d: too many frames\n", pcFile, iLine);
+        return -1;
+      }
+      psFrm = &asFrame[u8FrameNum++];
+      memset(psFrm, 0, sizeof(*psFrm));
+      iPos = 0;
+      if (3 != sscanf(acLine, "%*s %31s %31s %31s %n", psFrm->acName, psFrm->acSrc, psFrm->acDst, &iPos))
+      {
+        fprintf(stderr, "%s:%d: frame <name> <source> <destination> <description>\n", pcFile, iLine);
+        return -1;
+      }
+      strncpy(psFrm->acDesc, &acLine[iPos], MAX_TEXT - 1);
+      vFuncName(psFrm->acName, psFrm->acFunc);
+
+      /* Layout version first */
+      psFld = &psFrm->asField[psFrm->u8FieldNum++];
+      psFld->u8Type = TYPE_U8;
+      psFld->u8Num = 1u;
+      strcpy(psFld->acName, "u8Hdr");
+      strcpy(psFld->acScale, "-");
+      strcpy(psFld->acDesc, "Header: layout version, keyframe sequence, delta flag");
+      psFrm->u16Len = 1u;
+      psFrm->u16MinLen = 1u;
+      psFrm->u8Overlay = 1u;
+    }
+    else if (0 == strcmp(acKey, "delta"))
+    {
+      if ((NULL == psFrm) || (1 != sscanf(acLine, "%*s %d", &iNum)) || (iNum < 2) || (iNum > 255))
+      {
+        fprintf(stderr, "%s:%d: delta <keyframe period 2 .. 255> after a frame\n", pcFile, iLine);
+        return -1;
+      }
+      psFrm->u8KeyPeriod = (uint8)iNum;
+    }
+    else if ((0 == strcmp(acKey, "field")) || (0 == strcmp(acKey, "append")))
+    {
+      if (NULL == psFrm)
+      {
+        fprintf(stderr, "%s:%d: field before frame\n", pcFile, iLine);
+        return -1;
+      }
+      if (psFrm->u8FieldNum >= MAX_FIELD)
+      {
+        fprintf(stderr, "%s:%d: too many fields\n", pcFile, iLine);
+        return -1;
+      }
+      psFld = &psFrm->asField[psFrm->u8FieldNum];
+      memset(psFld, 0, sizeof(*psFld));
+      iPos = 0;
+      if ((4 != sscanf(acLine, "%*s %31s %d %31s %31s %n", acType, &iNum, psFld->acName, psFld->acScale, &iPos)) ||
+          (iNum < 1) || (iNum > 64))
+      {
+        fprintf(stderr, "%s:%d: %s <type> <count 1 .. 64> <name> <scale> <description>\n", pcFile, iLine, acKey);
+        return -1;
+      }
+      iType = iParseType(acType);
+      if (iType < 0)
+      {
+        fprintf(stderr, "%s:%d: type %s is not u8, u16 or s16\n", pcFile, iLine, acType);
+        return -1;
+      }
+      for (i = 0; i < psFrm->u8FieldNum; i++)
+      {
+        if (0 == strcmp(psFrm->asField[i].acName, psFld->acName))
+        {
+          fprintf(stderr, "%s:%d: %s twice in %s\n", pcFile, iLine, psFld->acName, psFrm->acName);
+          return -1;
+        }
+      }
+      psFld->u8Append = (0 == strcmp(acKey, "append")) ? 1u : 0u;
+      if ((0u == psFld->u8Append) && (psFrm->u16MinLen != psFrm->u16Len))
+      {
+        fprintf(stderr, "%s:%d: field %s after an append field\n", pcFile, iLine, psFld->acName);
+        return -1;
+      }
+      strncpy(psFld->acDesc, &acLine[iPos], MAX_TEXT - 1);
+      psFld->u8Type = (uint8)iType;
+      psFld->u8Num = (uint8)iNum;
+      psFld->u16Ofs = psFrm->u16Len;
+      if (0u != (psFld->u16Ofs % au8TypeSize[iType]))
+      {
+        psFrm->u8Overlay = 0u;
+      }
+      psFrm->u16Len += (uint16)(au8TypeSize[iType] * iNum);
+      if (0u == psFld->u8Append)
+      {
+        psFrm->u16MinLen = psFrm->u16Len;
+      }
+      if (psFrm->u16Len > MAX_PAYLOAD)
+      {
+        fprintf(stderr, "%s:%d: %s payload above %u bytes\n", pcFile, iLine, psFrm->acName, MAX_PAYLOAD);
+        return -1;
+      }
+      psFrm->u8FieldNum++;
+    }
+    else
+    {
+      fprintf(stderr, "%s:%d: unknown %s\n", pcFile, iLine, acKey);
+      return -1;
+    }
+  }
+  fclose(pF);
+
+  if (0xFFFFu == u16Version)
+  {
+    fprintf(stderr, "%s: no version\n", pcFile);
+    return -1;
+  }
+
+  /* The struct ends with its alignment, no tail padding allowed either */
+  for (i = 0; i < u8FrameNum; i++)
+  {
+    uint8 j;
+
+    for (j = 0; j < asFrame[i].u8FieldNum; j++)
+    {
+      if ((asFrame[i].asField[j].u8Type != TYPE_U8) && (0u != (asFrame[i].u16Len & 1u)))
+      {
+        asFrame[i].u8Overlay = 0u;
+      }
+    }
+    if (0u == asFrame[i].u8Overlay)
+    {
+      if (0u != asFrame[i].u8KeyPeriod)
+      {
+        fprintf(stderr, "%s: delta mode needs the aligned layout\n", asFrame[i].acName);
+        return -1;
+      }
+      fprintf(stderr, "warning: %s is not aligned, packed byte by byte\n", asFrame[i].acName);
+    }
+  }
+  return 0;
+}
+
+static void vPrintStruct(FILE *pF, const FRAME_T *psFrm)
+{
+  const FIELD_T *psFld;
+  char acDecl[MAX_NAME * 2];
+  uint8 i;
+
+  fprintf(pF, "/* %s: %s, %s -> %s */\n", psFrm->acName, psFrm->acDesc,
+          pcMcuName(psFrm->acSrc), pcMcuName(psFrm->acDst));
+  fprintf(pF, "typedef struct INTCOM_FRM_S_%s_\n{\n", psFrm->acName);
+  for (i = 0; i < psFrm->u8FieldNum; i++)
+  {
+    psFld = &psFrm->asField[i];
+    if (psFld->u8Num > 1u)
+    {
+      sprintf(acDecl, "%s[%u];", psFld->acName, psFld->u8Num);
+    }
+    else
+    {
+      sprintf(acDecl, "%s;", psFld->acName);
+    }
+    fprintf(pF, "  %-7s%-20s/* %3u: ", apcType[psFld->u8Type], acDecl, psFld->u16Ofs);
+    if (0 != strcmp(psFld->acScale, "-"))
+    {
+      fprintf(pF, "(%s) ", psFld->acScale);
+    }
+    fprintf(pF, "%s%s */\n", psFld->acDesc, psFld->u8Append ? ", appended" : "");
+  }
+  fprintf(pF, "} INTCOM_FRM_S_%s;\n\n", psFrm->acName);
+}
+
+static void vPrintDefines(FILE *pF, const FRAME_T *psFrm)
+{
+  const FIELD_T *psFld;
+  char acMacro[MAX_NAME * 2];
+  char acDef[MAX_NAME * 3];
+  uint8 i;
+
+  sprintf(acDef, "INTCOM_FRM_U16_%s_LEN", psFrm->acName);
+  fprintf(pF, "#define %-40s %3uU   /* Payload bytes */\n", acDef, psFrm->u16Len);
+  sprintf(acDef, "INTCOM_FRM_U16_%s_MIN_LEN", psFrm->acName);
+  fprintf(pF, "#define %-40s %3uU   /* Payload bytes without the appended fields */\n", acDef, psFrm->u16MinLen);
+  for (i = 0; i < psFrm->u8FieldNum; i++)
+  {
+    psFld = &psFrm->asField[i];
+    if (psFld->u8Append)
+    {
+      acMacro[0] = '\0';
+      vMacroName(psFld->acName, &acMacro[1]);
+      sprintf(acDef, "INTCOM_FRM_U16_%s_END_%s", psFrm->acName, &acMacro[1]);
+      fprintf(pF, "#define %-40s %3uU   /* %s received */\n", acDef,
+              psFld->u16Ofs + au8TypeSize[psFld->u8Type] * psFld->u8Num, psFld->acName);
+    }
+  }
+  if (psFrm->u8Overlay)
+  {
+    fprintf(pF, "\n/* The struct has the payload layout */\n");
+    fprintf(pF, "typedef uint8 INTCOM_FRM_au8%sLenChk[(sizeof(INTCOM_FRM_S_%s) == INTCOM_FRM_U16_%s_LEN) ? 1 : -1];\n",
+            psFrm->acFunc, psFrm->acName, psFrm->acName);
+  }
+  fprintf(pF, "\n");
+}
+
+static void vPrintHeader(FILE *pF, const char *pcBrief, const char *pcIn, const char *pcInOut, const char *pcOut)
+{
+  fprintf(pF, "/** *****************************************************************************\n");
+  fprintf(pF, " * \\brief         %s\n", pcBrief);
+  fprintf(pF, " *\n");
+  fprintf(pF, " * \\param[in]     %s\n", pcIn);
+  fprintf(pF, " * \\param[in,out] %s\n", pcInOut);
+  fprintf(pF, " * \\param[out]    %s\n", pcOut);
+  fprintf(pF, " *\n");
+}
+
+static void vPrintPack(FILE *pF, const FRAME_T *psFrm)
+{
+  const FIELD_T *psFld;
+  uint8 i;
+  uint8 j;
+
+  vPrintHeader(pF, "Append the payload to the TX buffer",
+               "-",
+               "psFrm         - payload, the fields filled, the version is set here\n"
+               " *                pu16TxDataNbr - bytes in the TX buffer",
+               "pau8TxBuf     - TX buffer");
+  fprintf(pF, " * \\return        -\n *\n");
+  fprintf(pF, " ***************************************************************************** */\n");
+  fprintf(pF, "static inline void INTCOM_FRM_vPack%s(INTCOM_FRM_S_%s *psFrm, uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)\n{\n",
+          psFrm->acFunc, psFrm->acName);
+  if (psFrm->u8Overlay)
+  {
+    fprintf(pF, "  const uint8 *pu8Src = (const uint8 *)psFrm;\n");
+    fprintf(pF, "  uint16 u16Idx;\n\n");
+    fprintf(pF, "  psFrm->u8Hdr = INTCOM_FRM_U8_VER;\n");
+    fprintf(pF, "  for (u16Idx = 0U; u16Idx < INTCOM_FRM_U16_%s_LEN; u16Idx++)\n  {\n", psFrm->acName);
+    fprintf(pF, "    pau8TxBuf[(*pu16TxDataNbr)++] = pu8Src[u16Idx];\n  }\n");
+  }
+  else
+  {
+    fprintf(pF, "  psFrm->u8Hdr = INTCOM_FRM_U8_VER;\n");
+    for (i = 0; i < psFrm->u8FieldNum; i++)
+    {
+      psFld = &psFrm->asField[i];
+      for (j = 0; j < psFld->u8Num; j++)
+      {
+        char acRef[MAX_NAME + 8];
+
+        if (psFld->u8Num > 1u)
+        {
+          sprintf(acRef, "%s[%u]", psFld->acName, j);
+        }
+        else
+        {
+          strcpy(acRef, psFld->acName);
+        }
+        if (TYPE_U8 == psFld->u8Type)
+        {
+          fprintf(pF, "  pau8TxBuf[(*pu16TxDataNbr)++] = psFrm->%s;\n", acRef);
+        }
+        else
+        {
+          fprintf(pF, "  pau8TxBuf[(*pu16TxDataNbr)++] = (uint8)((uint16)psFrm->%s);\n", acRef);
+          fprintf(pF, "  pau8TxBuf[(*pu16TxDataNbr)++] = (uint8)((uint16)psFrm->%s >> 8U);\n", acRef);
+        }
+      }
+    }
+  }
+  fprintf(pF, "}\n\n");
+}
+
+static void vPrintUnpack(FILE *pF, const FRAME_T *psFrm)
+{
+  const FIELD_T *psFld;
+  uint8 i;
+  uint8 j;
+
+  vPrintHeader(pF, "Decode the payload of a received frame",
+               "pau8Data - payload, the byte after the status byte\n"
+               " *                u16Len   - payload bytes (LEN - 1)",
+               "-",
+               "psFrm    - payload fields");
+  fprintf(pF, " * \\return        Payload bytes decoded, 0 if the frame is too short or of\n");
+  fprintf(pF, " *                another layout version (psFrm not written)\n *\n");
+  fprintf(pF, " ***************************************************************************** */\n");
+  fprintf(pF, "static inline uint16 INTCOM_FRM_u16Unpack%s(const uint8 *pau8Data, uint16 u16Len, INTCOM_FRM_S_%s *psFrm)\n{\n",
+          psFrm->acFunc, psFrm->acName);
+  if (psFrm->u8Overlay)
+  {
+    fprintf(pF, "  uint8 *pu8Dst = (uint8 *)psFrm;\n");
+    fprintf(pF, "  uint16 u16Idx;\n\n");
+  }
+  fprintf(pF, "  if ((u16Len < INTCOM_FRM_U16_%s_MIN_LEN) ||\n", psFrm->acName);
+  fprintf(pF, "      (INTCOM_FRM_U8_VER != (pau8Data[0] & (INTCOM_FRM_U8_VER_MASK | INTCOM_FRM_U8_DELTA))))\n");
+  fprintf(pF, "  {\n    return 0U;\n  }\n");
+  fprintf(pF, "  if (u16Len > INTCOM_FRM_U16_%s_LEN)\n", psFrm->acName);
+  fprintf(pF, "  {\n    u16Len = INTCOM_FRM_U16_%s_LEN;\n  }\n\n", psFrm->acName);
+
+  if (psFrm->u8Overlay)
+  {
+    fprintf(pF, "  for (u16Idx = 0U; u16Idx < u16Len; u16Idx++)\n  {\n");
+    fprintf(pF, "    pu8Dst[u16Idx] = pau8Data[u16Idx];\n  }\n");
+    if (psFrm->u16MinLen != psFrm->u16Len)
+    {
+      fprintf(pF, "  for (; u16Idx < INTCOM_FRM_U16_%s_LEN; u16Idx++) /* Appended fields not received */\n  {\n",
+              psFrm->acName);
+      fprintf(pF, "    pu8Dst[u16Idx] = 0U;\n  }\n");
+    }
+  }
+  else
+  {
+    for (i = 0; i < psFrm->u8FieldNum; i++)
+    {
+      const char *pcInd = "  ";
+
+      psFld = &psFrm->asField[i];
+      if (psFld->u8Append)
+      {
+        fprintf(pF, "  if (u16Len >= %uU)\n  {\n", psFld->u16Ofs + au8TypeSize[psFld->u8Type] * psFld->u8Num);
+        pcInd = "    ";
+      }
+      for (j = 0; j < psFld->u8Num; j++)
+      {
+        char acRef[MAX_NAME + 8];
+        uint16 u16Ofs = psFld->u16Ofs + au8TypeSize[psFld->u8Type] * j;
+
+        if (psFld->u8Num > 1u)
+        {
+          sprintf(acRef, "%s[%u]", psFld->acName, j);
+        }
+        else
+        {
+          strcpy(acRef, psFld->acName);
+        }
+        if (TYPE_U8 == psFld->u8Type)
+        {
+          fprintf(pF, "%spsFrm->%s = pau8Data[%uU];\n", pcInd, acRef, u16Ofs);
+        }
+        else
+        {
+          fprintf(pF, "%spsFrm->%s = (%s)((uint16)pau8Data[%uU] | ((uint16)pau8Data[%uU] << 8U));\n",
+                  pcInd, acRef, apcType[psFld->u8Type], u16Ofs, u16Ofs + 1u);
+        }
+      }
+      if (psFld->u8Append)
+      {
+        fprintf(pF, "  }\n  else\n  {\n");
+        for (j = 0; j < psFld->u8Num; j++)
+        {
+          if (psFld->u8Num > 1u)
+          {
+            fprintf(pF, "    psFrm->%s[%u] = 0U;\n", psFld->acName, j);
+          }
+          else
+          {
+            fprintf(pF, "    psFrm->%s = 0U;\n", psFld->acName);
+          }
+        }
+        fprintf(pF, "  }\n");
+      }
+    }
+  }
+  fprintf(pF, "  return u16Len;\n}\n\n");
+}
+
+static void vPrintDeltaTypes(FILE *pF, const FRAME_T *psFrm, uint8 u8Tx, uint8 u8Rx)
+{
+  char acDef[MAX_NAME * 3];
+  char acKey[MAX_NAME * 2];
+  int iWidth;
+  uint8 i;
+
+  sprintf(acKey, "INTCOM_FRM_S_%s sKey;", psFrm->acName);
+  iWidth = (int)strlen(acKey) + 2;
+  sprintf(acDef, "INTCOM_FRM_U8_%s_KEY_PERIOD", psFrm->acName);
+  fprintf(pF, "#define %-40s %3uU   /* Every n-th frame is a keyframe */\n", acDef, psFrm->u8KeyPeriod);
+  sprintf(acDef, "INTCOM_FRM_U8_%s_FIELD_NUM", psFrm->acName);
+  fprintf(pF, "#define %-40s %3uU   /* Fields after the header, bits of the bitmap */\n\n", acDef,
+          psFrm->u8FieldNum - 1u);
+
+  fprintf(pF, "/* Payload offset of each field and the payload end */\n");
+  fprintf(pF, "static const uint8 INTCOM_FRM_au8%sOfs[INTCOM_FRM_U8_%s_FIELD_NUM + 1U] =\n{\n ",
+          psFrm->acFunc, psFrm->acName);
+  for (i = 1; i < psFrm->u8FieldNum; i++)
+  {
+    fprintf(pF, " %uU,", psFrm->asField[i].u16Ofs);
+  }
+  fprintf(pF, " %uU\n};\n\n", psFrm->u16Len);
+
+  if (u8Tx)
+  {
+    fprintf(pF, "typedef struct INTCOM_FRM_S_%s_TX_\n{\n", psFrm->acName);
+    fprintf(pF, "  %-*s/* Last keyframe, with its header */\n", iWidth, acKey);
+    fprintf(pF, "  %-*s/* Delta frames until the next keyframe */\n", iWidth, "uint8  u8Cnt;");
+    fprintf(pF, "} INTCOM_FRM_S_%s_TX;\n\n", psFrm->acName);
+  }
+  if (u8Rx)
+  {
+    fprintf(pF, "typedef struct INTCOM_FRM_S_%s_RX_\n{\n", psFrm->acName);
+    fprintf(pF, "  %-*s/* Last keyframe, with its header */\n", iWidth, acKey);
+    fprintf(pF, "  %-*s/* Payload bytes of the keyframe, 0: none */\n", iWidth, "uint16 u16KeyLen;");
+    fprintf(pF, "} INTCOM_FRM_S_%s_RX;\n\n", psFrm->acName);
+  }
+}
+
+static void vPrintDeltaHelpers(FILE *pF, uint8 u8Tx, uint8 u8Rx)
+{
+  if (u8Tx)
+  {
+    vPrintHeader(pF, "Append the bitmap of the fields that differ from the keyframe and\n"
+                 " *                these fields to the TX buffer",
+                 "pu8Frm   - payload\n"
+                 " *                pu8Key   - keyframe payload\n"
+                 " *                pau8Ofs  - field offsets, the payload end last\n"
+                 " *                u8FieldNum - fields after the header",
+                 "pu16TxDataNbr - bytes in the TX buffer",
+                 "pau8TxBuf - TX buffer");
+    fprintf(pF, " * \\return        -\n *\n");
+    fprintf(pF, " ***************************************************************************** */\n");
+    fprintf(pF, "static inline void INTCOM_FRM_vPackDelta(const uint8 *pu8Frm, const uint8 *pu8Key, const uint8 *pau8Ofs,\n");
+    fprintf(pF, "                                         uint8 u8FieldNum, uint8 *pau8TxBuf, uint16 *pu16TxDataNbr)\n{\n");
+    fprintf(pF, "  uint16 u16MapPos = *pu16TxDataNbr;\n");
+    fprintf(pF, "  uint16 u16Pos = u16MapPos + (((uint16)u8FieldNum + 7U) >> 3U);\n");
+    fprintf(pF, "  uint8 u8Field;\n");
+    fprintf(pF, "  uint8 u8Idx;\n\n");
+    fprintf(pF, "  for (u8Idx = 0U; u8Idx < ((u8FieldNum + 7U) >> 3U); u8Idx++)\n  {\n");
+    fprintf(pF, "    pau8TxBuf[u16MapPos + u8Idx] = 0U;\n  }\n");
+    fprintf(pF, "  for (u8Field = 0U; u8Field < u8FieldNum; u8Field++)\n  {\n");
+    fprintf(pF, "    u8Idx = pau8Ofs[u8Field];\n");
+    fprintf(pF, "    while ((u8Idx < pau8Ofs[u8Field + 1U]) && (pu8Frm[u8Idx] == pu8Key[u8Idx]))\n    {\n");
+    fprintf(pF, "      u8Idx++;\n    }\n");
+    fprintf(pF, "    if (u8Idx < pau8Ofs[u8Field + 1U]) /* Changed */\n    {\n");
+    fprintf(pF, "      pau8TxBuf[u16MapPos + (u8Field >> 3U)] |= (uint8)(1U << (u8Field & 7U));\n");
+    fprintf(pF, "      for (u8Idx = pau8Ofs[u8Field]; u8Idx < pau8Ofs[u8Field + 1U]; u8Idx++)\n      {\n");
+    fprintf(pF, "        pau8TxBuf[u16Pos++] = pu8Frm[u8Idx];\n      }\n    }\n  }\n");
+    fprintf(pF, "  *pu16TxDataNbr = u16Pos;\n}\n\n");
+  }
+  if (u8Rx)
+  {
+    vPrintHeader(pF, "Apply the fields of a delta frame on the keyframe payload",
+                 "pau8Data - payload, header, bitmap, fields\n"
+                 " *                u16Len   - payload bytes\n"
+                 " *                pau8Ofs  - field offsets, the payload end last\n"
+                 " *                u8FieldNum - fields after the header",
+                 "pu8Frm   - keyframe payload, the changed fields written",
+                 "-");
+    fprintf(pF, " * \\return        TRUE if the frame length matches the bitmap\n *\n");
+    fprintf(pF, " ***************************************************************************** */\n");
+    fprintf(pF, "static inline uint8 INTCOM_FRM_u8UnpackDelta(const uint8 *pau8Data, uint16 u16Len, const uint8 *pau8Ofs,\n");
+    fprintf(pF, "                                             uint8 u8FieldNum, uint8 *pu8Frm)\n{\n");
+    fprintf(pF, "  uint16 u16Pos = 1U + (((uint16)u8FieldNum + 7U) >> 3U);\n");
+    fprintf(pF, "  uint8 u8Field;\n");
+    fprintf(pF, "  uint8 u8Idx;\n\n");
+    fprintf(pF, "  for (u8Field = 0U; (u8Field < u8FieldNum) && (u16Pos <= u16Len); u8Field++)\n  {\n");
+    fprintf(pF, "    if (0U != (pau8Data[1U + (u8Field >> 3U)] & (uint8)(1U << (u8Field & 7U))))\n    {\n");
+    fprintf(pF, "      for (u8Idx = pau8Ofs[u8Field]; (u8Idx < pau8Ofs[u8Field + 1U]) && (u16Pos < u16Len); u8Idx++)\n      {\n");
+    fprintf(pF, "        pu8Frm[u8Idx] = pau8Data[u16Pos++];\n      }\n");
+    fprintf(pF, "      if (u8Idx < pau8Ofs[u8Field + 1U])\n      {\n");
+    fprintf(pF, "        return FALSE;   /* Frame shorter than the bitmap */\n      }\n    }\n  }\n");
+    fprintf(pF, "  return (u16Pos == u16Len) ? TRUE : FALSE;\n}\n\n");
+  }
+}
+
+static void vPrintPackDelta(FILE *pF, const FRAME_T *psFrm)
+{
+  vPrintHeader(pF, "Append the payload to the TX buffer in delta mode: a keyframe every\n"
+               " *                INTCOM_FRM_U8_<frame>_KEY_PERIOD frames or when the delta frame is\n"
+               " *                not shorter, else the fields changed since the keyframe",
+               "-",
+               "psFrm         - payload, the fields filled\n"
+               " *                psTx          - delta mode state, 0 at init and after a lost\n"
+               " *                                frame (u8Cnt = 0: keyframe next)\n"
+               " *                pu16TxDataNbr - bytes in the TX buffer",
+               "pau8TxBuf     - TX buffer");
+  fprintf(pF, " * \\return        -\n *\n");
+  fprintf(pF, " ***************************************************************************** */\n");
+  fprintf(pF, "static inline void INTCOM_FRM_vPack%sDelta(INTCOM_FRM_S_%s *psFrm, INTCOM_FRM_S_%s_TX *psTx,\n",
+          psFrm->acFunc, psFrm->acName, psFrm->acName);
+  fprintf(pF, "%*suint8 *pau8TxBuf, uint16 *pu16TxDataNbr)\n{\n", (int)(41 + strlen(psFrm->acFunc)), "");
+  fprintf(pF, "  uint16 u16Start = *pu16TxDataNbr;\n\n");
+  fprintf(pF, "  if (0U != psTx->u8Cnt)\n  {\n");
+  fprintf(pF, "    psFrm->u8Hdr = psTx->sKey.u8Hdr;\n");
+  fprintf(pF, "    pau8TxBuf[(*pu16TxDataNbr)++] = (uint8)(psTx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA);\n");
+  fprintf(pF, "    INTCOM_FRM_vPackDelta((const uint8 *)psFrm, (const uint8 *)&psTx->sKey, INTCOM_FRM_au8%sOfs,\n",
+          psFrm->acFunc);
+  fprintf(pF, "                          INTCOM_FRM_U8_%s_FIELD_NUM, pau8TxBuf, pu16TxDataNbr);\n", psFrm->acName);
+  fprintf(pF, "    if ((uint16)(*pu16TxDataNbr - u16Start) < INTCOM_FRM_U16_%s_LEN)\n    {\n", psFrm->acName);
+  fprintf(pF, "      psTx->u8Cnt--;\n");
+  fprintf(pF, "      return;\n    }\n");
+  fprintf(pF, "    *pu16TxDataNbr = u16Start;   /* Not shorter than the keyframe */\n  }\n\n");
+  fprintf(pF, "  /* Keyframe of the next sequence */\n");
+  fprintf(pF, "  INTCOM_FRM_vPack%s(psFrm, pau8TxBuf, pu16TxDataNbr);\n", psFrm->acFunc);
+  fprintf(pF, "  psFrm->u8Hdr = (uint8)(INTCOM_FRM_U8_VER |\n");
+  fprintf(pF, "                         ((psTx->sKey.u8Hdr + INTCOM_FRM_U8_SEQ_INC) & INTCOM_FRM_U8_SEQ_MASK));\n");
+  fprintf(pF, "  pau8TxBuf[u16Start] = psFrm->u8Hdr;\n");
+  fprintf(pF, "  psTx->sKey = *psFrm;\n");
+  fprintf(pF, "  psTx->u8Cnt = INTCOM_FRM_U8_%s_KEY_PERIOD - 1U;\n}\n\n", psFrm->acName);
+}
+
+static void vPrintUnpackDelta(FILE *pF, const FRAME_T *psFrm)
+{
+  vPrintHeader(pF, "Decode a keyframe or a delta frame, the receiver of a frame in\n"
+               " *                delta mode (frames without delta mode are keyframes)",
+               "pau8Data - payload, the byte after the status byte\n"
+               " *                u16Len   - payload bytes (LEN - 1)",
+               "psRx     - delta mode state, 0 at init and after a lost frame\n"
+               " *                           (u16KeyLen = 0: deltas dropped until a keyframe)",
+               "psFrm    - payload fields");
+  fprintf(pF, " * \\return        Payload bytes of the keyframe, 0 if the frame is dropped: too\n");
+  fprintf(pF, " *                short, another layout version or a delta frame on another\n");
+  fprintf(pF, " *                keyframe (psFrm not valid)\n *\n");
+  fprintf(pF, " ***************************************************************************** */\n");
+  fprintf(pF, "static inline uint16 INTCOM_FRM_u16Unpack%sDelta(const uint8 *pau8Data, uint16 u16Len,\n", psFrm->acFunc);
+  fprintf(pF, "%*sINTCOM_FRM_S_%s_RX *psRx, INTCOM_FRM_S_%s *psFrm)\n{\n",
+          (int)(47 + strlen(psFrm->acFunc)), "", psFrm->acName, psFrm->acName);
+  fprintf(pF, "  if (0U == (pau8Data[0] & INTCOM_FRM_U8_DELTA))\n  {\n");
+  fprintf(pF, "    psRx->u16KeyLen = INTCOM_FRM_u16Unpack%s(pau8Data, u16Len, &psRx->sKey);\n", psFrm->acFunc);
+  fprintf(pF, "    *psFrm = psRx->sKey;\n");
+  fprintf(pF, "    return psRx->u16KeyLen;\n  }\n\n");
+  fprintf(pF, "  /* Delta frame on the keyframe held: same version and sequence */\n");
+  fprintf(pF, "  if ((0U == psRx->u16KeyLen) || (pau8Data[0] != (uint8)(psRx->sKey.u8Hdr | INTCOM_FRM_U8_DELTA)))\n  {\n");
+  fprintf(pF, "    return 0U;\n  }\n");
+  fprintf(pF, "  *psFrm = psRx->sKey;\n");
+  fprintf(pF, "  if (FALSE == INTCOM_FRM_u8UnpackDelta(pau8Data, u16Len, INTCOM_FRM_au8%sOfs,\n", psFrm->acFunc);
+  fprintf(pF, "                                        INTCOM_FRM_U8_%s_FIELD_NUM, (uint8 *)psFrm))\n  {\n", psFrm->acName);
+  fprintf(pF, "    return 0U;\n  }\n");
+  fprintf(pF, "  return psRx->u16KeyLen;\n}\n\n");
+}
+
+static int iWriteHeader(const char *pcMcu, const char *pcSchema, const char *pcOut)
+{
+  FILE *pF;
+  uint8 i;
+  uint8 u8Used = 0u;
+  uint8 u8DeltaTx = 0u;
+  uint8 u8DeltaRx = 0u;
+  uint8 u8Tx;
+  uint8 u8Rx;
+
+  pF = fopen(pcOut, "w");
+  if (NULL == pF)
+  {
+    fprintf(stderr, "cannot write %s\n", pcOut);
+    return -1;
+  }
+
+  fprintf(pF, "/** *****************************************************************************\n");
+  fprintf(pF, " * \\file    intcom_frm.h\n");
+  fprintf(pF, " * \\brief   Inter-MCU frame payloads of the %s MCU\n", pcMcuName(pcMcu));
+  fprintf(pF, " *\n");
+  fprintf(pF, " *          Generated by C/intcom_frm_gen.c from C/%s, do not edit.\n", pcSchema);
+  fprintf(pF, " *          The payload follows the status byte of the uartprt frame and\n");
+  fprintf(pF, " *          starts with the header byte.\n");
+  fprintf(pF, " *\n");
+  fprintf(pF, " * \\section AUTHOR\n");
+  fprintf(pF, " *    1. HDC Software Team\n");
+  fprintf(pF, " *\n");
+  fprintf(pF, " * \\section SVN\n");
+  fprintf(pF, " *  $Date$\n");
+  fprintf(pF, " *  $Author$\n");
+  fprintf(pF, " *  $Revision$\n");
+  fprintf(pF, " *\n");
+  fprintf(pF, " * \\section LICENSE\n");
+  fprintf(pF, " * Copyright (c) 2016 Delta Electronics (Hangzhou Design Center & Thailand)\n");
+  fprintf(pF, " * All rights reserved.\n");
+  fprintf(pF, " ***************************************************************************** */\n\n");
+  fprintf(pF, "#ifndef INTCOM_FRM_H\n#define INTCOM_FRM_H\n");
+  fprintf(pF, "#ifdef __cplusplus\n  extern \"C\"  {\n#endif\n\n");
+  fprintf(pF, "/*******************************************************************************\n");
+  fprintf(pF, " * Included header\n");
+  fprintf(pF, " ******************************************************************************/\n\n");
+  fprintf(pF, "#include \"global.h\"\n\n");
+  fprintf(pF, "/*******************************************************************************\n");
+  fprintf(pF, " * Global constants and macros\n");
+  fprintf(pF, " ******************************************************************************/\n\n");
+  fprintf(pF, "/* Header, payload byte 0 */\n");
+  fprintf(pF, "#define INTCOM_FRM_U8_VER                        %3uU   /* Layout version */\n", u16Version);
+  fprintf(pF, "#define INTCOM_FRM_U8_VER_MASK                  0x0FU\n");
+  fprintf(pF, "#define INTCOM_FRM_U8_SEQ_MASK                  0x70U   /* Keyframe sequence */\n");
+  fprintf(pF, "#define INTCOM_FRM_U8_SEQ_INC                   0x10U\n");
+  fprintf(pF, "#define INTCOM_FRM_U8_DELTA                     0x80U   /* Delta frame: bitmap of the changed fields, the fields */\n\n");
+  fprintf(pF, "/*******************************************************************************\n");
+  fprintf(pF, " * Global data types (public typedefs / structs / enums)\n");
+  fprintf(pF, " ******************************************************************************/\n\n");
+
+  for (i = 0; i < u8FrameNum; i++)
+  {
+    u8Tx = (0 == strcmp(asFrame[i].acSrc, pcMcu)) ? 1u : 0u;
+    u8Rx = (0 == strcmp(asFrame[i].acDst, pcMcu)) ? 1u : 0u;
+    if (u8Tx || u8Rx)
+    {
+      vPrintStruct(pF, &asFrame[i]);
+      vPrintDefines(pF, &asFrame[i]);
+      if (0u != asFrame[i].u8KeyPeriod)
+      {
+        vPrintDeltaTypes(pF, &asFrame[i], u8Tx, u8Rx);
+        u8DeltaTx |= u8Tx;
+        u8DeltaRx |= u8Rx;
+      }
+      u8Used++;
+    }
+  }
+
+  fprintf(pF, "/*******************************************************************************\n");
+  fprintf(pF, " * Global functions (public to other modules)\n");
+  fprintf(pF, " ******************************************************************************/\n\n");
+  vPrintDeltaHelpers(pF, u8DeltaTx, u8DeltaRx);
+  for (i = 0; i < u8FrameNum; i++)
+  {
+    if (0 == strcmp(asFrame[i].acSrc, pcMcu))
+    {
+      vPrintPack(pF, &asFrame[i]);
+      if (0u != asFrame[i].u8KeyPeriod)
+      {
+        vPrintPackDelta(pF, &asFrame[i]);
+      }
+    }
+    if (0 == strcmp(asFrame[i].acDst, pcMcu))
+    {
+      vPrintUnpack(pF, &asFrame[i]);
+      if (0u != asFrame[i].u8KeyPeriod)
+      {
+        vPrintUnpackDelta(pF, &asFrame[i]);
+      }
+    }
+  }
+
+  fprintf(pF, "\n#ifdef __cplusplus\n  }\n#endif\n#endif  /* INTCOM_FRM_H */\n\n");
+  fprintf(pF, "  \n/*\n * End of file\n */\n");
+  fclose(pF);
+
+  if (0u == u8Used)
+  {
+    fprintf(stderr, "warning: no frame of %s\n", pcMcu);
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  const char *pcSchema = "intcom_frm.txt";
+  const char *pcBase;
+  int iArg = 1;
+
+  if ((argc > 2) && (0 == strcmp(argv[1], "-s")))
+  {
+    pcSchema = argv[2];
+    iArg = 3;
+  }
+  if ((argc - iArg) != 2)
+  {
+    fprintf(stderr, "usage: intcom_frm_gen [-s intcom_frm.txt] <com|pri|sec> <intcom_frm.h>\n");
+    return 1;
+  }
+  if ((0 != strcmp(argv[iArg], "com")) && (0 != strcmp(argv[iArg], "pri")) && (0 != strcmp(argv[iArg], "sec")))
+  {
+    fprintf(stderr, "mcu %s is not com, pri or sec\n", argv[iArg]);
+    return 1;
+  }
+
+  if (0 != iReadSchema(pcSchema))
+  {
+    return 1;
+  }
+
+  pcBase = strrchr(pcSchema, '/');
+  pcBase = (NULL != pcBase) ? (pcBase + 1) : pcSchema;
+  if (0 != iWriteHeader(argv[iArg], pcBase, argv[iArg + 1]))
+  {
+    return 1;
+  }
+  printf("%s: %s, layout version %u\n", argv[iArg + 1], argv[iArg], u16Version);
+  return 0;
+}
@@ -0,0 +1,553 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+typedef signed char sint8;
+typedef unsigned char uint8;
+typedef signed short int sint16;   /* Add for 32bit MCU */
+typedef unsigned short int uint16; /* Add for 32bit MCU */
+typedef signed long sint32;
+typedef unsigned long uint32;
+
+/*
+Scheduler slot placement optimizer
+
+  schm_slot_opt [-w wcet.txt] <schm dir> [<schm dir> ...]
+
+  e.g. schm_slot_opt -w wcet.txt ../30_Com_skywalker/30_Bsw/schm ../20_Secondary_skywalker/30_Bsw/schm
+
+Reads SCHM_SLOT_*_NUM from schm_api.h and SCHM_CFG_TASK_TABLE from schm_cfg.h
+of every scheduler and prints a new task table (paste into schm_cfg.h).
+
+Every tick runs the tick tasks plus exactly one slot, so the peak tick load is
+the tick load plus the heaviest slot. The slots of each period are packed
+independently (branch and bound, largest task first) to minimise the heaviest
+slot. Tick tasks are not moved.
+
+wcet.txt (optional), one entry per line, '#' starts a comment:
+  wcet   <task> <us>       measured WCET, replaces the budget of the table
+  before <task> <task>     first task must not run in a later slot than the
+                           second one (same slot: listed first)
+
+SCHM_cfg_vI2cprtProcessRxData before SCHM_cfg_vPmbusCopyPecAndOringStatus is
+always applied.
+*/
+
+#define MAX_TASK        64
+#define MAX_PERIOD      8
+#define MAX_SLOT        16
+#define MAX_ORDER       32
+#define MAX_NAME        64
+#define MAX_NODES       20000000UL
+
+typedef struct
+{
+  char acName[MAX_NAME];
+  char acPeriod[MAX_NAME];
+  uint8 u8Period;       /* index in acPeriodName, 0xFF = tick */
+  uint8 u8Phase;
+  uint16 u16Wcet;
+  uint8 u8NewPhase;
+  uint8 u8Rank;         /* order inside the new slot */
+} TASK_T;
+
+typedef struct
+{
+  char acPeriod[MAX_NAME];
+  uint8 u8Slots;
+} PERIOD_T;
+
+typedef struct
+{
+  char acFirst[MAX_NAME];
+  char acSecond[MAX_NAME];
+} ORDER_T;
+
+static TASK_T asTask[MAX_TASK];
+static uint8 u8TaskNum;
+static PERIOD_T asPeriod[MAX_PERIOD];
+static uint8 u8PeriodNum;
+static ORDER_T asOrder[MAX_ORDER];
+static uint8 u8OrderNum;
+
+/* Override file */
+static char acWcetName[MAX_TASK][MAX_NAME];
+static uint16 au16WcetVal[MAX_TASK];
+static uint8 u8WcetNum;
+
+/* Branch and bound state of one period */
+static uint8 au8Grp[MAX_TASK];           /* task index, largest first */
+static uint8 u8GrpNum;
+static uint8 u8GrpSlots;
+static uint8 au8Bin[MAX_TASK];
+static uint8 au8BestBin[MAX_TASK];
+static uint32 au32Load[MAX_SLOT];
+static uint32 u32Best;
+static uint32 u32Bound;
+static uint32 u32Nodes;
+static uint8 u8Found;
+
+static void vTrim(char *pc)
+{
+  char *pcEnd;
+
+  while (isspace((unsigned char)*pc))
+  {
+    memmove(pc, pc + 1, strlen(pc));
+  }
+  pcEnd = pc + strlen(pc);
+  while ((pcEnd > pc) && (isspace((unsigned char)pcEnd[-1]) || (pcEnd[-1] == 'u') || (pcEnd[-1] == 'U') ||
+                          (pcEnd[-1] == ')') || (pcEnd[-1] == '\\')))
+  {
+    *--pcEnd = '\0';
+  }
+}
+
+static sint16 s16FindTask(const char *pcName)
+{
+  uint8 i;
+
+  for (i = 0; i < u8TaskNum; i++)
+  {
+    if (0 == strcmp(asTask[i].acName, pcName))
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static void vAddOrder(const char *pcFirst, const char *pcSecond)
+{
+  if (u8OrderNum < MAX_ORDER)
+  {
+    strncpy(asOrder[u8OrderNum].acFirst, pcFirst, MAX_NAME - 1);
+    strncpy(asOrder[u8OrderNum].acSecond, pcSecond, MAX_NAME - 1);
+    u8OrderNum++;
+  }
+}
+
+static int iReadWcetFile(const char *pcFile)
+{
+  FILE *pf = fopen(pcFile, "r");
+  char acLine[256];
+  char acKey[32], acA[MAX_NAME], acB[MAX_NAME];
+
+  if (NULL == pf)
+  {
+    printf("cannot open %s\n", pcFile);
+    return -1;
+  }
+  while (NULL != fgets(acLine, sizeof(acLine), pf))
+  {
+    char *pc = strchr(acLine, '#');
+    if (NULL != pc)
+    {
+      *pc = '\0';
+    }
+    if (3 != sscanf(acLine, "%31s %63s %63s", acKey, acA, acB))
+    {
+      continue;
+    }
+    if ((0 == strcmp(acKey, "wcet")) && (u8WcetNum < MAX_TASK))
+    {
+      strcpy(acWcetName[u8WcetNum], acA);
+      au16WcetVal[u8WcetNum++] = (uint16)strtoul(acB, NULL, 0);
+    }
+    else if (0 == strcmp(acKey, "before"))
+    {
+      vAddOrder(acA, acB);
+    }
+  }
+  fclose(pf);
+  return 0;
+}
+
+/* SCHM_SLOT_<period>_NUM from schm_api.h, period names without SCHM_CFG_E_PERIOD_ */
+static int iReadSlots(const char *pcDir)
+{
+  char acPath[512], acLine[256], acName[MAX_NAME];
+  unsigned uVal;
+  FILE *pf;
+
+  sprintf(acPath, "%s/schm_api.h", pcDir);
+  pf = fopen(acPath, "r");
+  if (NULL == pf)
+  {
+    printf("cannot open %s\n", acPath);
+    return -1;
+  }
+  u8PeriodNum = 0;
+  while (NULL != fgets(acLine, sizeof(acLine), pf))
+  {
+    if ((2 == sscanf(acLine, " #define SCHM_SLOT_%63[A-Z0-9]_NUM %u", acName, &uVal)) && (u8PeriodNum < MAX_PERIOD))
+    {
+      strcpy(asPeriod[u8PeriodNum].acPeriod, acName);
+      asPeriod[u8PeriodNum].u8Slots = (uint8)((uVal < MAX_SLOT) ? uVal : MAX_SLOT);
+      u8PeriodNum++;
+    }
+  }
+  fclose(pf);
+  return 0;
+}
+
+static int iReadTasks(const char *pcDir)
+{
+  char acPath[512], acLine[256];
+  char *apcTok[6];
+  char *pc;
+  TASK_T *psTask;
+  FILE *pf;
+  uint8 i, n;
+
+  sprintf(acPath, "%s/schm_cfg.h", pcDir);
+  pf = fopen(acPath, "r");
+  if (NULL == pf)
+  {
+    printf("cannot open %s\n", acPath);
+    return -1;
+  }
+  u8TaskNum = 0;
+  while ((NULL != fgets(acLine, sizeof(acLine), pf)) && (u8TaskNum < MAX_TASK))
+  {
+    pc = strstr(acLine, "TASK(A, B,");
+    if ((NULL == pc) || (NULL != strstr(acLine, "#define")))
+    {
+      continue;
+    }
+    pc += strlen("TASK(");
+    for (n = 0; n < 6; n++)
+    {
+      apcTok[n] = strtok((0 == n) ? pc : NULL, ",");
+      if (NULL == apcTok[n])
+      {
+        break;
+      }
+      vTrim(apcTok[n]);
+    }
+    if ((n < 6) || (NULL == strstr(apcTok[3], "SCHM_CFG_E_PERIOD_")))
+    {
+      continue;
+    }
+    psTask = &asTask[u8TaskNum];
+    strncpy(psTask->acName, apcTok[2], MAX_NAME - 1);
+    strncpy(psTask->acPeriod, apcTok[3], MAX_NAME - 1);
+    psTask->u8Phase = (uint8)strtoul(apcTok[4], NULL, 0);
+    psTask->u16Wcet = (uint16)strtoul(apcTok[5], NULL, 0);
+    psTask->u8Period = 0xFF;
+    pc = strstr(psTask->acPeriod, "SCHM_CFG_E_PERIOD_");
+    for (i = 0; (i < u8PeriodNum); i++)
+    {
+      if (0 == strcmp(pc + strlen("SCHM_CFG_E_PERIOD_"), asPeriod[i].acPeriod))
+      {
+        psTask->u8Period = i;
+      }
+    }
+    for (i = 0; i < u8WcetNum; i++)
+    {
+      if (0 == strcmp(acWcetName[i], psTask->acName))
+      {
+        psTask->u16Wcet = au16WcetVal[i];
+      }
+    }
+    psTask->u8NewPhase = psTask->u8Phase;
+    psTask->u8Rank = u8TaskNum;
+    u8TaskNum++;
+  }
+  fclose(pf);
+  return 0;
+}
+
+/* Slot order that honours the ordering constraints, -1 if there is a cycle */
+static int iOrderSlots(const uint8 *pu8Bin, uint8 *pu8PhaseOfBin)
+{
+  uint8 au8In[MAX_SLOT] = {0};
+  uint8 au8Edge[MAX_SLOT][MAX_SLOT] = {{0}};
+  uint8 au8Done[MAX_SLOT] = {0};
+  uint8 au8MinPhase[MAX_SLOT];
+  uint8 i, j, k, u8Pick;
+  sint16 a, b, ia, ib;
+
+  memset(au8MinPhase, 0xFF, sizeof(au8MinPhase));
+  for (i = 0; i < u8GrpNum; i++)
+  {
+    if (asTask[au8Grp[i]].u8Phase < au8MinPhase[pu8Bin[i]])
+    {
+      au8MinPhase[pu8Bin[i]] = asTask[au8Grp[i]].u8Phase;
+    }
+  }
+  for (k = 0; k < u8OrderNum; k++)
+  {
+    a = s16FindTask(asOrder[k].acFirst);
+    b = s16FindTask(asOrder[k].acSecond);
+    ia = ib = -1;
+    for (i = 0; i < u8GrpNum; i++)
+    {
+      ia = (au8Grp[i] == a) ? i : ia;
+      ib = (au8Grp[i] == b) ? i : ib;
+    }
+    if ((ia >= 0) && (ib >= 0) && (pu8Bin[ia] != pu8Bin[ib]) && !au8Edge[pu8Bin[ia]][pu8Bin[ib]])
+    {
+      au8Edge[pu8Bin[ia]][pu8Bin[ib]] = 1;
+      au8In[pu8Bin[ib]]++;
+    }
+  }
+  /* Kahn, ready slot with the lowest old phase first to keep the diff small */
+  for (j = 0; j < u8GrpSlots; j++)
+  {
+    u8Pick = 0xFF;
+    for (i = 0; i < u8GrpSlots; i++)
+    {
+      if (!au8Done[i] && (0 == au8In[i]) && ((0xFF == u8Pick) || (au8MinPhase[i] < au8MinPhase[u8Pick])))
+      {
+        u8Pick = i;
+      }
+    }
+    if (0xFF == u8Pick)
+    {
+      return -1;
+    }
+    au8Done[u8Pick] = 1;
+    pu8PhaseOfBin[u8Pick] = j;
+    for (i = 0; i < u8GrpSlots; i++)
+    {
+      if (au8Edge[u8Pick][i])
+      {
+        au8In[i]--;
+      }
+    }
+  }
+  return 0;
+}
+
+static void vSearch(uint8 u8Idx, uint8 u8Used, uint32 u32Max)
+{
+  uint8 s, u8Phase[MAX_SLOT];
+  uint16 u16Wcet;
+
+  if ((u32Max >= u32Best) || (u32Best <= u32Bound) || (++u32Nodes > MAX_NODES))
+  {
+    return;
+  }
+  if (u8Idx == u8GrpNum)
+  {
+    if (0 == iOrderSlots(au8Bin, u8Phase))
+    {
+      u32Best = u32Max;
+      u8Found = 1;
+      memcpy(au8BestBin, au8Bin, sizeof(au8BestBin));
+    }
+    return;
+  }
+  u16Wcet = asTask[au8Grp[u8Idx]].u16Wcet;
+  /* Empty slots are interchangeable: only try the first one */
+  for (s = 0; (s < u8GrpSlots) && (s <= u8Used); s++)
+  {
+    au8Bin[u8Idx] = s;
+    au32Load[s] += u16Wcet;
+    vSearch(u8Idx + 1, (s == u8Used) ? (u8Used + 1) : u8Used, (au32Load[s] > u32Max) ? au32Load[s] : u32Max);
+    au32Load[s] -= u16Wcet;
+  }
+}
+
+static int iCmpWcet(const void *pvA, const void *pvB)
+{
+  const TASK_T *psA = &asTask[*(const uint8 *)pvA];
+  const TASK_T *psB = &asTask[*(const uint8 *)pvB];
+
+  if (psA->u16Wcet != psB->u16Wcet)
+  {
+    return (psA->u16Wcet < psB->u16Wcet) ? 1 : -1;
+  }
+  return (int)(*(const uint8 *)pvA) - (int)(*(const uint8 *)pvB);
+}
+
+static uint32 u32MaxSlot(uint8 u8Period, int iNew)
+{
+  uint32 au32Slot[MAX_SLOT] = {0};
+  uint32 u32Max = 0;
+  uint8 i;
+
+  for (i = 0; i < u8TaskNum; i++)
+  {
+    if ((asTask[i].u8Period == u8Period) && (asTask[i].u8Phase < MAX_SLOT))
+    {
+      au32Slot[iNew ? asTask[i].u8NewPhase : asTask[i].u8Phase] += asTask[i].u16Wcet;
+    }
+  }
+  for (i = 0; i < MAX_SLOT; i++)
+  {
+    u32Max = (au32Slot[i] > u32Max) ? au32Slot[i] : u32Max;
+  }
+  return u32Max;
+}
+
+static void vOptimizePeriod(uint8 u8Period)
+{
+  uint8 i, j, k, u8Phase[MAX_SLOT];
+  uint32 u32Sum = 0;
+  sint16 a, b;
+
+  u8GrpNum = 0;
+  u8GrpSlots = asPeriod[u8Period].u8Slots;
+  for (i = 0; i < u8TaskNum; i++)
+  {
+    if (asTask[i].u8Period == u8Period)
+    {
+      au8Grp[u8GrpNum++] = i;
+      u32Sum += asTask[i].u16Wcet;
+    }
+  }
+  if ((0 == u8GrpNum) || (0 == u8GrpSlots))
+  {
+    return;
+  }
+  qsort(au8Grp, u8GrpNum, sizeof(au8Grp[0]), iCmpWcet);
+
+  /* Start from the current placement, it is always feasible. Only a lighter
+     heaviest slot replaces it, so an optimal table comes out unchanged. */
+  for (i = 0; i < u8GrpNum; i++)
+  {
+    au8BestBin[i] = asTask[au8Grp[i]].u8Phase % u8GrpSlots;
+  }
+  u32Best = u32MaxSlot(u8Period, 0);
+  u32Bound = (u32Sum + u8GrpSlots - 1) / u8GrpSlots;
+  if (asTask[au8Grp[0]].u16Wcet > u32Bound)
+  {
+    u32Bound = asTask[au8Grp[0]].u16Wcet;
+  }
+  u32Nodes = 0;
+  u8Found = 0;
+  memset(au32Load, 0, sizeof(au32Load));
+  vSearch(0, 0, 0);
+
+  if (!u8Found)
+  {
+    printf("/* %-6s %2u tasks in %2u slots: heaviest slot %4lu us, kept (bound %lu us)%s */\n",
+           asPeriod[u8Period].acPeriod, u8GrpNum, u8GrpSlots, u32MaxSlot(u8Period, 0), u32Bound,
+           (u32Nodes > MAX_NODES) ? ", search truncated" : "");
+    return;
+  }
+  iOrderSlots(au8BestBin, u8Phase);
+  for (i = 0; i < u8GrpNum; i++)
+  {
+    asTask[au8Grp[i]].u8NewPhase = u8Phase[au8BestBin[i]];
+  }
+
+  /* Inside a slot keep the table order, then move a task in front of its successor */
+  for (k = 0; k < u8OrderNum; k++)
+  {
+    a = s16FindTask(asOrder[k].acFirst);
+    b = s16FindTask(asOrder[k].acSecond);
+    if ((a >= 0) && (b >= 0) && (asTask[a].u8Period == u8Period) && (asTask[b].u8Period == u8Period) &&
+        (asTask[a].u8NewPhase == asTask[b].u8NewPhase) && (asTask[a].u8Rank > asTask[b].u8Rank))
+    {
+      for (j = 0; j < u8TaskNum; j++)
+      {
+        if ((asTask[j].u8Rank >= asTask[b].u8Rank) && (asTask[j].u8Rank < asTask[a].u8Rank))
+        {
+          asTask[j].u8Rank++;
+        }
+      }
+      asTask[a].u8Rank = asTask[b].u8Rank - 1;
+    }
+  }
+  printf("/* %-6s %2u tasks in %2u slots: heaviest slot %4lu us -> %4lu us (bound %lu us)%s */\n",
+         asPeriod[u8Period].acPeriod, u8GrpNum, u8GrpSlots, u32MaxSlot(u8Period, 0), u32MaxSlot(u8Period, 1),
+         u32Bound, (u32Nodes > MAX_NODES) ? ", search truncated" : "");
+}
+
+static int iCmpNew(const void *pvA, const void *pvB)
+{
+  const TASK_T *psA = (const TASK_T *)pvA;
+  const TASK_T *psB = (const TASK_T *)pvB;
+  uint8 u8PerA = (0xFF == psA->u8Period) ? 0 : (psA->u8Period + 1);
+  uint8 u8PerB = (0xFF == psB->u8Period) ? 0 : (psB->u8Period + 1);
+
+  if (u8PerA != u8PerB)
+  {
+    return u8PerA - u8PerB;
+  }
+  if (psA->u8NewPhase != psB->u8NewPhase)
+  {
+    return psA->u8NewPhase - psB->u8NewPhase;
+  }
+  return psA->u8Rank - psB->u8Rank;
+}
+
+static void vPrintTable(void)
+{
+  uint8 i, u8Width = 0, u8PerWidth = 0;
+  uint8 u8LastPer = 0xFE;
+  uint32 u32Tick = 0, u32Max = 0;
+  char acCol[MAX_NAME + 2];
+  char acPer[MAX_NAME + 2];
+
+  for (i = 0; i < u8TaskNum; i++)
+  {
+    u8Width = (strlen(asTask[i].acName) > u8Width) ? (uint8)strlen(asTask[i].acName) : u8Width;
+    u8PerWidth = (strlen(asTask[i].acPeriod) > u8PerWidth) ? (uint8)strlen(asTask[i].acPeriod) : u8PerWidth;
+    if (0xFF == asTask[i].u8Period)
+    {
+      u32Tick += asTask[i].u16Wcet;
+    }
+  }
+  for (i = 0; i < u8PeriodNum; i++)
+  {
+    u32Max = (u32MaxSlot(i, 1) > u32Max) ? u32MaxSlot(i, 1) : u32Max;
+  }
+  printf("/* Peak tick load: %lu us tick tasks + %lu us slot = %lu us */\n", u32Tick, u32Max, u32Tick + u32Max);
+
+  qsort(asTask, u8TaskNum, sizeof(asTask[0]), iCmpNew);
+  printf("#define SCHM_CFG_TASK_TABLE(TASK, A, B) \\\n");
+  for (i = 0; i < u8TaskNum; i++)
+  {
+    if ((u8LastPer != 0xFE) && (u8LastPer != asTask[i].u8Period))
+    {
+      printf("  \\\n");
+    }
+    u8LastPer = asTask[i].u8Period;
+    sprintf(acCol, "%s,", asTask[i].acName);
+    sprintf(acPer, "%s,", asTask[i].acPeriod);
+    printf("  TASK(A, B, %-*s %-*s%2uu, %2uu)%s\n", u8Width + 2, acCol, u8PerWidth + 1, acPer,
+           asTask[i].u8NewPhase, asTask[i].u16Wcet, (i + 1 < u8TaskNum) ? " \\" : "");
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int iArg = 1;
+  uint8 i;
+
+  if ((argc > 2) && (0 == strcmp(argv[1], "-w")))
+  {
+    if (0 != iReadWcetFile(argv[2]))
+    {
+      return 1;
+    }
+    iArg = 3;
+  }
+  if (iArg >= argc)
+  {
+    printf("usage: schm_slot_opt [-w wcet.txt] <schm dir> [<schm dir> ...]\n");
+    return 1;
+  }
+  vAddOrder("SCHM_cfg_vI2cprtProcessRxData", "SCHM_cfg_vPmbusCopyPecAndOringStatus");
+
+  for (; iArg < argc; iArg++)
+  {
+    if ((0 != iReadSlots(argv[iArg])) || (0 != iReadTasks(argv[iArg])))
+    {
+      return 1;
+    }
+    printf("/* ---- %s ---- */\n", argv[iArg]);
+    for (i = 0; i < u8PeriodNum; i++)
+    {
+      vOptimizePeriod(i);
+    }
+    vPrintTable();
+    printf("\n");
+  }
+  return 0;
+}